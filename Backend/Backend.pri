@@ -20,25 +20,33 @@ INCLUDEPATH += $$PWD\..\Include
 
 HEADERS += \
     $$PWD/cashcalculation.h \
+    $$PWD/changeset.h \
     $$PWD/deal.h \
     $$PWD/deserializer.h \
     $$PWD/diskrepository.h \
     $$PWD/entry.h \
     $$PWD/eventinfo.h \
+    $$PWD/gamedelta.h \
     $$PWD/gameinfo.h \
+    $$PWD/houserules.h \
+    $$PWD/journalrepository.h \
     $$PWD/mandatorysolotrigger.h \
     $$PWD/multiplierinfo.h \
     $$PWD/playerinfo.h \
     $$PWD/playersset.h \
-    $$PWD/repository.h
+    $$PWD/rangeextremum.h \
+    $$PWD/repository.h \
+    $$PWD/scoretable.h \
+    $$PWD/statistics.h
 
 SOURCES += \
-    $$PWD/cashcalculation.cpp \
     $$PWD/deal.cpp \
     $$PWD/deserializer.cpp \
     $$PWD/diskrepository.cpp \
     $$PWD/gameinfo.cpp \
+    $$PWD/journalrepository.cpp \
     $$PWD/mandatorysolotrigger.cpp \
     $$PWD/multiplierinfo.cpp \
     $$PWD/playerinfo.cpp \
-    $$PWD/playersset.cpp
+    $$PWD/playersset.cpp \
+    $$PWD/scoretable.cpp
@@ -19,14 +19,21 @@
 #ifndef CASHCALCULATION_H
 #define CASHCALCULATION_H
 
+#include "houserules.h"
+
 namespace Backend
 {
     /*!
      * \brief Calculates the due balance in Euro cents based on the given point difference.
+     * \tparam Rules The rules providing the conversion.
      * \param pointDifference The point difference to convert.
      * \return The due balance in Euro cents.
      */
-    unsigned int CalculateCashCents(unsigned int pointDifference);
+    template<HouseRulesPolicy Rules = HouseRules>
+    constexpr unsigned int CalculateCashCents(unsigned int pointDifference)
+    {
+        return pointDifference * Rules::PointToCentNumerator / Rules::PointToCentDenominator;
+    }
 }
 
 #endif // CASHCALCULATION_H
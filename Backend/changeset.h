@@ -0,0 +1,149 @@
+/*
+ * This file is part of QtDoppelKopf.
+ *
+ * QtDoppelKopf is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtDoppelKopf is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtDoppelKopf.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef CHANGESET_H
+#define CHANGESET_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Backend
+{
+    /*!
+     * \brief The ChangeSet class holds the score changes of a single deal.
+     *        As a deal never has more than Capacity changes, they are kept inline without allocating.
+     * \tparam Player The type identifying a player, i.e. the position in the players set or the index within the game.
+     */
+    template<typename Player>
+    class ChangeSet
+    {
+    public:
+        using value_type = std::pair<Player, int>;
+
+        static constexpr size_t Capacity = 4U;
+
+        using const_iterator = typename std::array<value_type, Capacity>::const_iterator;
+
+    private:
+        std::array<value_type, Capacity> changes{};
+        size_t count{};
+
+    public:
+        /*!
+         * \brief Initializes an empty instance.
+         */
+        ChangeSet() = default;
+
+        /*!
+         * \brief Initializes a new instance from the given changes.
+         * \param values The changes, which must not be more than Capacity.
+         */
+        ChangeSet(std::initializer_list<value_type> values) //NOLINT(google-explicit-constructor, hicpp-explicit-conversions)
+        {
+            for(const auto & value : values)
+            {
+                this->push_back(value);
+            }
+        }
+
+        /*!
+         * \brief Initializes a new instance from the given changes.
+         * \param values The changes, which must not be more than Capacity.
+         */
+        ChangeSet(const std::vector<value_type>& values) //NOLINT(google-explicit-constructor, hicpp-explicit-conversions)
+        {
+            for(const auto & value : values)
+            {
+                this->push_back(value);
+            }
+        }
+
+        /*!
+         * \brief Initializes a new instance by moving from the given changes.
+         * \param values The changes, which must not be more than Capacity.
+         */
+        ChangeSet(std::vector<value_type>&& values) //NOLINT(google-explicit-constructor, hicpp-explicit-conversions)
+        {
+            for(auto & value : values)
+            {
+                this->push_back(std::move(value));
+            }
+        }
+
+        /*!
+         * \brief Appends a change.
+         * \param value The change to append.
+         */
+        void push_back(value_type value)
+        {
+            if(this->count == Capacity)
+            {
+                throw std::exception((std::string("there can never be more than ") + std::to_string(Capacity) + std::string(" or zero changes")).c_str());
+            }
+
+            this->changes[this->count++] = std::move(value);
+        }
+
+        /*!
+         * \brief Appends a change.
+         * \param player The player whose score changes.
+         * \param diff The change in score.
+         */
+        void emplace_back(Player player, int diff)
+        {
+            this->push_back(value_type(std::move(player), diff));
+        }
+
+        [[nodiscard]] size_t size() const
+        {
+            return this->count;
+        }
+
+        [[nodiscard]] bool empty() const
+        {
+            return this->count == 0;
+        }
+
+        [[nodiscard]] const value_type& operator[](size_t index) const
+        {
+            return this->changes[index];
+        }
+
+        [[nodiscard]] const_iterator begin() const
+        {
+            return this->changes.begin();
+        }
+
+        [[nodiscard]] const_iterator end() const
+        {
+            return this->changes.begin() + static_cast<std::ptrdiff_t>(this->count);
+        }
+
+        [[nodiscard]] bool operator==(const ChangeSet& other) const
+        {
+            return std::equal(this->begin(), this->end(), other.begin(), other.end());
+        }
+    };
+}
+
+#endif // CHANGESET_H
@@ -20,7 +20,7 @@
 
 #include <utility>
 
-Backend::Deal::Deal(std::vector<std::pair<std::string, int>> changes,
+Backend::Deal::Deal(Backend::ChangeSet<unsigned int> changes,
                     Backend::NumberOfEvents numberOfEvents,
                     Backend::Players presentPlayers)
     : changes(std::move(changes)),
@@ -29,11 +29,6 @@ Backend::Deal::Deal(std::vector<std::pair<std::string, int>> changes,
 {
 }
 
-enum Backend::Entry::Kind Backend::Deal::Kind() const
-{
-    return Backend::Entry::Kind::Deal;
-}
-
 Backend::NumberOfEvents Backend::Deal::NumberOfEvents() const
 {
     return numberOfEvents;
@@ -44,7 +39,14 @@ Backend::Players Backend::Deal::Players() const
     return players;
 }
 
-std::vector<std::pair<std::string, int>> Backend::Deal::Changes() const
+const Backend::ChangeSet<unsigned int>& Backend::Deal::Changes() const
 {
     return changes;
 }
+
+bool Backend::Deal::operator==(const Backend::Deal& other) const
+{
+    return this->changes == other.changes
+            && this->numberOfEvents.Value() == other.numberOfEvents.Value()
+            && this->players.Value() == other.players.Value();
+}
@@ -16,10 +16,8 @@
  *
  */
 
-#include "entry.h"
+#include "changeset.h"
 #include "eventinfo.h"
-#include <string>
-#include <vector>
 
 #ifndef DEAL_H
 #define DEAL_H
@@ -29,35 +27,32 @@ namespace Backend
     /*!
      * \brief The Deal class represents a completed deal
      *        and its results.
+     *        The players are identified by their position in the players set the deal was played under,
+     *        names are only resolved when serializing.
      */
-    class Deal final : public Entry
+    class Deal final
     {
     private:
-        std::vector<std::pair<std::string, int>> changes;
+        ChangeSet<unsigned int> changes;
         NumberOfEvents numberOfEvents;
         Players players;
 
     public:
         /*!
          * \brief Initializes a new instance.
-         * \param changes The unmultiplied score changes from this deal.
+         * \param changes The unmultiplied score changes from this deal by the positions of the players in the players set.
          * \param numberOfEvents The number of multiplier-relevant events from this deal.
          * \param players The number of players present at this deal.
          */
-        Deal(std::vector<std::pair<std::string, int>> changes,
+        Deal(ChangeSet<unsigned int> changes,
              NumberOfEvents numberOfEvents,
              Players presentPlayers);
 
-        /*!
-         * \reimp
-         */
-        [[nodiscard]] enum Entry::Kind Kind() const override;
-
         /*!
          * \brief Gets the unmultiplied score changes from this deal.
-         * \return The unmultiplied score changes from this deal.
+         * \return The unmultiplied score changes from this deal by the positions of the players in the players set.
          */
-        [[nodiscard]] std::vector<std::pair<std::string, int>> Changes() const;
+        [[nodiscard]] const ChangeSet<unsigned int>& Changes() const;
 
         /*!
          * \brief Gets the number of multiplier-relevant events from this deal.
@@ -70,6 +65,13 @@ namespace Backend
          * \return The number of players present at this deal.
          */
         [[nodiscard]] Players Players() const;
+
+        /*!
+         * \brief Compares the deal with another one.
+         * \param other The deal to compare with.
+         * \return A value indicating whether both deals are equal.
+         */
+        [[nodiscard]] bool operator==(const Deal& other) const;
     };
 }
 
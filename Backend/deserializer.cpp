@@ -19,376 +19,1204 @@
 #include "deserializer.h"
 #include "rapidjson/istreamwrapper.h"
 #include "rapidjson/ostreamwrapper.h"
+#include "rapidjson/reader.h"
 #include "rapidjson/writer.h"
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <string_view>
 
 constexpr const char * DataVersion = "2";
 
-Backend::DeSerializer::DeSerializer()
-= default;
-
-void Backend::DeSerializer::Serialize(const std::vector<std::shared_ptr<Backend::Entry>>& entries, std::ostream & os) //NOLINT(readability-convert-member-functions-to-static)
+class Backend::DeSerializer::ReaderHandler : public rapidjson::BaseReaderHandler<rapidjson::UTF8<char>, Backend::DeSerializer::ReaderHandler>
 {
-    rapidjson::GenericDocument<rapidjson::UTF8<char>> document;
-    document.SetObject();
-    auto & allocator = document.GetAllocator();
+private:
+    /*!
+     * \brief The Context enum lists the containers the reader can currently be in.
+     */
+    enum class Context
+    {
+        RootObject,
+        DataArray,
+        EntryObject,
+        PlayerNamesArray,
+        SitOutSchemeArray,
+        ChangesArray,
+        ChangeObject,
+    };
+
+    /*!
+     * \brief The Target enum lists the meaning of the next value read.
+     */
+    enum class Target
+    {
+        None,
+        Root,
+        DataVersion,
+        Data,
+        Entry,
+        Kind,
+        PlayerNames,
+        PlayerName,
+        DealerName,
+        SitOutScheme,
+        SitOutSchemeItem,
+        PreviousDealerName,
+        Players,
+        NumberOfEvents,
+        Changes,
+        Change,
+        ChangeName,
+        ChangeDiff,
+    };
+
+    /*!
+     * \brief The ScalarKind enum distinguishes the scalar values relevant for validation.
+     */
+    enum class ScalarKind
+    {
+        String,
+        Int,
+        Other,
+    };
 
-    rapidjson::GenericValue<rapidjson::UTF8<char>> key;
-    rapidjson::GenericValue<rapidjson::UTF8<char>> value;
+    template<typename T>
+    struct Member
+    {
+        bool present{};
+        bool valid{};
+        T value{};
+        std::string itemError;
+    };
 
-    key.SetString(KeyDataVersion, static_cast<rapidjson::SizeType>(strlen(KeyDataVersion)), allocator);
-    value.SetString(DataVersion, allocator);
-    document.AddMember(key, value, allocator);
+    struct EntryState
+    {
+        Member<std::string> kind;
+        Member<std::vector<std::string>> playerNames;
+        Member<std::string> dealerName;
+        Member<std::set<unsigned int>> sitOutScheme;
+        Member<std::string> previousDealerName;
+        Member<unsigned int> players;
+        Member<unsigned int> numberOfEvents;
+        Member<std::vector<std::pair<std::string, int>>> changes;
+    };
+
+    struct ChangeState
+    {
+        Member<std::string> name;
+        Member<int> diff;
+    };
 
-    rapidjson::GenericValue<rapidjson::UTF8<char>> array;
-    array.SetArray();
+    const bool singleEntry;
+    std::vector<Context> contexts;
+    Target pendingMember{Target::None};
+    unsigned int skipDepth{};
 
-    for (const auto & entry : entries)
-    {
-        Backend::DeSerializer::SerializeEntry(entry, value, allocator);
+    bool rootIsObject{};
+    Member<bool> dataVersion;
+    Member<bool> data;
+    std::string firstError;
 
-        array.PushBack(value, allocator);
-    }
+    EntryState entry;
+    ChangeState change;
 
-    key.SetString(KeyData, static_cast<rapidjson::SizeType>(strlen(KeyData)), allocator);
-    document.AddMember(key, array, allocator);
+    std::vector<std::string> players;
+    std::vector<Backend::Entry> entries;
+
+public:
+    /*!
+     * \brief Initializes a new instance.
+     * \param singleEntry A value indicating whether to read a single entry object instead of a complete document.
+     * \param players The names of the players in the last players set before the first entry read.
+     */
+    ReaderHandler(bool singleEntry, std::vector<std::string> players)
+        : singleEntry(singleEntry),
+          players(std::move(players))
+    {
+    }
 
-    rapidjson::OStreamWrapper osw(os);
+    bool Null()
+    {
+        return this->Scalar(ScalarKind::Other, nullptr, 0);
+    }
 
-    rapidjson::Writer<rapidjson::OStreamWrapper, rapidjson::UTF8<char>, rapidjson::ASCII<char>> writer(osw);
-    document.Accept(writer);
-}
+    bool Bool(bool /*value*/)
+    {
+        return this->Scalar(ScalarKind::Other, nullptr, 0);
+    }
 
-std::vector<std::shared_ptr<Backend::Entry>> Backend::DeSerializer::Deserialize(std::istream & is) //NOLINT(readability-convert-member-functions-to-static)
-{
-    rapidjson::IStreamWrapper isw(is);
+    bool Int(int value)
+    {
+        return this->Scalar(ScalarKind::Int, nullptr, value);
+    }
 
-    rapidjson::GenericDocument<rapidjson::UTF8<char>> document;
-    document.ParseStream(isw);
+    bool Uint(unsigned int value)
+    {
+        return value <= static_cast<unsigned int>(std::numeric_limits<int>::max())
+                ? this->Scalar(ScalarKind::Int, nullptr, static_cast<int>(value))
+                : this->Scalar(ScalarKind::Other, nullptr, 0);
+    }
 
-    if(!(document.IsObject()))
+    bool Int64(int64_t /*value*/)
     {
-        throw std::exception("did not parse to object");
+        return this->Scalar(ScalarKind::Other, nullptr, 0);
     }
 
-    if(!(document.HasMember(KeyDataVersion) && document[KeyDataVersion].IsString() && std::strcmp(document[KeyDataVersion].GetString(), DataVersion) == 0))
+    bool Uint64(uint64_t /*value*/)
     {
-        throw std::exception("no valid data version found");
+        return this->Scalar(ScalarKind::Other, nullptr, 0);
     }
 
-    if(!(document.HasMember(KeyData) && document[KeyData].IsArray()))
+    bool Double(double /*value*/)
     {
-        throw std::exception("no valid data member found");
+        return this->Scalar(ScalarKind::Other, nullptr, 0);
     }
 
-    std::vector<std::shared_ptr<Backend::Entry>> entries;
+    bool String(const char * value, rapidjson::SizeType /*length*/, bool /*copy*/)
+    {
+        return this->Scalar(ScalarKind::String, value, 0);
+    }
 
-    for(auto const & data : document[KeyData].GetArray())
+    bool StartObject()
     {
-        if(!data.IsObject())
+        if(this->skipDepth > 0)
         {
-            throw std::exception("entry is not object");
+            ++(this->skipDepth);
+            return true;
         }
 
-        if(!data.HasMember(KeyKind))
+        switch(this->CurrentTarget())
         {
-            throw std::exception("missing kind in entry");
+        case Target::Root:
+            this->rootIsObject = true;
+            this->contexts.push_back(Context::RootObject);
+            break;
+        case Target::Entry:
+            this->entry = EntryState();
+            this->contexts.push_back(Context::EntryObject);
+            break;
+        case Target::Change:
+            this->change = ChangeState();
+            this->contexts.push_back(Context::ChangeObject);
+            break;
+        default:
+            this->Container();
+            break;
         }
 
-        if(!data[KeyKind].IsString())
+        return true;
+    }
+
+    bool EndObject(rapidjson::SizeType /*memberCount*/)
+    {
+        if(this->skipDepth > 0)
         {
-            throw std::exception("kind is not string");
+            --(this->skipDepth);
+            return true;
         }
 
-        const auto *kind = data[KeyKind].GetString();
-        if(std::strcmp(kind, ValuePlayersSet) == 0)
+        auto context = this->contexts.back();
+        this->contexts.pop_back();
+        this->pendingMember = Target::None;
+
+        if(context == Context::EntryObject)
         {
-            auto entry = Backend::DeSerializer::DeserializePlayersSet(data);
-            entries.push_back(entry);
+            this->FinishEntry();
         }
-        else if(std::strcmp(kind, ValueDeal) == 0)
+        else if(context == Context::ChangeObject)
         {
-            auto entry = Backend::DeSerializer::DeserializeDeal(data);
-            entries.push_back(entry);
+            this->FinishChange();
         }
-        else if(std::strcmp(kind, ValueMandatorySoloTrigger) == 0)
+
+        return true;
+    }
+
+    bool StartArray()
+    {
+        if(this->skipDepth > 0)
         {
-            entries.push_back(std::make_shared<MandatorySoloTrigger>());
+            ++(this->skipDepth);
+            return true;
         }
-        else
+
+        switch(this->CurrentTarget())
         {
-            throw std::exception((std::string("unknown kind value in data: \"") + kind + std::string("\"")).c_str());
+        case Target::Data:
+            this->Accept(this->data, true);
+            this->contexts.push_back(Context::DataArray);
+            break;
+        case Target::PlayerNames:
+            this->Accept(this->entry.playerNames, true);
+            this->contexts.push_back(Context::PlayerNamesArray);
+            break;
+        case Target::SitOutScheme:
+            this->Accept(this->entry.sitOutScheme, true);
+            this->contexts.push_back(Context::SitOutSchemeArray);
+            break;
+        case Target::Changes:
+            this->Accept(this->entry.changes, true);
+            this->contexts.push_back(Context::ChangesArray);
+            break;
+        default:
+            this->Container();
+            break;
         }
+
+        return true;
     }
 
-    return entries;
-}
+    bool EndArray(rapidjson::SizeType /*elementCount*/)
+    {
+        if(this->skipDepth > 0)
+        {
+            --(this->skipDepth);
+            return true;
+        }
 
-void Backend::DeSerializer::SerializeEntry(const std::shared_ptr<Entry>& entry,
-                                           rapidjson::GenericValue<rapidjson::UTF8<char>> & serializedEntry,
-                                           rapidjson::MemoryPoolAllocator<rapidjson::CrtAllocator> & allocator)
-{
-    switch(entry->Kind())
-    {
-    case Entry::Kind::PlayersSet:
-        Backend::DeSerializer::SerializePlayersSet(std::static_pointer_cast<PlayersSet>(entry), serializedEntry, allocator);
-        break;
-    case Entry::Kind::Deal:
-        Backend::DeSerializer::SerializeDeal(std::static_pointer_cast<Deal>(entry), serializedEntry, allocator);
-        break;
-    case Entry::Kind::MandatorySoloTrigger:
-        Backend::DeSerializer::SerializeMandatorySoloTrigger(serializedEntry, allocator);
-        break;
-    default:
-        throw std::exception("value of Entry::Kind not handled");
+        this->contexts.pop_back();
+        this->pendingMember = Target::None;
+
+        return true;
     }
-}
 
-void Backend::DeSerializer::SerializePlayersSet(const std::shared_ptr<PlayersSet>& playersSet,
-                                                rapidjson::GenericValue<rapidjson::UTF8<char>> & serializedEntry,
-                                                rapidjson::MemoryPoolAllocator<rapidjson::CrtAllocator> & allocator)
-{
-    serializedEntry.SetObject();
+    bool Key(const char * key, rapidjson::SizeType length, bool /*copy*/)
+    {
+        if(this->skipDepth > 0)
+        {
+            return true;
+        }
 
-    rapidjson::GenericValue<rapidjson::UTF8<char>> key;
-    rapidjson::GenericValue<rapidjson::UTF8<char>> value;
-    rapidjson::GenericValue<rapidjson::UTF8<char>> helper;
+        const std::string_view name(key, length);
 
-    key.SetString(KeyKind, static_cast<rapidjson::SizeType>(strlen(KeyKind)), allocator);
-    value.SetString(ValuePlayersSet, static_cast<rapidjson::SizeType>(strlen(ValuePlayersSet)), allocator);
-    serializedEntry.AddMember(key, value, allocator);
+        switch(this->contexts.back())
+        {
+        case Context::RootObject:
+            this->pendingMember = this->Unseen(name == KeyDataVersion, this->dataVersion, Target::DataVersion);
+            if(this->pendingMember == Target::None)
+            {
+                this->pendingMember = this->Unseen(name == KeyData, this->data, Target::Data);
+            }
+            break;
+        case Context::EntryObject:
+            this->pendingMember = this->EntryMember(name);
+            break;
+        case Context::ChangeObject:
+            this->pendingMember = this->Unseen(name == KeyChangeName, this->change.name, Target::ChangeName);
+            if(this->pendingMember == Target::None)
+            {
+                this->pendingMember = this->Unseen(name == KeyChangeDiff, this->change.diff, Target::ChangeDiff);
+            }
+            break;
+        default:
+            this->pendingMember = Target::None;
+            break;
+        }
 
-    key.SetString(KeyPlayerNames, static_cast<rapidjson::SizeType>(strlen(KeyPlayerNames)), allocator);
-    value.SetArray();
-    for (auto & playerName : playersSet->Players())
+        return true;
+    }
+
+    /*!
+     * \brief Gets the entries read, after validating the document in the same order
+     *        as a check of the complete document would.
+     * \param parsedSuccessfully A value indicating whether the reader finished without error.
+     * \return The entries read.
+     */
+    std::vector<Backend::Entry> Result(bool parsedSuccessfully)
     {
-        helper.SetString(playerName.c_str(), static_cast<rapidjson::SizeType>(strlen(playerName.c_str())), allocator);
-        value.PushBack(helper, allocator);
+        if(this->singleEntry)
+        {
+            if(!parsedSuccessfully)
+            {
+                throw std::exception("did not parse to object");
+            }
+
+            if(!this->firstError.empty())
+            {
+                throw std::exception(this->firstError.c_str());
+            }
+
+            return std::move(this->entries);
+        }
+
+        if(!(parsedSuccessfully && this->rootIsObject))
+        {
+            throw std::exception("did not parse to object");
+        }
+
+        if(!(this->dataVersion.present && this->dataVersion.valid))
+        {
+            throw std::exception("no valid data version found");
+        }
+
+        if(!(this->data.present && this->data.valid))
+        {
+            throw std::exception("no valid data member found");
+        }
+
+        if(!this->firstError.empty())
+        {
+            throw std::exception(this->firstError.c_str());
+        }
+
+        return std::move(this->entries);
     }
-    serializedEntry.AddMember(key, value, allocator);
 
-    key.SetString(KeyDealerName, static_cast<rapidjson::SizeType>(strlen(KeyDealerName)), allocator);
-    value.SetString(playersSet->Dealer().c_str(), static_cast<rapidjson::SizeType>(strlen(playersSet->Dealer().c_str())), allocator);
-    serializedEntry.AddMember(key, value, allocator);
+private:
+    [[nodiscard]] Target CurrentTarget() const
+    {
+        if(this->contexts.empty())
+        {
+            return this->singleEntry ? Target::Entry : Target::Root;
+        }
+
+        switch(this->contexts.back())
+        {
+        case Context::DataArray:
+            return Target::Entry;
+        case Context::PlayerNamesArray:
+            return Target::PlayerName;
+        case Context::SitOutSchemeArray:
+            return Target::SitOutSchemeItem;
+        case Context::ChangesArray:
+            return Target::Change;
+        default:
+            return this->pendingMember;
+        }
+    }
 
-    key.SetString(KeySitOutScheme, static_cast<rapidjson::SizeType>(strlen(KeySitOutScheme)), allocator);
-    value.SetArray();
-    for (const auto & sitOutItem : playersSet->SitOutScheme())
+    template<typename T>
+    [[nodiscard]] static Target Unseen(bool matches, const Member<T> & member, Target target)
     {
-        helper.SetUint(sitOutItem);
-        value.PushBack(helper, allocator);
+        return matches && !member.present ? target : Target::None;
     }
 
-    serializedEntry.AddMember(key, value, allocator);
+    template<typename T>
+    static void Accept(Member<T> & member, bool valid)
+    {
+        member.present = true;
+        member.valid = valid;
+    }
 
-    key.SetString(KeyPreviousDealerName, static_cast<rapidjson::SizeType>(strlen(KeyPreviousDealerName)), allocator);
-    value.SetString(playersSet->PreviousDealer().c_str(), static_cast<rapidjson::SizeType>(strlen(playersSet->PreviousDealer().c_str())), allocator);
-    serializedEntry.AddMember(key, value, allocator);
-}
+    template<typename T>
+    static void ItemError(Member<T> & member, const char * message)
+    {
+        if(member.itemError.empty())
+        {
+            member.itemError = message;
+        }
+    }
 
-void Backend::DeSerializer::SerializeDeal(const std::shared_ptr<Deal>& deal,
-                                          rapidjson::GenericValue<rapidjson::UTF8<char>> & serializedEntry,
-                                          rapidjson::MemoryPoolAllocator<rapidjson::CrtAllocator> & allocator)
-{
-    serializedEntry.SetObject();
+    void Error(const std::string & message)
+    {
+        if(this->firstError.empty())
+        {
+            this->firstError = message;
+        }
+    }
 
-    rapidjson::GenericValue<rapidjson::UTF8<char>> key;
-    rapidjson::GenericValue<rapidjson::UTF8<char>> value;
-    rapidjson::GenericValue<rapidjson::UTF8<char>> changeObject;
-    rapidjson::GenericValue<rapidjson::UTF8<char>> changeKey;
-    rapidjson::GenericValue<rapidjson::UTF8<char>> changeValue;
+    [[nodiscard]] Target EntryMember(std::string_view name) const
+    {
+        if(name == KeyKind)
+        {
+            return Unseen(true, this->entry.kind, Target::Kind);
+        }
 
-    key.SetString(KeyKind, static_cast<rapidjson::SizeType>(strlen(KeyKind)), allocator);
-    value.SetString(ValueDeal, static_cast<rapidjson::SizeType>(strlen(ValueDeal)), allocator);
-    serializedEntry.AddMember(key, value, allocator);
+        if(name == KeyPlayerNames)
+        {
+            return Unseen(true, this->entry.playerNames, Target::PlayerNames);
+        }
 
-    key.SetString(KeyPlayers, static_cast<rapidjson::SizeType>(strlen(KeyPlayers)), allocator);
-    value.SetUint(deal->Players().Value());
-    serializedEntry.AddMember(key, value, allocator);
+        if(name == KeyDealerName)
+        {
+            return Unseen(true, this->entry.dealerName, Target::DealerName);
+        }
 
-    key.SetString(KeyNumberOfEvents, static_cast<rapidjson::SizeType>(strlen(KeyNumberOfEvents)), allocator);
-    value.SetUint(deal->NumberOfEvents().Value());
-    serializedEntry.AddMember(key, value, allocator);
+        if(name == KeySitOutScheme)
+        {
+            return Unseen(true, this->entry.sitOutScheme, Target::SitOutScheme);
+        }
 
-    key.SetString(KeyChanges, static_cast<rapidjson::SizeType>(strlen(KeyChanges)), allocator);
-    value.SetArray();
-    for (auto & change : deal->Changes())
-    {
-        changeObject.SetObject();
+        if(name == KeyPreviousDealerName)
+        {
+            return Unseen(true, this->entry.previousDealerName, Target::PreviousDealerName);
+        }
 
-        changeKey.SetString(KeyChangeName, static_cast<rapidjson::SizeType>(strlen(KeyChangeName)), allocator);
-        changeValue.SetString(change.first.c_str(), static_cast<rapidjson::SizeType>(strlen(change.first.c_str())), allocator);
-        changeObject.AddMember(changeKey, changeValue, allocator);
+        if(name == KeyPlayers)
+        {
+            return Unseen(true, this->entry.players, Target::Players);
+        }
 
-        changeKey.SetString(KeyChangeDiff, static_cast<rapidjson::SizeType>(strlen(KeyChangeDiff)), allocator);
-        changeValue.SetInt(change.second);
-        changeObject.AddMember(changeKey, changeValue, allocator);
+        if(name == KeyNumberOfEvents)
+        {
+            return Unseen(true, this->entry.numberOfEvents, Target::NumberOfEvents);
+        }
 
-        value.PushBack(changeObject, allocator);
+        if(name == KeyChanges)
+        {
+            return Unseen(true, this->entry.changes, Target::Changes);
+        }
+
+        return Target::None;
     }
 
-    serializedEntry.AddMember(key, value, allocator);
-}
+    /*!
+     * \brief Handles a container in a place where the target does not expect one,
+     *        marking the target as invalid and skipping the content of the container.
+     */
+    void Container()
+    {
+        this->Scalar(ScalarKind::Other, nullptr, 0);
+        this->skipDepth = 1;
+    }
 
-void Backend::DeSerializer::SerializeMandatorySoloTrigger(rapidjson::GenericValue<rapidjson::UTF8<char>> & serializedEntry,
-                                                          rapidjson::MemoryPoolAllocator<rapidjson::CrtAllocator> & allocator)
-{
-    serializedEntry.SetObject();
+    bool Scalar(ScalarKind kind, const char * string, int number)
+    {
+        if(this->skipDepth > 0)
+        {
+            return true;
+        }
 
-    rapidjson::GenericValue<rapidjson::UTF8<char>> key;
-    rapidjson::GenericValue<rapidjson::UTF8<char>> value;
+        switch(this->CurrentTarget())
+        {
+        case Target::None:
+        case Target::Root:
+            break;
+        case Target::DataVersion:
+            Accept(this->dataVersion, kind == ScalarKind::String && std::strcmp(string, DataVersion) == 0);
+            break;
+        case Target::Data:
+            Accept(this->data, false);
+            break;
+        case Target::Entry:
+            this->Error("entry is not object");
+            break;
+        case Target::Kind:
+            AcceptString(this->entry.kind, kind, string);
+            break;
+        case Target::PlayerNames:
+            Accept(this->entry.playerNames, false);
+            break;
+        case Target::PlayerName:
+            if(kind == ScalarKind::String)
+            {
+                this->entry.playerNames.value.emplace_back(string);
+            }
+            else
+            {
+                ItemError(this->entry.playerNames, "player name is not a string");
+            }
+            break;
+        case Target::DealerName:
+            AcceptString(this->entry.dealerName, kind, string);
+            break;
+        case Target::SitOutScheme:
+            Accept(this->entry.sitOutScheme, false);
+            break;
+        case Target::SitOutSchemeItem:
+            if(kind == ScalarKind::Int)
+            {
+                this->entry.sitOutScheme.value.emplace(number);
+            }
+            else
+            {
+                ItemError(this->entry.sitOutScheme, "sit out scheme item is not an int");
+            }
+            break;
+        case Target::PreviousDealerName:
+            AcceptString(this->entry.previousDealerName, kind, string);
+            break;
+        case Target::Players:
+            AcceptNumber(this->entry.players, kind, number);
+            break;
+        case Target::NumberOfEvents:
+            AcceptNumber(this->entry.numberOfEvents, kind, number);
+            break;
+        case Target::Changes:
+            Accept(this->entry.changes, false);
+            break;
+        case Target::Change:
+            ItemError(this->entry.changes, "changes item is not an object");
+            break;
+        case Target::ChangeName:
+            AcceptString(this->change.name, kind, string);
+            break;
+        case Target::ChangeDiff:
+            Accept(this->change.diff, kind == ScalarKind::Int);
+            this->change.diff.value = number;
+            break;
+        }
 
-    key.SetString(KeyKind, static_cast<rapidjson::SizeType>(strlen(KeyKind)), allocator);
-    value.SetString(ValueMandatorySoloTrigger, static_cast<rapidjson::SizeType>(strlen(ValueMandatorySoloTrigger)), allocator);
-    serializedEntry.AddMember(key, value, allocator);
-}
+        this->pendingMember = Target::None;
 
-std::shared_ptr<Backend::Entry> Backend::DeSerializer::DeserializePlayersSet(const rapidjson::GenericValue<rapidjson::UTF8<char>> & data)
-{
-    if(!data.HasMember(KeyPlayerNames))
+        return true;
+    }
+
+    static void AcceptString(Member<std::string> & member, ScalarKind kind, const char * string)
     {
-        throw std::exception("no member playerNames");
+        Accept(member, kind == ScalarKind::String);
+
+        if(member.valid)
+        {
+            member.value = string;
+        }
     }
 
-    if(!data[KeyPlayerNames].IsArray())
+    static void AcceptNumber(Member<unsigned int> & member, ScalarKind kind, int number)
     {
-        throw std::exception("playerNames is not array");
+        Accept(member, kind == ScalarKind::Int);
+        member.value = static_cast<unsigned int>(number);
     }
 
-    std::vector<std::string> players;
+    void FinishChange()
+    {
+        auto & changes = this->entry.changes;
 
-    for(const auto & playerName : data[KeyPlayerNames].GetArray())
+        if(!this->change.name.present)
+        {
+            ItemError(changes, "changes item does not have a name member");
+        }
+        else if(!this->change.name.valid)
+        {
+            ItemError(changes, "change member name is not a string");
+        }
+        else if(!this->change.diff.present)
+        {
+            ItemError(changes, "changes item does not have a diff member");
+        }
+        else if(!this->change.diff.valid)
+        {
+            ItemError(changes, "change member diff is not an int");
+        }
+        else
+        {
+            changes.value.emplace_back(std::move(this->change.name.value), this->change.diff.value);
+        }
+    }
+
+    void FinishEntry()
     {
-        if(!playerName.IsString())
+        if(!this->firstError.empty())
         {
-            throw std::exception("player name is not a string");
+            return;
         }
 
-        players.emplace_back(playerName.GetString());
+        try
+        {
+            this->entries.push_back(this->BuildEntry());
+        }
+        catch(const std::exception & exception)
+        {
+            this->Error(exception.what());
+        }
     }
 
-    if(!data.HasMember(KeyDealerName))
+    template<typename T>
+    static void Check(const Member<T> & member, const char * missingMessage, const char * invalidMessage)
     {
-        throw std::exception("no member dealerName");
+        if(!member.present)
+        {
+            throw std::exception(missingMessage);
+        }
+
+        if(!member.valid)
+        {
+            throw std::exception(invalidMessage);
+        }
+
+        if(!member.itemError.empty())
+        {
+            throw std::exception(member.itemError.c_str());
+        }
     }
 
-    if(!data[KeyDealerName].IsString())
+    Backend::Entry BuildEntry()
     {
-        throw std::exception("dealerName is not string");
+        Check(this->entry.kind, "missing kind in entry", "kind is not string");
+
+        const auto & kind = this->entry.kind.value;
+        if(kind == ValuePlayersSet)
+        {
+            Check(this->entry.playerNames, "no member playerNames", "playerNames is not array");
+            Check(this->entry.dealerName, "no member dealerName", "dealerName is not string");
+            Check(this->entry.sitOutScheme, "no member sitOutScheme", "sitOutScheme is not array");
+            Check(this->entry.previousDealerName, "no member previousDealerName", "previousDealerName is not string");
+
+            this->players = this->entry.playerNames.value;
+
+            return PlayersSet(std::move(this->entry.playerNames.value),
+                              std::move(this->entry.dealerName.value),
+                              std::move(this->entry.sitOutScheme.value),
+                              std::move(this->entry.previousDealerName.value));
+        }
+
+        if(kind == ValueDeal)
+        {
+            Check(this->entry.players, "no member players", "players is not int");
+            Check(this->entry.numberOfEvents, "no member numberOfEvents", "numberOfEvents is not int");
+            Check(this->entry.changes, "no member changes", "changes is not array");
+
+            // the names are resolved against the last players set
+            ChangeSet<unsigned int> changes;
+            for(const auto & [name, diff] : this->entry.changes.value)
+            {
+                changes.emplace_back(DeSerializer::PlayerPosition(this->players, name), diff);
+            }
+
+            return Deal(changes,
+                        NumberOfEvents(this->entry.numberOfEvents.value),
+                        Players(this->entry.players.value));
+        }
+
+        if(kind == ValueMandatorySoloTrigger)
+        {
+            return MandatorySoloTrigger();
+        }
+
+        throw std::exception((std::string("unknown kind value in data: \"") + kind + std::string("\"")).c_str());
     }
+};
 
-    const auto * dealer = data[KeyDealerName].GetString();
+class Backend::DeSerializer::BinaryWriter
+{
+private:
+    std::map<std::string, unsigned int> nameIndices;
+    std::vector<const std::string *> names;
+    std::vector<std::string> players;
+    std::string body;
+    unsigned int numberOfEntries{};
 
-    if(!data.HasMember(KeySitOutScheme))
+public:
+    void Write(const Backend::Entry & entry)
     {
-        throw std::exception("no member sitOutScheme");
+        entry.Visit(Overloaded {
+            [this](const PlayersSet & playersSet) { this->WritePlayersSet(playersSet); },
+            [this](const Deal & deal) { this->WriteDeal(deal); },
+            [this](const MandatorySoloTrigger & /*mandatorySoloTrigger*/) { this->body.push_back(static_cast<char>(BinaryKindMandatorySoloTrigger)); },
+        });
+
+        ++(this->numberOfEntries);
     }
 
-    if(!data[KeySitOutScheme].IsArray())
+    void Finish(std::ostream & os) const
     {
-        throw std::exception("sitOutScheme is not array");
+        std::string header(std::begin(BinaryMagic), std::end(BinaryMagic));
+        header.push_back(static_cast<char>(BinaryVersion));
+
+        WriteVarint(header, this->names.size());
+        for(const auto * name : this->names)
+        {
+            WriteVarint(header, name->size());
+            header.append(*name);
+        }
+
+        WriteVarint(header, this->numberOfEntries);
+
+        os.write(header.data(), static_cast<std::streamsize>(header.size()));
+        os.write(this->body.data(), static_cast<std::streamsize>(this->body.size()));
     }
 
+private:
+    void WritePlayersSet(const PlayersSet & playersSet)
+    {
+        this->body.push_back(static_cast<char>(BinaryKindPlayersSet));
+
+        this->players = playersSet.Players();
+        WriteVarint(this->body, this->players.size());
+        for(const auto & player : this->players)
+        {
+            this->WriteName(player);
+        }
+
+        this->WriteName(playersSet.Dealer());
 
-    std::set<unsigned int> sitOutScheme;
+        WriteBits(this->body, playersSet.SitOutScheme());
 
-    for(const auto & schemeMember : data[KeySitOutScheme].GetArray())
+        this->WriteName(playersSet.PreviousDealer());
+    }
+
+    void WriteDeal(const Deal & deal)
+    {
+        this->body.push_back(static_cast<char>(BinaryKindDeal));
+
+        WriteVarint(this->body, deal.Players().Value());
+        WriteVarint(this->body, deal.NumberOfEvents().Value());
+
+        const auto & changes = deal.Changes();
+        WriteVarint(this->body, changes.size());
+        for(const auto & change : changes)
+        {
+            this->WriteName(DeSerializer::PlayerName(this->players, change.first));
+            WriteSigned(this->body, change.second);
+        }
+    }
+
+    void WriteName(const std::string & name)
     {
-        if(!schemeMember.IsInt())
+        auto [nameIt, inserted] = this->nameIndices.try_emplace(name, static_cast<unsigned int>(this->names.size()));
+
+        if(inserted)
         {
-            throw std::exception("sit out scheme item is not an int");
+            this->names.push_back(&(nameIt->first));
         }
 
-        sitOutScheme.emplace(schemeMember.GetInt());
+        WriteVarint(this->body, nameIt->second);
     }
 
-    if(!data.HasMember(KeyPreviousDealerName))
+    static void WriteSigned(std::string & target, int value) //NOLINT(google-runtime-references)
     {
-        throw std::exception("no member previousDealerName");
+        // zigzag encoding keeps small negative values small
+        const auto bits = static_cast<unsigned int>(value);
+        WriteVarint(target, (bits << 1U) ^ (value < 0 ? std::numeric_limits<unsigned int>::max() : 0U));
     }
 
-    if(!data[KeyPreviousDealerName].IsString())
+    static void WriteBits(std::string & target, const std::set<unsigned int> & positions) //NOLINT(google-runtime-references)
     {
-        throw std::exception("previousDealerName is not string");
+        // one bit per position, as many bytes as the highest position requires
+        std::string bits(positions.empty() ? 0U : *positions.rbegin() / 8U + 1U, '\0');
+        for(const auto position : positions)
+        {
+            bits[position / 8U] = static_cast<char>(static_cast<unsigned char>(bits[position / 8U]) | (1U << (position % 8U)));
+        }
+
+        WriteVarint(target, bits.size());
+        target.append(bits);
     }
 
-    const auto * previousDealer = data[KeyPreviousDealerName].GetString();
+    static void WriteVarint(std::string & target, unsigned long long value) //NOLINT(google-runtime-int, google-runtime-references)
+    {
+        while(value >= 0x80U)
+        {
+            target.push_back(static_cast<char>((value & 0x7FU) | 0x80U));
+            value >>= 7U;
+        }
 
-    return std::make_shared<PlayersSet>(players, dealer, sitOutScheme, previousDealer);
-}
+        target.push_back(static_cast<char>(value));
+    }
+};
 
-std::shared_ptr<Backend::Entry> Backend::DeSerializer::DeserializeDeal(const rapidjson::GenericValue<rapidjson::UTF8<char>> & data)
+class Backend::DeSerializer::BinaryReader
 {
-    if(!data.HasMember(KeyPlayers))
+private:
+    std::string data;
+    size_t position{};
+    std::vector<std::string> names;
+    std::vector<unsigned int> playerNameIndices;
+
+public:
+    explicit BinaryReader(std::istream & is)
+        : data(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>())
     {
-        throw std::exception("no member players");
     }
 
-    if(!data[KeyPlayers].IsInt())
+    std::vector<Backend::Entry> Read()
     {
-        throw std::exception("players is not int");
-    }
+        if(this->data.size() < sizeof(BinaryMagic) + 1U
+                || !std::equal(std::begin(BinaryMagic), std::end(BinaryMagic), this->data.begin()))
+        {
+            throw std::exception("no valid binary header found");
+        }
 
-    unsigned int players = data[KeyPlayers].GetInt();
+        this->position = sizeof(BinaryMagic);
 
-    if(!data.HasMember(KeyNumberOfEvents))
-    {
-        throw std::exception("no member numberOfEvents");
+        if(static_cast<unsigned char>(this->data[this->position++]) != BinaryVersion)
+        {
+            throw std::exception("unsupported binary version");
+        }
+
+        const auto numberOfNames = this->ReadCount();
+        this->names.reserve(numberOfNames);
+        for(size_t index = 0; index < numberOfNames; ++index)
+        {
+            const auto length = this->ReadCount();
+            this->names.emplace_back(this->data, this->position, length);
+            this->position += length;
+        }
+
+        const auto numberOfEntries = this->ReadCount();
+        std::vector<Backend::Entry> entries;
+        entries.reserve(numberOfEntries);
+
+        for(size_t index = 0; index < numberOfEntries; ++index)
+        {
+            entries.push_back(this->ReadEntry());
+        }
+
+        if(this->position != this->data.size())
+        {
+            throw std::exception("unexpected data after binary entries");
+        }
+
+        return entries;
     }
 
-    if(!data[KeyNumberOfEvents].IsInt())
+private:
+    Backend::Entry ReadEntry()
     {
-        throw std::exception("numberOfEvents is not int");
+        const auto kind = this->ReadByte();
+
+        switch(kind)
+        {
+        case BinaryKindPlayersSet:
+            return this->ReadPlayersSet();
+        case BinaryKindDeal:
+            return this->ReadDeal();
+        case BinaryKindMandatorySoloTrigger:
+            return MandatorySoloTrigger();
+        default:
+            throw std::exception((std::string("unknown kind value in binary data: ") + std::to_string(kind)).c_str());
+        }
     }
 
-    unsigned int numberOfEvents = data[KeyNumberOfEvents].GetInt();
+    Backend::PlayersSet ReadPlayersSet()
+    {
+        const auto numberOfPlayers = this->ReadCount();
+        std::vector<std::string> players;
+        players.reserve(numberOfPlayers);
+        this->playerNameIndices.clear();
+        for(size_t index = 0; index < numberOfPlayers; ++index)
+        {
+            this->playerNameIndices.push_back(this->ReadNameIndex());
+            players.push_back(this->names[this->playerNameIndices.back()]);
+        }
+
+        auto dealer = this->ReadName();
+
+        auto sitOutScheme = this->ReadBits();
 
-    if(!data.HasMember(KeyChanges))
+        auto previousDealer = this->ReadName();
+
+        return PlayersSet(std::move(players), std::move(dealer), std::move(sitOutScheme), std::move(previousDealer));
+    }
+
+    Backend::Deal ReadDeal()
     {
-        throw std::exception("no member changes");
+        const auto players = this->ReadUnsigned();
+        const auto numberOfEvents = this->ReadUnsigned();
+
+        const auto numberOfChanges = this->ReadCount();
+        ChangeSet<unsigned int> changes;
+        for(size_t index = 0; index < numberOfChanges; ++index)
+        {
+            // the names of the players are compared by their indices
+            const auto nameIndex = this->ReadNameIndex();
+            const auto player = std::ranges::find(this->playerNameIndices, nameIndex);
+            if(player == this->playerNameIndices.end())
+            {
+                throw std::exception((std::string("found change for unknown player: \"") + this->names[nameIndex] + std::string("\"")).c_str());
+            }
+
+            changes.emplace_back(static_cast<unsigned int>(player - this->playerNameIndices.begin()), this->ReadSigned());
+        }
+
+        return Deal(std::move(changes), NumberOfEvents(numberOfEvents), Players(players));
     }
 
-    if(!data[KeyChanges].IsArray())
+    std::set<unsigned int> ReadBits()
     {
-        throw std::exception("changes is not array");
+        const auto numberOfBytes = this->ReadCount();
+        std::set<unsigned int> positions;
+        for(size_t byteIndex = 0; byteIndex < numberOfBytes; ++byteIndex)
+        {
+            const auto bits = static_cast<unsigned char>(this->data[this->position++]);
+            for(unsigned int bit = 0; bit < 8U; ++bit)
+            {
+                if((bits & (1U << bit)) != 0U)
+                {
+                    positions.insert(static_cast<unsigned int>(byteIndex) * 8U + bit);
+                }
+            }
+        }
+
+        return positions;
     }
 
-    std::vector<std::pair<std::string, int>> changes;
+    const std::string & ReadName()
+    {
+        return this->names[this->ReadNameIndex()];
+    }
 
-    for(const auto & change : data[KeyChanges].GetArray())
+    unsigned int ReadNameIndex()
     {
-        if(!change.IsObject())
+        const auto index = this->ReadUnsigned();
+
+        if(index >= this->names.size())
         {
-            throw std::exception("changes item is not an object");
+            throw std::exception("name index out of range in binary data");
         }
 
-        if(!change.HasMember(KeyChangeName))
+        return index;
+    }
+
+    unsigned int ReadUnsigned()
+    {
+        const auto value = this->ReadVarint();
+
+        if(value > std::numeric_limits<unsigned int>::max())
         {
-            throw std::exception("changes item does not have a name member");
+            throw std::exception("value out of range in binary data");
         }
 
-        if(!change[KeyChangeName].IsString())
+        return static_cast<unsigned int>(value);
+    }
+
+    int ReadSigned()
+    {
+        const auto zigzag = this->ReadUnsigned();
+        return static_cast<int>(zigzag >> 1U) ^ -static_cast<int>(zigzag & 1U);
+    }
+
+    unsigned char ReadByte()
+    {
+        this->Require(1U);
+        return static_cast<unsigned char>(this->data[this->position++]);
+    }
+
+    size_t ReadCount()
+    {
+        // every counted item takes at least one byte, which guards the allocations
+        const auto count = this->ReadVarint();
+        this->Require(count);
+        return static_cast<size_t>(count);
+    }
+
+    unsigned long long ReadVarint() //NOLINT(google-runtime-int)
+    {
+        unsigned long long value = 0U; //NOLINT(google-runtime-int)
+
+        for(unsigned int shift = 0U; shift < 64U; shift += 7U)
         {
-            throw std::exception("change member name is not a string");
+            this->Require(1U);
+            const auto byte = static_cast<unsigned char>(this->data[this->position++]);
+            value |= static_cast<unsigned long long>(byte & 0x7FU) << shift; //NOLINT(google-runtime-int)
+
+            if((byte & 0x80U) == 0U)
+            {
+                return value;
+            }
         }
 
-        std::string name = change[KeyChangeName].GetString();
+        throw std::exception("overlong number in binary data");
+    }
 
-        if(!change.HasMember(KeyChangeDiff))
+    void Require(unsigned long long count) const //NOLINT(google-runtime-int)
+    {
+        if(count > this->data.size() - this->position)
         {
-            throw std::exception("changes item does not have a diff member");
+            throw std::exception("unexpected end of binary data");
         }
+    }
+};
+
+Backend::DeSerializer::DeSerializer()
+= default;
+
+void Backend::DeSerializer::Serialize(const std::vector<Backend::Entry>& entries, std::ostream & os) //NOLINT(readability-convert-member-functions-to-static)
+{
+    rapidjson::OStreamWrapper osw(os);
+    Writer writer(osw);
+
+    writer.StartObject();
+
+    SerializeKey(KeyDataVersion, writer);
+    SerializeString(DataVersion, writer);
+
+    SerializeKey(KeyData, writer);
+    writer.StartArray();
+
+    std::vector<std::string> players;
+    for (const auto & entry : entries)
+    {
+        Backend::DeSerializer::SerializeEntry(entry, players, writer);
 
-        if(!change[KeyChangeDiff].IsInt())
+        if(entry.Kind() == Entry::Kind::PlayersSet)
         {
-            throw std::exception("change member diff is not an int");
+            players = entry.Get<PlayersSet>().Players();
         }
+    }
+
+    writer.EndArray();
+
+    writer.EndObject();
+}
+
+void Backend::DeSerializer::SerializeBinary(const std::vector<Backend::Entry>& entries, std::ostream & os) //NOLINT(readability-convert-member-functions-to-static)
+{
+    BinaryWriter writer;
+
+    for (const auto & entry : entries)
+    {
+        writer.Write(entry);
+    }
+
+    writer.Finish(os);
+}
+
+std::vector<Backend::Entry> Backend::DeSerializer::Deserialize(std::istream & is) //NOLINT(readability-convert-member-functions-to-static)
+{
+    // JSON cannot start with the first byte of the magic number
+    if(is.peek() == std::char_traits<char>::to_int_type(BinaryMagic[0]))
+    {
+        BinaryReader reader(is);
+        return reader.Read();
+    }
+
+    rapidjson::IStreamWrapper isw(is);
+
+    ReaderHandler handler(false, {});
+    rapidjson::Reader reader;
+    auto parseResult = reader.Parse(isw, handler);
+
+    return handler.Result(!parseResult.IsError());
+}
+
+void Backend::DeSerializer::SerializeSingleEntry(const Entry & entry, const std::vector<std::string> & players, std::ostream & os) //NOLINT(readability-convert-member-functions-to-static)
+{
+    rapidjson::OStreamWrapper osw(os);
+    Writer writer(osw);
+
+    Backend::DeSerializer::SerializeEntry(entry, players, writer);
+}
+
+Backend::Entry Backend::DeSerializer::DeserializeSingleEntry(std::istream & is, const std::vector<std::string> & players) //NOLINT(readability-convert-member-functions-to-static)
+{
+    rapidjson::IStreamWrapper isw(is);
+
+    ReaderHandler handler(true, players);
+    rapidjson::Reader reader;
+    auto parseResult = reader.Parse(isw, handler);
+
+    auto entries = handler.Result(!parseResult.IsError());
+
+    return std::move(entries.front());
+}
+
+std::vector<std::string> Backend::DeSerializer::PlayersBefore(const std::vector<Entry> & entries, size_t end)
+{
+    const auto last = std::find_if(entries.rend() - static_cast<std::ptrdiff_t>(end), entries.rend(), [](const Entry & entry){ return entry.Kind() == Entry::Kind::PlayersSet; });
+
+    return last != entries.rend() ? last->Get<PlayersSet>().Players() : std::vector<std::string>();
+}
+
+void Backend::DeSerializer::SerializeEntry(const Entry & entry, const std::vector<std::string> & players, Writer & writer)
+{
+    entry.Visit(Overloaded {
+        [&writer](const PlayersSet & playersSet) { Backend::DeSerializer::SerializePlayersSet(playersSet, writer); },
+        [&players, &writer](const Deal & deal) { Backend::DeSerializer::SerializeDeal(deal, players, writer); },
+        [&writer](const MandatorySoloTrigger & /*mandatorySoloTrigger*/) { Backend::DeSerializer::SerializeMandatorySoloTrigger(writer); },
+    });
+}
+
+void Backend::DeSerializer::SerializePlayersSet(const PlayersSet & playersSet, Writer & writer)
+{
+    writer.StartObject();
+
+    SerializeKey(KeyKind, writer);
+    SerializeString(ValuePlayersSet, writer);
+
+    SerializeKey(KeyPlayerNames, writer);
+    writer.StartArray();
+    for (const auto & playerName : playersSet.Players())
+    {
+        SerializeString(playerName, writer);
+    }
+    writer.EndArray();
+
+    SerializeKey(KeyDealerName, writer);
+    SerializeString(playersSet.Dealer(), writer);
+
+    SerializeKey(KeySitOutScheme, writer);
+    writer.StartArray();
+    for (const auto & sitOutItem : playersSet.SitOutScheme())
+    {
+        writer.Uint(sitOutItem);
+    }
+    writer.EndArray();
+
+    SerializeKey(KeyPreviousDealerName, writer);
+    SerializeString(playersSet.PreviousDealer(), writer);
+
+    writer.EndObject();
+}
+
+void Backend::DeSerializer::SerializeDeal(const Deal & deal, const std::vector<std::string> & players, Writer & writer)
+{
+    writer.StartObject();
+
+    SerializeKey(KeyKind, writer);
+    SerializeString(ValueDeal, writer);
+
+    SerializeKey(KeyPlayers, writer);
+    writer.Uint(deal.Players().Value());
+
+    SerializeKey(KeyNumberOfEvents, writer);
+    writer.Uint(deal.NumberOfEvents().Value());
+
+    SerializeKey(KeyChanges, writer);
+    writer.StartArray();
+    for (const auto & change : deal.Changes())
+    {
+        writer.StartObject();
+
+        SerializeKey(KeyChangeName, writer);
+        SerializeString(PlayerName(players, change.first), writer);
+
+        SerializeKey(KeyChangeDiff, writer);
+        writer.Int(change.second);
+
+        writer.EndObject();
+    }
+    writer.EndArray();
+
+    writer.EndObject();
+}
 
-        int diff = change[KeyChangeDiff].GetInt();
+void Backend::DeSerializer::SerializeMandatorySoloTrigger(Writer & writer)
+{
+    writer.StartObject();
+
+    SerializeKey(KeyKind, writer);
+    SerializeString(ValueMandatorySoloTrigger, writer);
+
+    writer.EndObject();
+}
+
+void Backend::DeSerializer::SerializeKey(const char * key, Writer & writer)
+{
+    writer.Key(key, static_cast<rapidjson::SizeType>(strlen(key)));
+}
+
+void Backend::DeSerializer::SerializeString(const char * string, Writer & writer)
+{
+    writer.String(string, static_cast<rapidjson::SizeType>(strlen(string)));
+}
+
+void Backend::DeSerializer::SerializeString(const std::string & string, Writer & writer)
+{
+    SerializeString(string.c_str(), writer);
+}
+
+const std::string & Backend::DeSerializer::PlayerName(const std::vector<std::string> & players, unsigned int position)
+{
+    if(position >= players.size())
+    {
+        throw std::exception("found change for a position not in the players set");
+    }
 
-        changes.emplace_back(name, diff);
+    return players[position];
+}
+
+unsigned int Backend::DeSerializer::PlayerPosition(const std::vector<std::string> & players, const std::string & name)
+{
+    auto player = std::ranges::find(players, name);
+
+    if(player == players.end())
+    {
+        throw std::exception((std::string("found change for unknown player: \"") + name + std::string("\"")).c_str());
     }
 
-    return std::make_shared<Deal>(changes, NumberOfEvents(numberOfEvents), Players(players));
+    return static_cast<unsigned int>(player - players.begin());
 }
 
 #undef DATAVERSION
@@ -20,8 +20,10 @@
 #include "entry.h"
 #include "mandatorysolotrigger.h"
 #include "playersset.h"
-#include "rapidjson/document.h"
+#include "rapidjson/ostreamwrapper.h"
+#include "rapidjson/writer.h"
 #include <iostream>
+#include <string>
 #include <vector>
 
 #ifndef DESERIALIZER_H
@@ -55,7 +57,22 @@ namespace Backend
         constexpr static const char * const KeyChangeName = "name";
         constexpr static const char * const KeyChangeDiff = "diff";
 
+        constexpr static const char BinaryMagic[] = { '\x89', 'Q', 'D', 'K' }; //NOLINT(cppcoreguidelines-avoid-c-arrays, hicpp-avoid-c-arrays, modernize-avoid-c-arrays)
+        constexpr static const unsigned char BinaryVersion = 1U;
+        constexpr static const unsigned char BinaryKindPlayersSet = 0U;
+        constexpr static const unsigned char BinaryKindDeal = 1U;
+        constexpr static const unsigned char BinaryKindMandatorySoloTrigger = 2U;
+
     public:
+        /*!
+         * \brief The Format enum lists the formats entries can be serialized to.
+         */
+        enum class Format
+        {
+            Json,
+            Binary,
+        };
+
         /*!
          * \brief Initializes a new instance.
          */
@@ -66,30 +83,76 @@ namespace Backend
          * \param entries The entries to serialize.
          * \param wos The stream to serialize into.
          */
-        void Serialize(const std::vector<std::shared_ptr<Entry>> & entries, std::ostream & os);
+        void Serialize(const std::vector<Entry> & entries, std::ostream & os);
+
+        /*!
+         * \brief Serialize the entries into the stream in the compact binary format,
+         *        which stores each name once and refers to it by index.
+         * \param entries The entries to serialize.
+         * \param os The stream to serialize into, which should be opened in binary mode.
+         */
+        void SerializeBinary(const std::vector<Entry> & entries, std::ostream & os);
 
         /*!
          * \brief Deserialize from the stream into the return value.
+         *        The format, JSON or binary, is detected from the first byte.
          * \param wis The stream to deserialize from.
          * \return The deserialized entries.
          */
-        std::vector<std::shared_ptr<Entry>> Deserialize(std::istream & is);
+        std::vector<Entry> Deserialize(std::istream & is);
+
+        /*!
+         * \brief Serialize a single entry into the stream as a JSON object, without the enclosing document.
+         * \param entry The entry to serialize.
+         * \param players The names of the players in the last players set before the entry, by which deals are resolved.
+         * \param os The stream to serialize into.
+         */
+        void SerializeSingleEntry(const Entry & entry, const std::vector<std::string> & players, std::ostream & os);
+
+        /*!
+         * \brief Deserialize a single entry, as written by SerializeSingleEntry, from the stream.
+         * \param is The stream to deserialize from.
+         * \param players The names of the players in the last players set before the entry, by which deals are resolved.
+         * \return The deserialized entry.
+         */
+        Entry DeserializeSingleEntry(std::istream & is, const std::vector<std::string> & players);
+
+        /*!
+         * \brief Gets the names of the players in the last players set before the given end, which deals refer to by position.
+         * \param entries The entries to search.
+         * \param end The index after the last entry searched.
+         * \return The names of the players or an empty list, if there is no players set.
+         */
+        static std::vector<std::string> PlayersBefore(const std::vector<Entry> & entries, size_t end);
 
     private:
-        static void SerializeEntry(const std::shared_ptr<Entry> & entry,
-                            rapidjson::GenericValue<rapidjson::UTF8<char>> & serializedEntry, //NOLINT (google-runtime-references)
-                            rapidjson::MemoryPoolAllocator<rapidjson::CrtAllocator> & allocator); //NOLINT (google-runtime-references)
-        static void SerializePlayersSet(const std::shared_ptr<Backend::PlayersSet> & playersSet,
-                                 rapidjson::GenericValue<rapidjson::UTF8<char>> & serializedEntry, //NOLINT (google-runtime-references)
-                                 rapidjson::MemoryPoolAllocator<rapidjson::CrtAllocator> & allocator); //NOLINT (google-runtime-references)
-        static void SerializeDeal(const std::shared_ptr<Backend::Deal>& deal,
-                           rapidjson::GenericValue<rapidjson::UTF8<char>> & serializedEntry, //NOLINT (google-runtime-references)
-                           rapidjson::MemoryPoolAllocator<rapidjson::CrtAllocator> & allocator); //NOLINT (google-runtime-references)
-        static void SerializeMandatorySoloTrigger(rapidjson::GenericValue<rapidjson::UTF8<char>> & serializedEntry, //NOLINT (google-runtime-references)
-                                           rapidjson::MemoryPoolAllocator<rapidjson::CrtAllocator> & allocator); //NOLINT (google-runtime-references)
-
-        static std::shared_ptr<Entry> DeserializePlayersSet(const rapidjson::GenericValue<rapidjson::UTF8<char>> & data);
-        static std::shared_ptr<Entry> DeserializeDeal(const rapidjson::GenericValue<rapidjson::UTF8<char>> & data);
+        using Writer = rapidjson::Writer<rapidjson::OStreamWrapper, rapidjson::UTF8<char>, rapidjson::ASCII<char>>;
+
+        static void SerializeEntry(const Entry & entry, const std::vector<std::string> & players, Writer & writer); //NOLINT (google-runtime-references)
+        static void SerializePlayersSet(const Backend::PlayersSet & playersSet, Writer & writer); //NOLINT (google-runtime-references)
+        static void SerializeDeal(const Backend::Deal & deal, const std::vector<std::string> & players, Writer & writer); //NOLINT (google-runtime-references)
+        static void SerializeMandatorySoloTrigger(Writer & writer); //NOLINT (google-runtime-references)
+        static void SerializeKey(const char * key, Writer & writer); //NOLINT (google-runtime-references)
+        static void SerializeString(const char * string, Writer & writer); //NOLINT (google-runtime-references)
+        static void SerializeString(const std::string & string, Writer & writer); //NOLINT (google-runtime-references)
+        static const std::string & PlayerName(const std::vector<std::string> & players, unsigned int position);
+        static unsigned int PlayerPosition(const std::vector<std::string> & players, const std::string & name);
+
+        /*!
+         * \brief The ReaderHandler class builds entries directly from the
+         *        events of a rapidjson::Reader, without an intermediate document.
+         */
+        class ReaderHandler;
+
+        /*!
+         * \brief The BinaryWriter class encodes entries into the binary format.
+         */
+        class BinaryWriter;
+
+        /*!
+         * \brief The BinaryReader class decodes entries from the binary format.
+         */
+        class BinaryReader;
     };
 }
 
@@ -20,20 +20,29 @@
 #include <filesystem>
 #include <fstream>
 
-Backend::DiskRepository::DiskRepository()
-= default;
+Backend::DiskRepository::DiskRepository(Backend::DeSerializer::Format format)
+    : format(format)
+{
+}
 
-void Backend::DiskRepository::Save(const std::vector<std::shared_ptr<Backend::Entry>> & entries, const std::u8string & identifier)
+void Backend::DiskRepository::Save(const std::vector<Backend::Entry> & entries, const std::u8string & identifier)
 {
     std::filesystem::path path = std::filesystem::path(identifier);
-    std::ofstream ofs(path);
+    std::ofstream ofs(path, std::ios::out | std::ios::binary);
 
     if(!(ofs.is_open() && ofs.good()))
     {
         throw std::exception((std::string("unable to open stream for writing \"") + path.string() + std::string("\"")).c_str());
     }
 
-    deserializer.Serialize(entries, ofs);
+    if(this->format == Backend::DeSerializer::Format::Binary)
+    {
+        deserializer.SerializeBinary(entries, ofs);
+    }
+    else
+    {
+        deserializer.Serialize(entries, ofs);
+    }
 
     if(!(ofs.is_open() && ofs.good()))
     {
@@ -43,7 +52,7 @@ void Backend::DiskRepository::Save(const std::vector<std::shared_ptr<Backend::En
     ofs.close();
 }
 
-std::vector<std::shared_ptr<Backend::Entry>> Backend::DiskRepository::Load(const std::u8string & identifier)
+std::vector<Backend::Entry> Backend::DiskRepository::Load(const std::u8string & identifier)
 {
     std::filesystem::path path = std::filesystem::path(identifier);
     if(!std::filesystem::exists(path))
@@ -55,7 +64,7 @@ std::vector<std::shared_ptr<Backend::Entry>> Backend::DiskRepository::Load(const
 
     try
     {
-        ifs.open(path);
+        ifs.open(path, std::ios::in | std::ios::binary);
     }
     catch (const std::exception& exception)
     {
@@ -27,22 +27,24 @@ namespace Backend
     {
     private:
         Backend::DeSerializer deserializer;
+        const Backend::DeSerializer::Format format;
 
     public:
         /*!
          * \brief Initializes a new instance.
+         * \param format The format used for saving. Loading accepts all formats.
          */
-        DiskRepository();
+        explicit DiskRepository(Backend::DeSerializer::Format format = Backend::DeSerializer::Format::Json);
 
         /*!
          * \reimp
          */
-        void Save(const std::vector<std::shared_ptr<Backend::Entry>> & entries, const std::u8string & identifier) override;
+        void Save(const std::vector<Backend::Entry> & entries, const std::u8string & identifier) override;
 
         /*!
          * \reimp
          */
-        std::vector<std::shared_ptr<Backend::Entry>> Load(const std::u8string & identifier) override;
+        std::vector<Backend::Entry> Load(const std::u8string & identifier) override;
     };
 }
 
@@ -16,21 +16,27 @@
  *
  */
 
+#include "deal.h"
+#include "mandatorysolotrigger.h"
+#include "playersset.h"
+#include <utility>
+#include <variant>
+
 #ifndef ENTRY_H
 #define ENTRY_H
 
 namespace Backend
 {
     /*!
-     * \brief The Entry class represents a common base
-     *        for entries in the game info.
+     * \brief The Entry class holds one of the entries in the game info by value,
+     *        so that a collection of entries is stored contiguously.
      */
     class Entry
     {
     public:
         /*!
          * \brief The Kind enumeration represents
-         *        the type of the entry.
+         *        the type of the entry, in the order of the alternatives held.
          */
         enum class Kind
         {
@@ -39,13 +45,86 @@ namespace Backend
             MandatorySoloTrigger,
         };
 
+    private:
+        std::variant<PlayersSet, Deal, MandatorySoloTrigger> value;
+
     public:
+        /*!
+         * \brief Initializes a new instance holding a players set.
+         * \param playersSet The players set to hold.
+         */
+        Entry(PlayersSet playersSet) //NOLINT(google-explicit-constructor, hicpp-explicit-conversions)
+            : value(std::move(playersSet))
+        {
+        }
+
+        /*!
+         * \brief Initializes a new instance holding a deal.
+         * \param deal The deal to hold.
+         */
+        Entry(Deal deal) //NOLINT(google-explicit-constructor, hicpp-explicit-conversions)
+            : value(std::move(deal))
+        {
+        }
+
+        /*!
+         * \brief Initializes a new instance holding the trigger of a mandatory solo round.
+         * \param mandatorySoloTrigger The trigger to hold.
+         */
+        Entry(MandatorySoloTrigger mandatorySoloTrigger) //NOLINT(google-explicit-constructor, hicpp-explicit-conversions)
+            : value(mandatorySoloTrigger)
+        {
+        }
+
         /*!
          * \brief Gets the kind of the entry.
          * \return The kind of the entry.
          */
-        [[nodiscard]] virtual enum Kind Kind() const = 0;
+        [[nodiscard]] enum Kind Kind() const
+        {
+            return static_cast<enum Kind>(this->value.index());
+        }
+
+        /*!
+         * \brief Gets the held entry, which must be of the given type.
+         * \return The held entry.
+         */
+        template<typename T>
+        [[nodiscard]] const T& Get() const
+        {
+            return std::get<T>(this->value);
+        }
+
+        /*!
+         * \brief Compares the entry with another one.
+         * \param other The entry to compare with.
+         * \return A value indicating whether both entries are of the same kind and equal.
+         */
+        [[nodiscard]] bool operator==(const Entry& other) const = default;
+
+        /*!
+         * \brief Calls the visitor with the held entry.
+         * \param visitor The visitor, which must accept each type of entry.
+         * \return The result of the visitor.
+         */
+        template<typename Visitor>
+        decltype(auto) Visit(Visitor&& visitor) const
+        {
+            return std::visit(std::forward<Visitor>(visitor), this->value);
+        }
+    };
+
+    /*!
+     * Helper template to combine lambdas into a visitor of entries.
+     */
+    template<typename... Ts>
+    struct Overloaded : Ts...
+    {
+        using Ts::operator()...;
     };
+
+    template<typename... Ts>
+    Overloaded(Ts...) -> Overloaded<Ts...>;
 }
 
 #endif // ENTRY_H
@@ -27,7 +27,7 @@ namespace Backend
     template<typename T>
     class NamedNumber
     {
-        const T value;
+        T value;
     public:
         /*!
          * \brief Initializes a new instance.
@@ -0,0 +1,82 @@
+/*
+ * This file is part of QtDoppelKopf.
+ *
+ * QtDoppelKopf is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtDoppelKopf is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtDoppelKopf.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef GAMEDELTA_H
+#define GAMEDELTA_H
+
+#include <vector>
+
+namespace Backend
+{
+    /*!
+     * \brief The GameDelta struct describes what a single mutation of a game changed,
+     *        so that observers only need to update the affected parts.
+     */
+    struct GameDelta
+    {
+        /*!
+         * \brief The History enum lists the possible changes of the score history:
+         *        Unchanged,
+         *        a deal was appended,
+         *        the last deal was removed,
+         *        the history was replaced completely, e.g. by loading.
+         */
+        enum class History
+        {
+            Unchanged,
+            Appended,
+            Removed,
+            Replaced
+        };
+
+        /*!
+         * \brief A value indicating whether the listed players, their order or their presence changed,
+         *        in which case the positions of the players are no longer valid.
+         */
+        bool playersChanged{};
+
+        /*!
+         * \brief The positions within the player infos of the players whose scores and statistics changed.
+         */
+        std::vector<unsigned int> changedPlayers{};
+
+        /*!
+         * \brief A value indicating whether the due balances changed.
+         */
+        bool standingsChanged{};
+
+        /*!
+         * \brief A value indicating whether the dealer and with it the players sitting out changed.
+         */
+        bool dealerChanged{};
+
+        /*!
+         * \brief A value indicating whether the multiplier preview or the state of the mandatory solo changed.
+         */
+        bool multiplierChanged{};
+
+        /*!
+         * \brief The change of the score history.
+         */
+        History history{ History::Unchanged };
+
+        bool operator==(const GameDelta& other) const = default;
+    };
+}
+
+#endif // GAMEDELTA_H
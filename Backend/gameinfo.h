@@ -19,28 +19,44 @@
 #ifndef GAMEINFO_H
 #define GAMEINFO_H
 
+#include "cashcalculation.h"
+#include "changeset.h"
 #include "deal.h"
 #include "diskrepository.h"
 #include "entry.h"
+#include "eventinfo.h"
+#include "gamedelta.h"
+#include "houserules.h"
 #include "mandatorysolotrigger.h"
 #include "multiplierinfo.h"
 #include "playerinfo.h"
 #include "playersset.h"
 #include "repository.h"
+#include "scoretable.h"
+#include <algorithm>
+#include <functional>
 #include <map>
 #include <memory>
+#include <numeric>
+#include <optional>
+#include <ranges>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace Backend
 {
     /*!
-     * \brief The GameInfo class represents the current state of the game
+     * \brief The BasicGameInfo class represents the current state of the game
      *        and provides access to information concerning each player.
+     * \tparam Rules The house rules, which define the deals, the multipliers and the cash.
      */
-    class GameInfo
+    template<HouseRulesPolicy Rules>
+    class BasicGameInfo
     {
+        static_assert(Rules::PlayersPerDeal <= ChangeSet<unsigned int>::Capacity, "a deal must fit into a change set");
+
     public:
         /*!
          * \brief The MandatorySoloRound enum lists possible states
@@ -72,28 +88,155 @@ namespace Backend
             MandatorySoloTrigger,
         };
 
+        /*!
+         * \brief The Round struct holds the range of deals of a completed round,
+         *        in which each present player has dealt once.
+         *        The totals of each player in the round are given by PlayerInfo::StatisticsInRange.
+         */
+        struct Round
+        {
+            unsigned int firstDeal{};
+            unsigned int endDeal{};
+
+            bool operator==(const Round& other) const = default;
+        };
+
     private:
         class PlayerInfoInternal;
+
+        /*!
+         * \brief The EntryLog class holds the entries together with the positions
+         *        of the players set and deal entries, so that queries do not need to scan.
+         */
+        class EntryLog
+        {
+        private:
+            std::vector<Entry> entries;
+            std::vector<size_t> playersSetPositions;
+            std::vector<size_t> dealPositions;
+            EntryRevision revision = EntryRevision::New();
+
+        public:
+            /*!
+             * \brief Appends an entry.
+             * \param entry The entry to append.
+             */
+            void Push(Entry entry);
+
+            /*!
+             * \brief Removes the last entry, which must exist.
+             * \return The removed entry.
+             */
+            Entry Pop();
+
+            /*!
+             * \brief Gets all entries.
+             * \return All entries.
+             */
+            [[nodiscard]] const std::vector<Entry>& Entries() const;
+
+            /*!
+             * \brief Gets the revision, which counts the entries popped.
+             * \return The revision.
+             */
+            [[nodiscard]] const EntryRevision& Revision() const;
+
+            /*!
+             * \brief Gets the number of entries.
+             * \return The number of entries.
+             */
+            [[nodiscard]] size_t Size() const;
+
+            /*!
+             * \brief Gets the last entry, which must exist.
+             * \return The last entry.
+             */
+            [[nodiscard]] const Entry& Back() const;
+
+            /*!
+             * \brief Gets the number of players set entries.
+             * \return The number of players set entries.
+             */
+            [[nodiscard]] unsigned int NumberOfPlayersSets() const;
+
+            /*!
+             * \brief Gets the number of deal entries.
+             * \return The number of deal entries.
+             */
+            [[nodiscard]] unsigned int NumberOfDeals() const;
+
+            /*!
+             * \brief Gets the last players set entry.
+             * \return The last players set entry or nullptr.
+             */
+            [[nodiscard]] const PlayersSet* LastPlayersSet() const;
+
+            /*!
+             * \brief Gets the last deal entry.
+             * \return The last deal entry or nullptr.
+             */
+            [[nodiscard]] const Deal* LastDeal() const;
+        };
+
+        /*!
+         * \brief The Standings struct holds the values derived from the current scores of all players,
+         *        which are recomputed once after each change instead of on every query.
+         */
+        struct Standings
+        {
+            int maximumCurrentScore{};
+            unsigned int totalCashCents{};
+            unsigned int absentPlayerCashCents{};
+
+            bool operator==(const Standings& other) const = default;
+        };
+
+        /*!
+         * \brief The DeltaSnapshot struct holds the values compared before and after a mutation
+         *        to derive the delta reported to the observer.
+         */
+        struct DeltaSnapshot
+        {
+            unsigned int dealerIndex{};
+            std::vector<unsigned int> multiplierPreview;
+            bool isMandatorySolo{};
+            size_t deals{};
+            Standings standings;
+        };
+
         const unsigned int MaxPlayers;
         std::vector<std::shared_ptr<PlayerInfoInternal>> playerInfos;
-        std::map<std::string, std::shared_ptr<PlayerInfoInternal>> nameToPlayerInfo;
+        std::vector<std::shared_ptr<PlayerInfoInternal>> playerInfosById;
+        std::map<std::string, unsigned int> nameToPlayerId;
         unsigned int numberOfPresentPlayers{};
         unsigned int initialDealerIndex{};
         unsigned int currentDealerIndex{};
         std::set<unsigned int> sitOutScheme;
-        MultiplierInfo multiplierInfo;
+        std::vector<bool> sittingOutByOffset;
+        BasicMultiplierInfo<Rules> multiplierInfo;
 
         std::shared_ptr<Repository> repository;
-        std::vector<std::shared_ptr<Entry>> entries;
+        EntryLog entryLog;
+        ScoreTable scoreTable;
+        std::vector<Round> completedRounds;
+        Standings standings;
+        std::function<void(const GameDelta&)> observer;
 
     public:
         /*!
          * \brief Initializes a new instance.
          * \param repository The repository to be used for permanent storage.
-         * \param maxPlayers The maximum number of players that will be kept in this instance.
+         * \param maxPlayers The number of members of the group, of which those not listed pay the share of an absent player.
+         *                   It does not limit the number of players at the table.
+         */
+        explicit BasicGameInfo(std::shared_ptr<Repository> repository = std::make_shared<DiskRepository>(),
+                               const unsigned int maxPlayers = 8U); //NOLINT(readability-avoid-const-params-in-decls)
+
+        /*!
+         * \brief Sets the function to be notified with the delta of each mutation of the game.
+         * \param newObserver The function to notify, or an empty function to stop notifying.
          */
-        explicit GameInfo(std::shared_ptr<Repository> repository = std::make_shared<DiskRepository>(),
-                 const unsigned int maxPlayers = 8U); //NOLINT(readability-avoid-const-params-in-decls)
+        void SetObserver(std::function<void(const GameDelta&)> newObserver);
 
         /*!
          * \brief Provides access to the player information.
@@ -101,6 +244,15 @@ namespace Backend
          */
         [[nodiscard]] std::vector<std::shared_ptr<PlayerInfo>> PlayerInfos() const;
 
+        /*!
+         * \brief Provides access to the player information without copying the shared pointers.
+         * \return A random access range over the player information, valid until the players change.
+         */
+        [[nodiscard]] auto PlayerInfosView() const
+        {
+            return this->playerInfos | std::views::transform([](const std::shared_ptr<PlayerInfoInternal>& playerInfo) -> const PlayerInfo& { return *playerInfo; });
+        }
+
         /*!
          * \brief Indicates the current dealer, if set.
          * \return A player info about the current dealer or nullptr.
@@ -201,18 +353,48 @@ namespace Backend
          */
         [[nodiscard]] unsigned int RemainingGamesInRound() const;
 
+        /*!
+         * \brief Gets the number of deals recorded, which bounds the ranges for the statistics of the players.
+         * \return The number of deals recorded.
+         */
+        [[nodiscard]] unsigned int DealsRecorded() const;
+
+        /*!
+         * \brief Gets the completed rounds in the order they were played.
+         * \return The completed rounds.
+         */
+        [[nodiscard]] const std::vector<Round>& CompletedRounds() const;
+
+        /*!
+         * \brief Gets the due balance of a player for a completed round in Euro cents,
+         *        which is based on the difference to the best result in that round.
+         * \param round The completed round.
+         * \param playerInfo The player to settle.
+         * \return The due balance of the player for the round in Euro cents.
+         */
+        [[nodiscard]] unsigned int RoundCashCents(const Round& round, const PlayerInfo& playerInfo) const;
+
     private:
-        void SetPlayersInternal(const std::shared_ptr<PlayersSet>& playersSet);
+        void SetPlayersInternal(const PlayersSet& playersSet);
         void SortAndSetPlayerInfos(const std::vector<std::string>& players);
+        std::shared_ptr<PlayerInfoInternal> CreatePlayerInfo(const std::string& name, unsigned int id);
+        [[nodiscard]] ChangeSet<unsigned int> ToPositionChanges(const std::vector<std::pair<std::string, int>>& changes) const;
+        [[nodiscard]] ChangeSet<unsigned int> ToPlayerIdChanges(const ChangeSet<unsigned int>& changes) const;
         void SetDealer(const std::string& dealer);
         void SetAndApplyScheme(const std::set<unsigned int>& newScheme);
+        void UpdateSittingOutByOffset();
         void ApplyScheme();
-        void PushDealInternal(const std::shared_ptr<Deal>& deal);
-        std::vector<std::pair<std::string, int>> AutoCompleteDeal(std::vector<std::pair<std::string, int>> inputChanges);
-        [[nodiscard]] static std::string FindSoloPlayer(const std::vector<std::pair<std::string, int>>& changes);
+        void TriggerMandatorySoloInternal();
+        void PushDealInternal(const ChangeSet<unsigned int>& changes, NumberOfEvents numberOfEvents);
+        ChangeSet<unsigned int> AutoCompleteDeal(const ChangeSet<unsigned int>& inputChanges);
+        [[nodiscard]] static std::optional<unsigned int> FindSoloPlayer(const ChangeSet<unsigned int>& changes);
         [[nodiscard]] int MaximumCurrentScore() const;
-        void ReconstructEventsForMultiplierInfo();
-        [[nodiscard]] unsigned int DealsRecorded() const;
+        void UpdateStandings();
+        void ApplyEntries(std::vector<Entry> entries);
+        void TakeStateFrom(BasicGameInfo& other); //NOLINT (google-runtime-references)
+        [[nodiscard]] std::optional<DeltaSnapshot> TakeDeltaSnapshot() const;
+        [[nodiscard]] std::vector<unsigned int> PositionsOfPlayersInDeal(size_t deal) const;
+        void NotifyObserver(const std::optional<DeltaSnapshot>& before, GameDelta delta) const;
 
     private:
         class PlayerInfoInternal : public PlayerInfo
@@ -221,12 +403,18 @@ namespace Backend
             /*!
              * \brief Initializes a new instance from the given name.
              * \param The unique name of the player.
-             * \param multiplierAccessor A function to obtain the multiplier for the indexed game.
-             * \param maxCurrentScoreAccessor A function to obtain the maximum current score among the players.
+             * \param scoreTable The score table holding the results of the player.
+             * \param id The dense index of the player within the game, which is its column in the score table.
              */
             PlayerInfoInternal(std::string name,
-                               std::function<unsigned short(unsigned int)> multiplierAccessor, //NOLINT(google-runtime-int)
-                               std::function<int()> maxCurrentScoreAccessor);
+                               const ScoreTable& scoreTable,
+                               unsigned int id);
+
+            /*!
+             * \brief Gets the dense index of the player within the game, which replaces the name internally.
+             * \return The dense index of the player within the game.
+             */
+            [[nodiscard]] unsigned int Id() const;
 
             /*!
              * \brief Sets a value indicating whether the player has participated in any deal.
@@ -247,31 +435,967 @@ namespace Backend
             void SetIsPlaying(bool isPlaying);
 
             /*!
-             * \brief Adds a result of a deal to the player.
-             * \param hasPlayedInDeal Value indicating whether the player played in the deal.
-             * \param unmultipliedScore The change in score to push.
-             * \param playedSolo Value indicating whether the player played solo.
+             * \brief Sets the due balance in Euro cent.
+             * \param cashCents The due balance in Euro cent.
              */
-            void PushDealResult(bool hasPlayedInDeal, int unmultipliedScore, bool playedSolo);
+            void SetCashCents(unsigned int cashCents);
 
             /*!
-             * \brief Removes the last deal result from the collection.
+             * \brief Takes the state and the index of another instance, keeping the name and the score table.
+             * \param other The instance to take the state from.
              */
-            void PopLastDealResult();
+            void TakeStateFrom(const PlayerInfoInternal& other);
 
             /*!
-             * \brief Sets the input in the last deal, if any.
-             * \param input The input in the last deal, if any.
+             * \brief Detaches the player, who is no longer part of the game.
              */
-            void SetInputInDeal(const std::string& input);
-
-            /*!
-             * \brief Gets the number of recorded deals for this player.
-             * \return The number of records.
-             */
-            [[nodiscard]] size_t NumberOfRecordedDeals() const;
+            using PlayerInfo::Detach;
         };
     };
+
+    template<HouseRulesPolicy Rules>
+    BasicGameInfo<Rules>::BasicGameInfo(std::shared_ptr<Repository> repository, const unsigned int maxPlayers)
+        : MaxPlayers(maxPlayers),
+          repository(std::move(repository))
+    {
+    }
+
+    template<HouseRulesPolicy Rules>
+    void BasicGameInfo<Rules>::SetObserver(std::function<void(const GameDelta&)> newObserver)
+    {
+        this->observer = std::move(newObserver);
+    }
+
+    template<HouseRulesPolicy Rules>
+    std::vector<std::shared_ptr<PlayerInfo>> BasicGameInfo<Rules>::PlayerInfos() const
+    {
+        return { this->playerInfos.begin(), this->playerInfos.end() };
+    }
+
+    template<HouseRulesPolicy Rules>
+    std::shared_ptr<PlayerInfo> BasicGameInfo<Rules>::Dealer() const
+    {
+        return !this->playerInfos.empty() ? this->playerInfos[this->currentDealerIndex] : nullptr;
+    }
+
+    template<HouseRulesPolicy Rules>
+    std::set<unsigned int> BasicGameInfo<Rules>::SitOutScheme() const
+    {
+        return this->sitOutScheme;
+    }
+
+    template<HouseRulesPolicy Rules>
+    void BasicGameInfo<Rules>::SetPlayers(const std::vector<std::string>& players,
+                                          const std::string& dealer,
+                                          const std::set<unsigned int>& sitOutScheme)
+    {
+        std::string previousDealer = this->Dealer() != nullptr ? this->Dealer()->Name() : "";
+        PlayersSet entry(players, dealer, sitOutScheme, previousDealer);
+        auto before = this->TakeDeltaSnapshot();
+
+        this->SetPlayersInternal(entry);
+
+        // first entry must be PlayersSet and is thus replaced
+        if(this->entryLog.Size() == 1)
+        {
+            this->entryLog.Pop();
+        }
+
+        this->entryLog.Push(std::move(entry));
+
+        this->UpdateStandings();
+
+        this->NotifyObserver(before, GameDelta { .playersChanged = true });
+    }
+
+    template<HouseRulesPolicy Rules>
+    void BasicGameInfo<Rules>::PushDeal(const std::vector<std::pair<std::string, int>>& changes,
+                                        unsigned int numberOfEvents)
+    {
+        // the names are resolved once, the entry keeps the positions of the players in the players set
+        Deal entry(this->ToPositionChanges(changes), NumberOfEvents(numberOfEvents), Players(this->numberOfPresentPlayers));
+        auto before = this->TakeDeltaSnapshot();
+
+        this->PushDealInternal(this->ToPlayerIdChanges(entry.Changes()), entry.NumberOfEvents());
+
+        this->entryLog.Push(std::move(entry));
+
+        this->UpdateStandings();
+
+        if(before.has_value())
+        {
+            this->NotifyObserver(before, GameDelta { .changedPlayers = this->PositionsOfPlayersInDeal(this->scoreTable.Rows() - 1) });
+        }
+    }
+
+    template<HouseRulesPolicy Rules>
+    void BasicGameInfo<Rules>::TriggerMandatorySolo()
+    {
+        auto before = this->TakeDeltaSnapshot();
+
+        this->TriggerMandatorySoloInternal();
+
+        this->entryLog.Push(MandatorySoloTrigger());
+
+        this->NotifyObserver(before, GameDelta {});
+    }
+
+    template<HouseRulesPolicy Rules>
+    typename BasicGameInfo<Rules>::PoppableEntry BasicGameInfo<Rules>::LastPoppableEntry() const
+    {
+        if(this->entryLog.Size() < 2)
+        {
+            return PoppableEntry::None;
+        }
+
+        switch(this->entryLog.Back().Kind())
+        {
+        case Backend::Entry::Kind::PlayersSet:
+            return PoppableEntry::PlayersSet;
+        case Backend::Entry::Kind::Deal:
+            return PoppableEntry::Deal;
+        case Backend::Entry::Kind::MandatorySoloTrigger:
+            return PoppableEntry::MandatorySoloTrigger;
+        default:
+            throw std::exception("value of Entry::Kind not handled");
+        }
+    }
+
+    template<HouseRulesPolicy Rules>
+    void BasicGameInfo<Rules>::PopLastEntry()
+    {
+        if(this->LastPoppableEntry() == PoppableEntry::None)
+        {
+            return;
+        }
+
+        auto before = this->TakeDeltaSnapshot();
+        GameDelta delta;
+
+        Entry entry = this->entryLog.Pop();
+
+        if(entry.Kind() == Entry::Kind::PlayersSet)
+        {
+            delta.playersChanged = true;
+
+            auto lastPlayerSetEntry = this->entryLog.LastPlayersSet();
+
+            if(lastPlayerSetEntry == nullptr)
+            {
+                throw std::exception("must never happen 1");
+            }
+
+            this->SetPlayersInternal(*lastPlayerSetEntry);
+
+            this->SetDealer(entry.Get<PlayersSet>().PreviousDealer());
+
+            auto relevantInitialDealerName = lastPlayerSetEntry->Dealer();
+            auto relevantInitialDealerInfo = std::ranges::find_if(this->playerInfos, [&relevantInitialDealerName](const std::shared_ptr<PlayerInfoInternal>& playerInfo) { return playerInfo->Name() == relevantInitialDealerName; });
+            if(relevantInitialDealerInfo == this->playerInfos.end())
+            {
+                throw std::exception("must never happen 3");
+            }
+
+            this->initialDealerIndex = static_cast<unsigned int>(relevantInitialDealerInfo - this->playerInfos.begin());
+        }
+        else if(entry.Kind() == Entry::Kind::Deal)
+        {
+            if(before.has_value())
+            {
+                delta.changedPlayers = this->PositionsOfPlayersInDeal(this->scoreTable.Rows() - 1);
+            }
+
+            if(!this->completedRounds.empty() && this->completedRounds.back().endDeal == this->scoreTable.Rows())
+            {
+                this->completedRounds.pop_back();
+            }
+
+            this->scoreTable.PopRow();
+
+            this->currentDealerIndex = (this->currentDealerIndex - 1 + this->numberOfPresentPlayers) % this->numberOfPresentPlayers;
+
+            this->ApplyScheme();
+
+            this->multiplierInfo.PopDeal();
+        }
+        else if(entry.Kind() == Entry::Kind::MandatorySoloTrigger)
+        {
+            this->multiplierInfo.RevertMandatorySolo();
+        }
+
+        this->UpdateStandings();
+
+        this->NotifyObserver(before, std::move(delta));
+    }
+
+    template<HouseRulesPolicy Rules>
+    void BasicGameInfo<Rules>::SaveTo(const std::u8string& id) const
+    {
+        this->repository->SaveRevision(this->entryLog.Entries(), this->entryLog.Revision(), id);
+    }
+
+    template<HouseRulesPolicy Rules>
+    void BasicGameInfo<Rules>::LoadFrom(const std::u8string& id)
+    {
+        auto newEntries = this->repository->Load(id);
+        auto before = this->TakeDeltaSnapshot();
+
+        // build the state separately, so that a failure leaves this instance untouched
+        BasicGameInfo loaded(this->repository, this->MaxPlayers);
+
+        loaded.ApplyEntries(std::move(newEntries));
+
+        this->TakeStateFrom(loaded);
+
+        this->UpdateStandings();
+
+        this->NotifyObserver(before, GameDelta { .playersChanged = true, .history = GameDelta::History::Replaced });
+    }
+
+    template<HouseRulesPolicy Rules>
+    void BasicGameInfo<Rules>::ApplyEntries(std::vector<Entry> entries)
+    {
+        for (auto & entry : entries)
+        {
+            entry.Visit(Overloaded {
+                [this](const PlayersSet & playersSet) { this->SetPlayersInternal(playersSet); },
+                [this](const Deal & deal) { this->PushDealInternal(this->ToPlayerIdChanges(deal.Changes()), deal.NumberOfEvents()); },
+                [this](const MandatorySoloTrigger & /*mandatorySoloTrigger*/) { this->TriggerMandatorySoloInternal(); },
+            });
+
+            // first entry must be PlayersSet and is thus replaced
+            if(entry.Kind() == Entry::Kind::PlayersSet && this->entryLog.Size() == 1)
+            {
+                this->entryLog.Pop();
+            }
+
+            this->entryLog.Push(std::move(entry));
+        }
+    }
+
+    template<HouseRulesPolicy Rules>
+    void BasicGameInfo<Rules>::TakeStateFrom(BasicGameInfo& other)
+    {
+        std::vector<std::shared_ptr<PlayerInfoInternal>> newInfosById;
+        newInfosById.reserve(other.playerInfosById.size());
+
+        for(const auto & playerInfo : other.playerInfosById)
+        {
+            // keep existing instances, as they may be held outside, and detach the others below
+            auto existing = this->nameToPlayerId.find(playerInfo->Name());
+            auto target = existing != this->nameToPlayerId.end() ? this->playerInfosById[existing->second] : this->CreatePlayerInfo(playerInfo->Name(), playerInfo->Id());
+
+            target->TakeStateFrom(*playerInfo);
+            newInfosById.push_back(target);
+        }
+
+        std::vector<std::shared_ptr<PlayerInfoInternal>> newInfos;
+        newInfos.reserve(other.playerInfos.size());
+
+        for(const auto & playerInfo : other.playerInfos)
+        {
+            newInfos.push_back(newInfosById[playerInfo->Id()]);
+        }
+
+        // the instances of players missing in the other game are held outside only, their columns are gone with the score table
+        for(const auto & playerInfo : this->playerInfosById)
+        {
+            if(!other.nameToPlayerId.contains(playerInfo->Name()))
+            {
+                playerInfo->Detach();
+            }
+        }
+
+        this->playerInfos = std::move(newInfos);
+        this->playerInfosById = std::move(newInfosById);
+        this->nameToPlayerId = std::move(other.nameToPlayerId);
+        this->numberOfPresentPlayers = other.numberOfPresentPlayers;
+        this->initialDealerIndex = other.initialDealerIndex;
+        this->currentDealerIndex = other.currentDealerIndex;
+        this->sitOutScheme = std::move(other.sitOutScheme);
+        this->sittingOutByOffset = std::move(other.sittingOutByOffset);
+        this->multiplierInfo = std::move(other.multiplierInfo);
+        this->entryLog = std::move(other.entryLog);
+        this->scoreTable = std::move(other.scoreTable);
+        this->completedRounds = std::move(other.completedRounds);
+    }
+
+    template<HouseRulesPolicy Rules>
+    std::optional<typename BasicGameInfo<Rules>::DeltaSnapshot> BasicGameInfo<Rules>::TakeDeltaSnapshot() const
+    {
+        // nobody is interested, so that the mutations do not pay for the comparison
+        if(!this->observer)
+        {
+            return std::nullopt;
+        }
+
+        return DeltaSnapshot
+        {
+            this->currentDealerIndex,
+            this->multiplierInfo.GetPreview(),
+            this->MandatorySolo() == MandatorySolo::Active,
+            this->scoreTable.Rows(),
+            this->standings
+        };
+    }
+
+    template<HouseRulesPolicy Rules>
+    std::vector<unsigned int> BasicGameInfo<Rules>::PositionsOfPlayersInDeal(size_t deal) const
+    {
+        std::vector<unsigned int> positions;
+
+        for(unsigned int position = 0; position < this->playerInfos.size(); ++position)
+        {
+            if(this->scoreTable.HasPlayed(deal, this->playerInfos[position]->Id()))
+            {
+                positions.push_back(position);
+            }
+        }
+
+        return positions;
+    }
+
+    template<HouseRulesPolicy Rules>
+    void BasicGameInfo<Rules>::NotifyObserver(const std::optional<DeltaSnapshot>& before, GameDelta delta) const
+    {
+        if(!this->observer || !before.has_value())
+        {
+            return;
+        }
+
+        delta.standingsChanged = delta.playersChanged || before->standings != this->standings;
+        delta.dealerChanged = delta.playersChanged || before->dealerIndex != this->currentDealerIndex;
+        delta.multiplierChanged = delta.playersChanged
+                || before->isMandatorySolo != (this->MandatorySolo() == MandatorySolo::Active)
+                || before->multiplierPreview != this->multiplierInfo.GetPreview();
+
+        if(delta.history == GameDelta::History::Unchanged && before->deals != this->scoreTable.Rows())
+        {
+            delta.history = before->deals < this->scoreTable.Rows() ? GameDelta::History::Appended : GameDelta::History::Removed;
+        }
+
+        this->observer(delta);
+    }
+
+    template<HouseRulesPolicy Rules>
+    bool BasicGameInfo<Rules>::HasPlayersSet() const
+    {
+        return this->entryLog.NumberOfPlayersSets() > 0;
+    }
+
+    template<HouseRulesPolicy Rules>
+    std::vector<unsigned int> BasicGameInfo<Rules>::MultiplierPreview() const
+    {
+        return this->multiplierInfo.GetPreview();
+    }
+
+    template<HouseRulesPolicy Rules>
+    unsigned int BasicGameInfo<Rules>::LastNumberOfEvents() const
+    {
+        auto lastDeal = this->entryLog.LastDeal();
+
+        return lastDeal != nullptr ? lastDeal->NumberOfEvents().Value() : 0U;
+    }
+
+    template<HouseRulesPolicy Rules>
+    unsigned int BasicGameInfo<Rules>::TotalCashCents() const
+    {
+        return this->standings.totalCashCents;
+    }
+
+    template<HouseRulesPolicy Rules>
+    unsigned int BasicGameInfo<Rules>::AbsentPlayerCashCents() const
+    {
+        return this->standings.absentPlayerCashCents;
+    }
+
+    template<HouseRulesPolicy Rules>
+    auto BasicGameInfo<Rules>::MandatorySolo() const -> enum MandatorySolo
+    {
+        unsigned int count = this->DealsRecorded();
+
+        if(count == 0)
+        {
+            return MandatorySolo::CannotTrigger;
+        }
+
+        return this->multiplierInfo.GetIsMandatorySolo(count) ? MandatorySolo::Active : MandatorySolo::Ready;
+    }
+
+    template<HouseRulesPolicy Rules>
+    unsigned int BasicGameInfo<Rules>::RemainingGamesInRound() const
+    {
+        if(numberOfPresentPlayers == 0)
+        {
+            return 0;
+        }
+
+        return (2 * this->numberOfPresentPlayers + this->initialDealerIndex - this->currentDealerIndex) % this->numberOfPresentPlayers;
+    }
+
+    template<HouseRulesPolicy Rules>
+    const std::vector<typename BasicGameInfo<Rules>::Round>& BasicGameInfo<Rules>::CompletedRounds() const
+    {
+        return this->completedRounds;
+    }
+
+    template<HouseRulesPolicy Rules>
+    unsigned int BasicGameInfo<Rules>::RoundCashCents(const Round& round, const PlayerInfo& playerInfo) const
+    {
+        int maximumRoundScore = 0;
+
+        for(const auto & other : this->playerInfosById)
+        {
+            maximumRoundScore = std::max(maximumRoundScore, other->StatisticsInRange(round.firstDeal, round.endDeal).scoreDelta);
+        }
+
+        return CalculateCashCents<Rules>(static_cast<unsigned int>(maximumRoundScore - playerInfo.StatisticsInRange(round.firstDeal, round.endDeal).scoreDelta));
+    }
+
+    template<HouseRulesPolicy Rules>
+    void BasicGameInfo<Rules>::SetPlayersInternal(const PlayersSet& playersSet)
+    {
+        auto players = playersSet.Players();
+        const auto & dealer = playersSet.Dealer();
+        const auto playersSize = players.size();
+
+        if(playersSize < Rules::PlayersPerDeal)
+        {
+            throw std::exception("not enough players");
+        }
+
+        if(!std::ranges::any_of(players, [&](const auto & player){ return dealer == player; }))
+        {
+            throw std::exception("name of dealer must be among the players");
+        }
+
+        std::ranges::sort(players);
+        if(auto duplicatedName = std::ranges::adjacent_find(players); duplicatedName != players.end())
+        {
+            throw std::exception((std::string("names must be unique, offender: \"") + *duplicatedName + std::string("\"")).c_str());
+        }
+
+        constexpr unsigned int playersSetSizeRequiringSitoutScheme = Rules::PlayersPerDeal + 1U;
+        if(playersSize > playersSetSizeRequiringSitoutScheme && playersSet.SitOutScheme().size() + playersSetSizeRequiringSitoutScheme != playersSize)
+        {
+            throw std::exception("incorrect size of the sit out scheme");
+        }
+
+        // the dealer at offset 0 is implied, older files may still list it, each further position must lie within the table
+        if(!playersSet.SitOutScheme().empty() && *playersSet.SitOutScheme().rbegin() >= playersSize)
+        {
+            throw std::exception("position in the sit out scheme out of range");
+        }
+
+        this->SortAndSetPlayerInfos(playersSet.Players());
+        this->SetDealer(playersSet.Dealer());
+        this->initialDealerIndex = this->currentDealerIndex;
+        this->SetAndApplyScheme(playersSet.SitOutScheme());
+    }
+
+    template<HouseRulesPolicy Rules>
+    void BasicGameInfo<Rules>::SortAndSetPlayerInfos(const std::vector<std::string>& players)
+    {
+        this->numberOfPresentPlayers = static_cast<unsigned int>(players.size());
+
+        std::vector<std::shared_ptr<PlayerInfoInternal>> newInfos;
+
+        for(const auto & playerName : players)
+        {
+            auto playerId = this->nameToPlayerId.find(playerName);
+
+            if(playerId == this->nameToPlayerId.end())
+            {
+                // the new column shows the player as not having played in the previous deals
+                this->scoreTable.AddColumn();
+                auto newPlayerInfo = this->CreatePlayerInfo(playerName, static_cast<unsigned int>(this->playerInfosById.size()));
+
+                this->playerInfosById.push_back(newPlayerInfo);
+                playerId = this->nameToPlayerId.emplace(playerName, newPlayerInfo->Id()).first;
+            }
+
+            auto currentPlayerInfo = this->playerInfosById[playerId->second];
+            currentPlayerInfo->SetIsPresent(true);
+            newInfos.push_back(currentPlayerInfo);
+        }
+
+        // marked by id, so that large tables do not compare each pair of players
+        std::vector<bool> isActiveById(this->playerInfosById.size(), false);
+        for(const auto & playerInfo : newInfos)
+        {
+            isActiveById[playerInfo->Id()] = true;
+        }
+
+        for(const auto & playerInfo : playerInfos)
+        {
+            if(!isActiveById[playerInfo->Id()] && playerInfo->HasPlayed())
+            {
+                playerInfo->SetIsPresent(false);
+                playerInfo->SetIsPlaying(false);
+                newInfos.push_back(playerInfo);
+            }
+        }
+
+        this->playerInfos = newInfos;
+    }
+
+    template<HouseRulesPolicy Rules>
+    std::shared_ptr<typename BasicGameInfo<Rules>::PlayerInfoInternal> BasicGameInfo<Rules>::CreatePlayerInfo(const std::string& name, unsigned int id)
+    {
+        return std::make_shared<PlayerInfoInternal>(name, this->scoreTable, id);
+    }
+
+    template<HouseRulesPolicy Rules>
+    ChangeSet<unsigned int> BasicGameInfo<Rules>::ToPositionChanges(const std::vector<std::pair<std::string, int>>& changes) const
+    {
+        ChangeSet<unsigned int> positionChanges;
+
+        for(const auto & [name, change] : changes)
+        {
+            auto playerId = this->nameToPlayerId.find(name);
+
+            if(playerId == this->nameToPlayerId.end())
+            {
+                throw std::exception((std::string("found change for unknown player: \"") + name + std::string("\"")).c_str());
+            }
+
+            // the present players lead the list in the order of the players set
+            const auto presentEnd = this->playerInfos.begin() + this->numberOfPresentPlayers;
+            auto player = std::ranges::find_if(this->playerInfos.begin(), presentEnd, [&playerId](const std::shared_ptr<PlayerInfoInternal>& playerInfo){ return playerInfo->Id() == playerId->second; });
+
+            if(player == presentEnd)
+            {
+                throw std::exception((std::string("found change for player not playing: \"") + name + std::string("\"")).c_str());
+            }
+
+            positionChanges.emplace_back(static_cast<unsigned int>(player - this->playerInfos.begin()), change);
+        }
+
+        return positionChanges;
+    }
+
+    template<HouseRulesPolicy Rules>
+    ChangeSet<unsigned int> BasicGameInfo<Rules>::ToPlayerIdChanges(const ChangeSet<unsigned int>& changes) const
+    {
+        ChangeSet<unsigned int> idChanges;
+
+        for(const auto & [position, change] : changes)
+        {
+            if(position >= this->numberOfPresentPlayers)
+            {
+                throw std::exception("found change for a position not in the players set");
+            }
+
+            idChanges.emplace_back(this->playerInfos[position]->Id(), change);
+        }
+
+        return idChanges;
+    }
+
+    template<HouseRulesPolicy Rules>
+    void BasicGameInfo<Rules>::SetDealer(const std::string& dealer)
+    {
+        auto dealerId = this->nameToPlayerId.find(dealer);
+        auto dealerIt = dealerId == this->nameToPlayerId.end() ? this->playerInfos.end() : std::ranges::find_if(
+                    this->playerInfos,
+                    [&](const std::shared_ptr<PlayerInfoInternal>& pi){ return pi->Id() == dealerId->second; });
+
+        if(dealerIt == this->playerInfos.end())
+        {
+            throw std::exception("logic error: dealer must be among the players");
+        }
+
+        this->currentDealerIndex = static_cast<unsigned int>(dealerIt - this->playerInfos.begin());
+    }
+
+    template<HouseRulesPolicy Rules>
+    void BasicGameInfo<Rules>::SetAndApplyScheme(const std::set<unsigned int>& newScheme)
+    {
+        this->sitOutScheme = newScheme;
+
+        if(this->numberOfPresentPlayers > Rules::PlayersPerDeal)
+        {
+            this->sitOutScheme.insert(0U);
+        }
+
+        this->UpdateSittingOutByOffset();
+        this->ApplyScheme();
+    }
+
+    template<HouseRulesPolicy Rules>
+    void BasicGameInfo<Rules>::UpdateSittingOutByOffset()
+    {
+        this->sittingOutByOffset.assign(this->numberOfPresentPlayers, false);
+
+        for(const auto offset : this->sitOutScheme)
+        {
+            if(offset < this->numberOfPresentPlayers)
+            {
+                this->sittingOutByOffset[offset] = true;
+            }
+        }
+    }
+
+    template<HouseRulesPolicy Rules>
+    void BasicGameInfo<Rules>::ApplyScheme()
+    {
+        // walks the table once starting at the dealer, which is linear in the number of players
+        for(unsigned int offset = 0; offset < this->numberOfPresentPlayers; ++offset)
+        {
+            auto index = this->currentDealerIndex + offset;
+            if(index >= this->numberOfPresentPlayers)
+            {
+                index -= this->numberOfPresentPlayers;
+            }
+
+            this->playerInfos[index]->SetIsPlaying(!this->sittingOutByOffset[offset]);
+        }
+    }
+
+    template<HouseRulesPolicy Rules>
+    void BasicGameInfo<Rules>::TriggerMandatorySoloInternal()
+    {
+        if(this->MandatorySolo() != MandatorySolo::Ready)
+        {
+            throw std::exception("cannot trigger mandatory solo at this point");
+        }
+
+        this->multiplierInfo.TriggerMandatorySolo(Players(this->numberOfPresentPlayers));
+    }
+
+    template<HouseRulesPolicy Rules>
+    void BasicGameInfo<Rules>::PushDealInternal(const ChangeSet<unsigned int>& changes, NumberOfEvents numberOfEvents)
+    {
+        auto actualChanges = this->AutoCompleteDeal(changes);
+
+        for(const auto & change : actualChanges)
+        {
+            if(const auto & player = this->playerInfosById[change.first]; !player->IsPlaying())
+            {
+                throw std::exception((std::string("found change for player not playing: \"") + player->Name() + std::string("\"")).c_str());
+            }
+
+            if(!ScoreTable::IsRepresentable(change.second))
+            {
+                throw std::exception("change in score out of range");
+            }
+        }
+
+        auto soloPlayer = BasicGameInfo::FindSoloPlayer(actualChanges);
+
+        const auto row = this->scoreTable.Rows();
+        const int multiplier = this->multiplierInfo.GetMultiplier(static_cast<unsigned int>(row));
+
+        // players not playing keep the empty cells of the new row
+        this->scoreTable.PushRow();
+
+        for(size_t index = 0; index < actualChanges.size(); ++index)
+        {
+            const auto & [playerId, change] = actualChanges[index];
+            const auto & player = this->playerInfosById[playerId];
+
+            // the given changes come first, followed by the completed ones
+            this->scoreTable.SetInLastRow(playerId, change, change * multiplier, playerId == soloPlayer, index < changes.size());
+
+            player->SetHasPlayed(true);
+        }
+
+        this->currentDealerIndex = (this->currentDealerIndex + 1) % this->numberOfPresentPlayers;
+
+        EventInfo eventInfo { numberOfEvents, Players(this->numberOfPresentPlayers), Backend::MandatorySolo(false) };
+        this->multiplierInfo.PushDeal(eventInfo);
+
+        this->ApplyScheme();
+
+        if(this->RemainingGamesInRound() == 0)
+        {
+            const auto endDeal = static_cast<unsigned int>(this->scoreTable.Rows());
+            this->completedRounds.push_back({ endDeal - this->numberOfPresentPlayers, endDeal });
+        }
+    }
+
+    template<HouseRulesPolicy Rules>
+    ChangeSet<unsigned int> BasicGameInfo<Rules>::AutoCompleteDeal(const ChangeSet<unsigned int>& inputChanges)
+    {
+        if(inputChanges.size() == Rules::PlayersPerDeal)
+        {
+            int checksum = std::accumulate(inputChanges.begin(),
+                                           inputChanges.end(),
+                                           0,
+                                           [](int s, const std::pair<unsigned int, int>& c){ s += c.second; return s; });
+            if(checksum != 0)
+            {
+                throw std::exception("changes must sum to zero");
+            }
+
+            return inputChanges;
+        }
+        else if(inputChanges.size() > Rules::PlayersPerDeal || inputChanges.empty())
+        {
+            throw std::exception((std::string("there can never be more than ") + std::to_string(Rules::PlayersPerDeal) + std::string(" or zero changes")).c_str());
+        }
+
+        ChangeSet<unsigned int> newChanges;
+        int found = 0;
+        int instances = 0;
+
+        for(const auto & changesIt : inputChanges)
+        {
+            if(instances == 0)
+            {
+                found = changesIt.second;
+                ++instances;
+            }
+            else if(found == changesIt.second)
+            {
+                ++instances;
+            }
+            else
+            {
+                throw std::exception("unable to complete the changes from the information given");
+            }
+
+            newChanges.push_back(changesIt);
+        }
+
+        int valueToSet = - (instances * found) / (static_cast<int>(Rules::PlayersPerDeal) - static_cast<int>(inputChanges.size()));
+
+        auto playersIt = this->playerInfos.begin();
+        auto playersEnd = this->playerInfos.end();
+        for(const auto & playersIt : this->playerInfos)
+        {
+            if(!playersIt->IsPlaying())
+            {
+                continue;
+            }
+
+            if(std::ranges::any_of(inputChanges, [&](const std::pair<unsigned int, int>& change){ return change.first == playersIt->Id(); }))
+            {
+                continue;
+            }
+
+            newChanges.emplace_back(playersIt->Id(), valueToSet);
+        }
+
+        return newChanges;
+    }
+
+    template<HouseRulesPolicy Rules>
+    std::optional<unsigned int> BasicGameInfo<Rules>::FindSoloPlayer(const ChangeSet<unsigned int>& changes)
+    {
+        unsigned int losingPlayer = 0;
+        unsigned int winningPlayer = 0;
+
+        unsigned int losers = 0;
+        unsigned int winners = 0;
+
+        for (const auto & change : changes)
+        {
+            if(change.second < 0)
+            {
+                ++losers;
+                losingPlayer = change.first;
+            }
+            else
+            {
+                ++winners;
+                winningPlayer = change.first;
+            }
+        }
+
+        if(losers == Rules::PlayersPerDeal - 1 && winners == 1)
+        {
+            return winningPlayer;
+        }
+        else if(winners == Rules::PlayersPerDeal - 1 && losers == 1)
+        {
+            return losingPlayer;
+        }
+        else
+        {
+            return {};
+        }
+    }
+
+    template<HouseRulesPolicy Rules>
+    int BasicGameInfo<Rules>::MaximumCurrentScore() const
+    {
+        if(this->playerInfos.empty())
+        {
+            return 0;
+        }
+
+        return (*std::ranges::max_element(this->playerInfos,
+                                  [](const std::shared_ptr<PlayerInfoInternal>& p1, const std::shared_ptr<PlayerInfoInternal>& p2){ return p1->CurrentScore() < p2->CurrentScore(); }))->CurrentScore();
+    }
+
+    template<HouseRulesPolicy Rules>
+    void BasicGameInfo<Rules>::UpdateStandings()
+    {
+        this->standings.maximumCurrentScore = this->MaximumCurrentScore();
+        this->standings.absentPlayerCashCents = CalculateCashCents<Rules>(this->standings.maximumCurrentScore);
+        // tables may list more players than the group has members, then nobody is absent
+        const auto numberOfListedPlayers = static_cast<unsigned int>(this->playerInfos.size());
+        const auto numberOfAbsentMembers = numberOfListedPlayers < this->MaxPlayers ? this->MaxPlayers - numberOfListedPlayers : 0U;
+        this->standings.totalCashCents = numberOfAbsentMembers * this->standings.absentPlayerCashCents;
+
+        // also players that are no longer listed, as their instances may still be held outside
+        for(const auto & playerInfo : this->playerInfosById)
+        {
+            playerInfo->SetCashCents(CalculateCashCents<Rules>(this->standings.maximumCurrentScore - playerInfo->CurrentScore()));
+        }
+
+        for(const auto & playerInfo : this->playerInfos)
+        {
+            this->standings.totalCashCents += playerInfo->CashCents();
+        }
+    }
+
+    template<HouseRulesPolicy Rules>
+    unsigned int BasicGameInfo<Rules>::DealsRecorded() const
+    {
+        return this->entryLog.NumberOfDeals();
+    }
+
+    template<HouseRulesPolicy Rules>
+    void BasicGameInfo<Rules>::EntryLog::Push(Entry entry)
+    {
+        if(entry.Kind() == Entry::Kind::PlayersSet)
+        {
+            this->playersSetPositions.push_back(this->entries.size());
+        }
+        else if(entry.Kind() == Entry::Kind::Deal)
+        {
+            this->dealPositions.push_back(this->entries.size());
+        }
+
+        this->entries.push_back(std::move(entry));
+    }
+
+    template<HouseRulesPolicy Rules>
+    Entry BasicGameInfo<Rules>::EntryLog::Pop()
+    {
+        auto entry = std::move(this->entries.back());
+        this->entries.pop_back();
+        ++(this->revision.pops);
+
+        if(!this->playersSetPositions.empty() && this->playersSetPositions.back() == this->entries.size())
+        {
+            this->playersSetPositions.pop_back();
+        }
+        else if(!this->dealPositions.empty() && this->dealPositions.back() == this->entries.size())
+        {
+            this->dealPositions.pop_back();
+        }
+
+        return entry;
+    }
+
+    template<HouseRulesPolicy Rules>
+    const std::vector<Entry>& BasicGameInfo<Rules>::EntryLog::Entries() const
+    {
+        return this->entries;
+    }
+
+    template<HouseRulesPolicy Rules>
+    const EntryRevision& BasicGameInfo<Rules>::EntryLog::Revision() const
+    {
+        return this->revision;
+    }
+
+    template<HouseRulesPolicy Rules>
+    size_t BasicGameInfo<Rules>::EntryLog::Size() const
+    {
+        return this->entries.size();
+    }
+
+    template<HouseRulesPolicy Rules>
+    const Entry& BasicGameInfo<Rules>::EntryLog::Back() const
+    {
+        return this->entries.back();
+    }
+
+    template<HouseRulesPolicy Rules>
+    unsigned int BasicGameInfo<Rules>::EntryLog::NumberOfPlayersSets() const
+    {
+        return static_cast<unsigned int>(this->playersSetPositions.size());
+    }
+
+    template<HouseRulesPolicy Rules>
+    unsigned int BasicGameInfo<Rules>::EntryLog::NumberOfDeals() const
+    {
+        return static_cast<unsigned int>(this->dealPositions.size());
+    }
+
+    template<HouseRulesPolicy Rules>
+    const PlayersSet* BasicGameInfo<Rules>::EntryLog::LastPlayersSet() const
+    {
+        return !this->playersSetPositions.empty()
+                ? &this->entries[this->playersSetPositions.back()].Get<PlayersSet>()
+                : nullptr;
+    }
+
+    template<HouseRulesPolicy Rules>
+    const Deal* BasicGameInfo<Rules>::EntryLog::LastDeal() const
+    {
+        return !this->dealPositions.empty()
+                ? &this->entries[this->dealPositions.back()].Get<Deal>()
+                : nullptr;
+    }
+
+    template<HouseRulesPolicy Rules>
+    BasicGameInfo<Rules>::PlayerInfoInternal::PlayerInfoInternal(std::string name,
+                                                                 const ScoreTable& scoreTable,
+                                                                 unsigned int id)
+        : PlayerInfo(std::move(name), scoreTable, id)
+    {
+    }
+
+    template<HouseRulesPolicy Rules>
+    unsigned int BasicGameInfo<Rules>::PlayerInfoInternal::Id() const
+    {
+        return this->column;
+    }
+
+    template<HouseRulesPolicy Rules>
+    void BasicGameInfo<Rules>::PlayerInfoInternal::SetHasPlayed(bool hasPlayed)
+    {
+        this->hasPlayed = hasPlayed;
+    }
+
+    template<HouseRulesPolicy Rules>
+    void BasicGameInfo<Rules>::PlayerInfoInternal::SetIsPresent(bool isPresent)
+    {
+        this->isPresent = isPresent;
+    }
+
+    template<HouseRulesPolicy Rules>
+    void BasicGameInfo<Rules>::PlayerInfoInternal::SetIsPlaying(bool isPlaying)
+    {
+        this->isPlaying = isPlaying;
+    }
+
+    template<HouseRulesPolicy Rules>
+    void BasicGameInfo<Rules>::PlayerInfoInternal::SetCashCents(unsigned int cashCents)
+    {
+        this->cashCents = cashCents;
+    }
+
+    template<HouseRulesPolicy Rules>
+    void BasicGameInfo<Rules>::PlayerInfoInternal::TakeStateFrom(const PlayerInfoInternal& other)
+    {
+        this->column = other.column;
+        this->hasPlayed = other.hasPlayed;
+        this->isPresent = other.isPresent;
+        this->isPlaying = other.isPlaying;
+    }
+
+    extern template class BasicGameInfo<HouseRules>;
+
+    /*!
+     * \brief The GameInfo type applies the rules of the house.
+     */
+    using GameInfo = BasicGameInfo<HouseRules>;
 }
 
 #endif // GAMEINFO_H
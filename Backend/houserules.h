@@ -0,0 +1,81 @@
+/*
+ * This file is part of QtDoppelKopf.
+ *
+ * QtDoppelKopf is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtDoppelKopf is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtDoppelKopf.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef HOUSERULES_H
+#define HOUSERULES_H
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+
+namespace Backend
+{
+    /*!
+     * \brief The HouseRules struct holds the rules of the house, which are the default policy
+     *        for GameInfo and MultiplierInfo. Other clubs provide a struct of the same shape.
+     */
+    struct HouseRules
+    {
+        /*!
+         * \brief The number of players in each deal, which is also the number of changes of a complete deal.
+         */
+        static constexpr unsigned int PlayersPerDeal = 4U;
+
+        /*!
+         * \brief The multiplier of a deal indexed by its level of bock, whose highest level is the cap.
+         */
+        static constexpr std::array<unsigned short, 4> MultiplierByBockLevel { 1U, 2U, 4U, 8U }; //NOLINT(google-runtime-int, cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+        /*!
+         * \brief The numerator of the conversion from a point difference to Euro cents.
+         */
+        static constexpr unsigned int PointToCentNumerator = 1U;
+
+        /*!
+         * \brief The denominator of the conversion from a point difference to Euro cents.
+         */
+        static constexpr unsigned int PointToCentDenominator = 2U;
+    };
+
+    /*!
+     * \brief The HouseRulesPolicy concept describes a policy of house rules, as exemplified by HouseRules.
+     */
+    template<typename T>
+    concept HouseRulesPolicy = requires
+    {
+        { T::PlayersPerDeal } -> std::convertible_to<unsigned int>;
+        { T::MultiplierByBockLevel.size() } -> std::convertible_to<std::size_t>;
+        { T::MultiplierByBockLevel[0] } -> std::convertible_to<unsigned short>; //NOLINT(google-runtime-int)
+        { T::PointToCentNumerator } -> std::convertible_to<unsigned int>;
+        { T::PointToCentDenominator } -> std::convertible_to<unsigned int>;
+    }
+    && T::MultiplierByBockLevel.size() > 0 && T::PointToCentDenominator > 0;
+
+    /*!
+     * \brief Gets the highest level of bock, at which further events are deferred to later deals.
+     * \tparam Rules The rules to apply.
+     * \return The highest level of bock.
+     */
+    template<HouseRulesPolicy Rules>
+    constexpr unsigned short MaximumBockLevel() //NOLINT(google-runtime-int)
+    {
+        return static_cast<unsigned short>(Rules::MultiplierByBockLevel.size() - 1); //NOLINT(google-runtime-int)
+    }
+}
+
+#endif // HOUSERULES_H
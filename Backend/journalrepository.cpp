@@ -0,0 +1,256 @@
+/*
+ * This file is part of QtDoppelKopf.
+ *
+ * QtDoppelKopf is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtDoppelKopf is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtDoppelKopf.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "journalrepository.h"
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+Backend::JournalRepository::JournalRepository(unsigned int compactionThreshold)
+    : compactionThreshold(compactionThreshold)
+{
+}
+
+void Backend::JournalRepository::Save(const std::vector<Backend::Entry> & entries, const std::u8string & identifier)
+{
+    this->Compact(entries, EntryRevision(), identifier);
+}
+
+void Backend::JournalRepository::SaveRevision(const std::vector<Backend::Entry> & entries, const EntryRevision & revision, const std::u8string & identifier)
+{
+    auto persistedIt = this->persisted.find(identifier);
+
+    // the lineage of loaded entries is unknown, which no revision matches
+    if(persistedIt == this->persisted.end()
+            || revision.lineage == EntryRevision().lineage
+            || persistedIt->second.revision.lineage != revision.lineage
+            || persistedIt->second.revision.pops > revision.pops
+            || !std::filesystem::exists(std::filesystem::path(identifier)))
+    {
+        this->Compact(entries, revision, identifier);
+        return;
+    }
+
+    const auto & persistedState = persistedIt->second;
+
+    // each pop since the last save may have removed one of the persisted entries, the ones before are unchanged
+    const auto popsSinceSave = revision.pops - persistedState.revision.pops;
+    const auto unchangedPrefix = persistedState.numberOfEntries - static_cast<size_t>(std::min<unsigned long long>(popsSinceSave, persistedState.numberOfEntries)); //NOLINT(google-runtime-int)
+    const auto commonPrefix = std::min(unchangedPrefix, entries.size());
+
+    const auto newRecords = (persistedState.numberOfEntries - commonPrefix) + (entries.size() - commonPrefix);
+
+    if(newRecords == 0)
+    {
+        return;
+    }
+
+    if(persistedState.journalRecords + newRecords >= this->compactionThreshold)
+    {
+        this->Compact(entries, revision, identifier);
+    }
+    else
+    {
+        this->Append(entries, revision, commonPrefix, identifier);
+    }
+}
+
+std::vector<Backend::Entry> Backend::JournalRepository::Load(const std::u8string & identifier)
+{
+    this->RecoverInterruptedCompaction(identifier);
+
+    auto entries = this->snapshots.Load(identifier);
+
+    unsigned int journalRecords = 0;
+    bool isTorn = false;
+
+    auto journalPath = JournalRepository::JournalPath(identifier);
+    if(std::filesystem::exists(journalPath))
+    {
+        journalRecords = this->ReplayJournal(journalPath, entries, isTorn);
+    }
+
+    // the lineage of the entries is not known until they are saved again
+    this->persisted[identifier] = Persisted { EntryRevision(), entries.size(), journalRecords };
+
+    if(isTorn)
+    {
+        // a record was cut off while writing, do not append after it
+        this->Compact(entries, EntryRevision(), identifier);
+    }
+
+    return entries;
+}
+
+void Backend::JournalRepository::Compact(const std::vector<Backend::Entry> & entries, const EntryRevision & revision, const std::u8string & identifier)
+{
+    const auto temporaryPath = JournalRepository::TemporaryPath(identifier);
+
+    // the complete temporary snapshot supersedes the journal, see RecoverInterruptedCompaction
+    this->snapshots.Save(entries, temporaryPath.u8string());
+    std::filesystem::remove(JournalRepository::JournalPath(identifier));
+    std::filesystem::rename(temporaryPath, std::filesystem::path(identifier));
+
+    this->persisted[identifier] = Persisted { revision, entries.size(), 0U };
+}
+
+void Backend::JournalRepository::Append(const std::vector<Backend::Entry> & entries, const EntryRevision & revision, size_t commonPrefix, const std::u8string & identifier)
+{
+    auto journalPath = JournalRepository::JournalPath(identifier);
+    std::ofstream ofs(journalPath, std::ios::out | std::ios::app | std::ios::binary);
+
+    if(!(ofs.is_open() && ofs.good()))
+    {
+        throw std::exception((std::string("unable to open stream for writing \"") + journalPath.string() + std::string("\"")).c_str());
+    }
+
+    auto & persistedState = this->persisted[identifier];
+
+    for(; persistedState.numberOfEntries > commonPrefix; --(persistedState.numberOfEntries))
+    {
+        ofs << RecordPop << '\n';
+        ++(persistedState.journalRecords);
+    }
+
+    // the deals refer to the players of the last players set
+    auto players = DeSerializer::PlayersBefore(entries, commonPrefix);
+
+    for(auto entryIt = entries.begin() + static_cast<std::ptrdiff_t>(commonPrefix); entryIt != entries.end(); ++entryIt)
+    {
+        ofs << RecordPush;
+        this->deserializer.SerializeSingleEntry(*entryIt, players, ofs);
+        ofs << '\n';
+
+        if(entryIt->Kind() == Entry::Kind::PlayersSet)
+        {
+            players = entryIt->Get<PlayersSet>().Players();
+        }
+
+        ++(persistedState.numberOfEntries);
+        ++(persistedState.journalRecords);
+    }
+
+    persistedState.revision = revision;
+
+    ofs.flush();
+
+    if(!(ofs.is_open() && ofs.good()))
+    {
+        this->persisted.erase(identifier);
+        throw std::exception((std::string("bad stream after writing \"") + journalPath.string() + std::string("\"")).c_str());
+    }
+
+    ofs.close();
+}
+
+void Backend::JournalRepository::RecoverInterruptedCompaction(const std::u8string & identifier)
+{
+    const auto temporaryPath = JournalRepository::TemporaryPath(identifier);
+
+    if(!std::filesystem::exists(temporaryPath))
+    {
+        return;
+    }
+
+    // without a journal, a complete temporary snapshot is the latest state
+    if(!std::filesystem::exists(JournalRepository::JournalPath(identifier)))
+    {
+        try
+        {
+            this->snapshots.Load(temporaryPath.u8string());
+            std::filesystem::rename(temporaryPath, std::filesystem::path(identifier));
+            return;
+        }
+        catch (const std::exception&) //NOLINT(bugprone-empty-catch)
+        {
+            // incomplete, the previous snapshot is still valid
+        }
+    }
+
+    std::filesystem::remove(temporaryPath);
+}
+
+unsigned int Backend::JournalRepository::ReplayJournal(const std::filesystem::path & path, std::vector<Backend::Entry> & entries, bool & isTorn)
+{
+    std::ifstream ifs(path, std::ios::in | std::ios::binary);
+
+    if(!(ifs.is_open() && ifs.good()))
+    {
+        throw std::exception((std::string("unable to open stream \"") + path.string() + std::string("\" for reading")).c_str());
+    }
+
+    unsigned int records = 0;
+    std::string line;
+
+    // the deals refer to the players of the last players set
+    auto players = DeSerializer::PlayersBefore(entries, entries.size());
+
+    while(std::getline(ifs, line))
+    {
+        if(ifs.eof())
+        {
+            // the last record lacks its terminator and was not completely written
+            isTorn = true;
+            break;
+        }
+
+        if(line.size() == 1 && line[0] == RecordPop)
+        {
+            if(entries.empty())
+            {
+                throw std::exception("journal pops more entries than present");
+            }
+
+            const auto poppedPlayersSet = entries.back().Kind() == Entry::Kind::PlayersSet;
+            entries.pop_back();
+
+            if(poppedPlayersSet)
+            {
+                players = DeSerializer::PlayersBefore(entries, entries.size());
+            }
+        }
+        else if(!line.empty() && line[0] == RecordPush)
+        {
+            std::stringstream ss(line.substr(1));
+            entries.push_back(this->deserializer.DeserializeSingleEntry(ss, players));
+
+            if(entries.back().Kind() == Entry::Kind::PlayersSet)
+            {
+                players = entries.back().Get<PlayersSet>().Players();
+            }
+        }
+        else
+        {
+            throw std::exception("unknown record in journal");
+        }
+
+        ++records;
+    }
+
+    return records;
+}
+
+std::filesystem::path Backend::JournalRepository::JournalPath(const std::u8string & identifier)
+{
+    return std::filesystem::path(identifier + reinterpret_cast<const char8_t*>(JournalSuffix)); //NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
+std::filesystem::path Backend::JournalRepository::TemporaryPath(const std::u8string & identifier)
+{
+    return std::filesystem::path(identifier + reinterpret_cast<const char8_t*>(TemporarySuffix)); //NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+}
@@ -0,0 +1,95 @@
+/*
+ * This file is part of QtDoppelKopf.
+ *
+ * QtDoppelKopf is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtDoppelKopf is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtDoppelKopf.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../Backend/diskrepository.h"
+#include "../Backend/repository.h"
+#include <filesystem>
+#include <map>
+
+#ifndef JOURNALREPOSITORY_H
+#define JOURNALREPOSITORY_H
+
+namespace Backend
+{
+    /*!
+     * \brief The JournalRepository class persists entries to disk as a snapshot
+     *        in the normal file format plus an append-only journal next to it.
+     *        Saving only appends the entries pushed and popped since the last save,
+     *        and the journal is periodically compacted back into the snapshot.
+     *        Loading replays the journal on top of the snapshot, which recovers
+     *        the state after a crash.
+     */
+    class JournalRepository final : public Repository
+    {
+    private:
+        constexpr static const char * const JournalSuffix = ".journal";
+        constexpr static const char * const TemporarySuffix = ".tmp";
+        constexpr static const char RecordPush = '+';
+        constexpr static const char RecordPop = '-';
+
+        /*!
+         * \brief The Persisted struct describes what is on disk for an identifier.
+         */
+        struct Persisted
+        {
+            EntryRevision revision;
+            size_t numberOfEntries{};
+            unsigned int journalRecords{};
+        };
+
+        Backend::DeSerializer deserializer;
+        Backend::DiskRepository snapshots;
+        const unsigned int compactionThreshold;
+        std::map<std::u8string, Persisted> persisted;
+
+    public:
+        /*!
+         * \brief Initializes a new instance.
+         * \param compactionThreshold The number of journal records after which the journal is compacted into the snapshot.
+         */
+        explicit JournalRepository(unsigned int compactionThreshold = 64U);
+
+        /*!
+         * \reimp
+         * \remark Without a revision, the entries cannot be related to the ones on disk and are compacted.
+         */
+        void Save(const std::vector<Backend::Entry> & entries, const std::u8string & identifier) override;
+
+        /*!
+         * \reimp
+         */
+        std::vector<Backend::Entry> Load(const std::u8string & identifier) override;
+
+        /*!
+         * \reimp
+         * \remark The entries popped since the last save bound the unchanged prefix, so that only the tail is written.
+         *         The first save of a lineage, e.g. after loading, is compacted.
+         */
+        void SaveRevision(const std::vector<Backend::Entry> & entries, const EntryRevision & revision, const std::u8string & identifier) override;
+
+    private:
+        void Compact(const std::vector<Backend::Entry> & entries, const EntryRevision & revision, const std::u8string & identifier);
+        void Append(const std::vector<Backend::Entry> & entries, const EntryRevision & revision, size_t commonPrefix, const std::u8string & identifier);
+        void RecoverInterruptedCompaction(const std::u8string & identifier);
+        unsigned int ReplayJournal(const std::filesystem::path & path, std::vector<Backend::Entry> & entries, bool & isTorn); //NOLINT (google-runtime-references)
+        static std::filesystem::path JournalPath(const std::u8string & identifier);
+        static std::filesystem::path TemporaryPath(const std::u8string & identifier);
+    };
+}
+
+#endif // JOURNALREPOSITORY_H
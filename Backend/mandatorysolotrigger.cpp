@@ -20,8 +20,3 @@
 
 Backend::MandatorySoloTrigger::MandatorySoloTrigger()
 = default;
-
-enum Backend::Entry::Kind Backend::MandatorySoloTrigger::Kind() const
-{
-    return Backend::Entry::Kind::MandatorySoloTrigger;
-}
@@ -16,8 +16,6 @@
  *
  */
 
-#include "entry.h"
-
 #ifndef MANDATORYSOLOTRIGGER_H
 #define MANDATORYSOLOTRIGGER_H
 
@@ -28,7 +26,7 @@ namespace Backend
      *        the beginning of a mandatory solo round,
      *        suspending the multiplier.
      */
-    class MandatorySoloTrigger final : public Entry
+    class MandatorySoloTrigger final
     {
     public:
         /*!
@@ -37,9 +35,11 @@ namespace Backend
         MandatorySoloTrigger();
 
         /*!
-         * \reimp
+         * \brief Compares the trigger with another one, which are all equal.
+         * \param other The trigger to compare with.
+         * \return Always true.
          */
-        [[nodiscard]] enum Entry::Kind Kind() const override;
+        [[nodiscard]] bool operator==(const MandatorySoloTrigger& other) const = default;
     };
 }
 
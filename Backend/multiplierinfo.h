@@ -20,15 +20,22 @@
 #define MULTIPLIERINFO_H
 
 #include "eventinfo.h"
+#include "houserules.h"
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <utility>
 #include <vector>
 
 namespace Backend
 {
     /*!
-     * \brief The MultiplierInfo class represents logic regarding
+     * \brief The BasicMultiplierInfo class represents logic regarding
      *        the calculation of the current and future multipliers.
+     * \tparam Rules The house rules, which define the levels of bock and their multipliers.
      */
-    class MultiplierInfo
+    template<HouseRulesPolicy Rules>
+    class BasicMultiplierInfo
     {
     private:
         template<typename T>
@@ -58,6 +65,11 @@ namespace Backend
                 this->data.insert(data.begin() + index, count, value);
             }
 
+            void erase(const unsigned int index, const unsigned int count)
+            {
+                this->data.erase(data.begin() + index, data.begin() + index + count);
+            }
+
             void clear()
             {
                 this->data.clear();
@@ -81,14 +93,27 @@ namespace Backend
             }
         };
 
+        /*!
+         * \brief The JournalRecord struct collects what a single pushed deal
+         *        changed in the effective multipliers, so that it can be undone.
+         *        The start indices of its events are kept on a shared stack, so that the record does not allocate.
+         */
+        struct JournalRecord
+        {
+            EventInfo eventInfo;
+            std::optional<EventInfo> replacedEventInfo;
+        };
+
         unsigned int dealIndex;
         SparseVector<std::pair<unsigned short, bool>> effective; //NOLINT(google-runtime-int)
+        std::vector<JournalRecord> journal;
+        std::vector<unsigned int> eventStartIndices;
 
     public:
         /*!
          * \brief Initializes a new instance.
          */
-        MultiplierInfo();
+        BasicMultiplierInfo();
 
         /*!
          * \brief Pushes the result of a deal.
@@ -96,6 +121,22 @@ namespace Backend
          */
         void PushDeal(const EventInfo & eventInfo);
 
+        /*!
+         * \brief Removes the last pushed deal, restoring the state before it was pushed.
+         */
+        void PopDeal();
+
+        /*!
+         * \brief Turns the last pushed deal into the trigger of a mandatory solo round.
+         * \param players The number of players present when the round is triggered.
+         */
+        void TriggerMandatorySolo(Players players);
+
+        /*!
+         * \brief Reverts the last pushed deal to the state before a mandatory solo round was triggered by it.
+         */
+        void RevertMandatorySolo();
+
         /*!
          * \brief Reinitializes the contained data based on the provided events.
          *        Typically used after the events were rewritten in some fashion.
@@ -123,6 +164,165 @@ namespace Backend
          */
         [[nodiscard]] std::vector<unsigned int> GetPreview() const;
     };
+
+    template<HouseRulesPolicy Rules>
+    BasicMultiplierInfo<Rules>::BasicMultiplierInfo()
+        : dealIndex(0)
+    {
+    }
+
+    template<HouseRulesPolicy Rules>
+    void BasicMultiplierInfo<Rules>::PushDeal(const EventInfo & eventInfo)
+    {
+        unsigned int effectiveIndex = this->dealIndex + 1;
+
+        if(eventInfo.mandatorySolo)
+        {
+            this->effective.insert(effectiveIndex, eventInfo.players.Value(), std::make_pair(0U, true));
+        }
+
+        const unsigned int baseIndex = effectiveIndex;
+
+        for(unsigned int event = 0; event < eventInfo.number.Value(); ++event)
+        {
+            effectiveIndex = baseIndex;
+
+            while(this->effective.at(effectiveIndex).first == MaximumBockLevel<Rules>() || this->effective.at(effectiveIndex).second)
+            {
+                ++effectiveIndex;
+            }
+
+            this->eventStartIndices.push_back(effectiveIndex);
+
+            for(unsigned int iter = 0; iter < eventInfo.players.Value(); ++iter)
+            {
+                this->effective.at(effectiveIndex++).first++;
+            }
+        }
+
+        this->journal.push_back(JournalRecord { eventInfo, std::nullopt });
+
+        ++(this->dealIndex);
+    }
+
+    template<HouseRulesPolicy Rules>
+    void BasicMultiplierInfo<Rules>::PopDeal()
+    {
+        if(this->journal.empty())
+        {
+            throw std::exception("no deal to pop");
+        }
+
+        const auto & record = this->journal.back();
+
+        // the events are undone in reverse and the capacity of the stack is kept, so that pushing again does not allocate
+        const auto firstEvent = this->eventStartIndices.size() - record.eventInfo.number.Value();
+
+        for(auto event = this->eventStartIndices.size(); event > firstEvent; --event)
+        {
+            for(unsigned int iter = 0; iter < record.eventInfo.players.Value(); ++iter)
+            {
+                this->effective.at(this->eventStartIndices[event - 1] + iter).first--;
+            }
+        }
+
+        this->eventStartIndices.resize(firstEvent);
+
+        if(record.eventInfo.mandatorySolo)
+        {
+            this->effective.erase(this->dealIndex, record.eventInfo.players.Value());
+        }
+
+        this->journal.pop_back();
+
+        --(this->dealIndex);
+    }
+
+    template<HouseRulesPolicy Rules>
+    void BasicMultiplierInfo<Rules>::TriggerMandatorySolo(Players players)
+    {
+        if(this->journal.empty())
+        {
+            throw std::exception("no deal to trigger mandatory solo from");
+        }
+
+        const EventInfo original = this->journal.back().eventInfo;
+
+        this->PopDeal();
+        this->PushDeal(EventInfo { original.number, players, MandatorySolo(true) });
+
+        this->journal.back().replacedEventInfo.emplace(original);
+    }
+
+    template<HouseRulesPolicy Rules>
+    void BasicMultiplierInfo<Rules>::RevertMandatorySolo()
+    {
+        if(this->journal.empty() || !this->journal.back().replacedEventInfo.has_value())
+        {
+            throw std::exception("no mandatory solo to revert");
+        }
+
+        const EventInfo original = *(this->journal.back().replacedEventInfo);
+
+        this->PopDeal();
+        this->PushDeal(original);
+    }
+
+    template<HouseRulesPolicy Rules>
+    void BasicMultiplierInfo<Rules>::ResetTo(const std::vector<EventInfo> & events)
+    {
+        this->effective.clear();
+        this->journal.clear();
+        this->eventStartIndices.clear();
+        this->dealIndex = 0;
+
+        for (const auto & event : events)
+        {
+            this->PushDeal(event);
+        }
+
+        this->dealIndex = static_cast<unsigned int>(events.size());
+    }
+
+    template<HouseRulesPolicy Rules>
+    unsigned short BasicMultiplierInfo<Rules>::GetMultiplier(const unsigned int & index) const //NOLINT(google-runtime-int)
+    {
+        const auto level = this->effective.at(index).first;
+
+        if(level > MaximumBockLevel<Rules>())
+        {
+            throw std::exception((std::string("not supported bock of ") + std::to_string(static_cast<unsigned int>(level))).c_str());
+        }
+
+        return Rules::MultiplierByBockLevel[level];
+    }
+
+    template<HouseRulesPolicy Rules>
+    bool BasicMultiplierInfo<Rules>::GetIsMandatorySolo(const unsigned int & index) const
+    {
+        return this->effective.at(index).second;
+    }
+
+    template<HouseRulesPolicy Rules>
+    std::vector<unsigned int> BasicMultiplierInfo<Rules>::GetPreview() const
+    {
+        std::vector<unsigned int> preview;
+        preview.reserve(MaximumBockLevel<Rules>());
+
+        for(unsigned short level = 1; level <= MaximumBockLevel<Rules>(); ++level) //NOLINT(google-runtime-int)
+        {
+            preview.push_back(this->effective.countAfter(this->dealIndex, std::pair<unsigned short, bool>(level, false))); //NOLINT(google-runtime-int)
+        }
+
+        return preview;
+    }
+
+    extern template class BasicMultiplierInfo<HouseRules>;
+
+    /*!
+     * \brief The MultiplierInfo type applies the rules of the house.
+     */
+    using MultiplierInfo = BasicMultiplierInfo<HouseRules>;
 }
 
 #endif // MULTIPLIERINFO_H
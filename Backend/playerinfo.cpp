@@ -17,30 +17,49 @@
  */
 
 #include "playerinfo.h"
-#include "cashcalculation.h"
 #include <algorithm>
-#include <numeric>
 #include <utility>
 
 namespace Backend
 {
+    namespace
+    {
+        // the detached players read from a single empty column, so that the accessors need no checks
+        const ScoreTable& DetachedScoreTable()
+        {
+            static const ScoreTable detachedScoreTable = []()
+            {
+                ScoreTable scoreTable;
+                scoreTable.AddColumn();
+                return scoreTable;
+            }();
+
+            return detachedScoreTable;
+        }
+    }
+
     PlayerInfo::PlayerInfo(std::string name,
-                           std::function<unsigned short(unsigned int)> multiplierAccessor, //NOLINT(google-runtime-int)
-                           std::function<int()> maxCurrentScoreAccessor)
+                           const ScoreTable& scoreTable,
+                           unsigned int column)
         : name(std::move(name)),
+          scoreTable(&scoreTable),
+          column(column),
           hasPlayed(false),
           isPresent(false),
-          isPlaying(false),
-          multiplierAccessor(std::move(multiplierAccessor)),
-          maxCurrentScoreAccessor(std::move(maxCurrentScoreAccessor))
+          isPlaying(false)
     {
     }
 
-    std::string PlayerInfo::Name() const
+    const std::string& PlayerInfo::Name() const
     {
         return this->name;
     }
 
+    bool PlayerInfo::IsDetached() const
+    {
+        return this->scoreTable == &DetachedScoreTable();
+    }
+
     bool PlayerInfo::HasPlayed() const
     {
         return this->hasPlayed;
@@ -58,107 +77,119 @@ namespace Backend
 
     int PlayerInfo::CurrentScore() const
     {
-        return this->accumulatedMultipliedResults.empty() ? 0 : this->accumulatedMultipliedResults.back();
+        const auto rows = this->scoreTable->Rows();
+
+        return rows > 0 ? this->scoreTable->Total(rows - 1, this->column) : 0;
     }
 
     bool PlayerInfo::ParticipatedInLastDeal() const
     {
-        return !this->dealResults.empty() ? this->dealResults.back().HasPlayedInDeal : false;
+        const auto rows = this->scoreTable->Rows();
+
+        return rows > 0 ? this->scoreTable->HasPlayed(rows - 1, this->column) : false;
     }
 
     int PlayerInfo::ScoreInLastDeal() const
     {
-        return this->multipliedResults.back();
+        const auto rows = this->scoreTable->Rows();
+
+        return rows > 0 ? this->scoreTable->MultipliedScore(rows - 1, this->column) : 0;
     }
 
     std::string PlayerInfo::InputInLastDeal() const
     {
-        return !this->dealInput.empty() ? this->dealInput.back() : std::string();
+        const auto rows = this->scoreTable->Rows();
+
+        // only the given scores are flagged, the completed ones show no input
+        return rows > 0 && this->scoreTable->HasInput(rows - 1, this->column)
+                ? std::to_string(this->scoreTable->UnmultipliedScore(rows - 1, this->column))
+                : std::string();
     }
 
     unsigned int PlayerInfo::CashCents() const
     {
-        return CalculateCashCents(this->maxCurrentScoreAccessor() - this->CurrentScore());
+        return this->cashCents;
     }
 
     unsigned int PlayerInfo::NumberGamesWon() const
     {
-        return static_cast<unsigned int>(std::ranges::count_if(this->dealResults, [](DealResult item){ return item.HasPlayedInDeal && item.UnmultipliedScore > 0; }));
+        return this->Statistics().numberGamesWon;
     }
 
     unsigned int PlayerInfo::NumberGamesLost() const
     {
-        return static_cast<unsigned int>(std::ranges::count_if(this->dealResults, [](DealResult item){ return item.HasPlayedInDeal && item.UnmultipliedScore < 0; }));
+        return this->Statistics().numberGamesLost;
     }
 
     unsigned int PlayerInfo::NumberGames() const
     {
-        return static_cast<unsigned int>(std::ranges::count_if(this->dealResults, [](DealResult item){ return item.HasPlayedInDeal; }));
+        return this->Statistics().numberGames;
     }
 
     unsigned int PlayerInfo::SolosWon() const
     {
-        return static_cast<unsigned int>(std::ranges::count_if(this->dealResults,
-                                                               [](DealResult item)
-                                                               {
-                                                                  return item.HasPlayedInDeal && item.PlayedSolo && item.UnmultipliedScore > 0;
-                                                               }));
+        return this->Statistics().solosWon;
     }
 
     unsigned int PlayerInfo::SolosLost() const
     {
-        return static_cast<unsigned int>(std::ranges::count_if(this->dealResults,
-                                                               [](DealResult item)
-                                                               {
-                                                                  return item.HasPlayedInDeal && item.PlayedSolo && item.UnmultipliedScore < 0;
-                                                               }));
+        return this->Statistics().solosLost;
     }
 
     int PlayerInfo::TotalSoloPoints() const
     {
-        int sum = 0;
+        return this->Statistics().totalSoloPoints;
+    }
 
-        for (unsigned int index = 0; index < this->dealResults.size(); ++index)
-        {
-            if(this->dealResults[index].PlayedSolo)
-            {
-                sum += this->multipliedResults[index];
-            }
-        }
+    int PlayerInfo::MaxSingleWin() const
+    {
+        return this->Statistics().maxSingleWin;
+    }
 
-        return sum;
+    int PlayerInfo::MaxSingleLoss() const
+    {
+        return this->Statistics().maxSingleLoss;
     }
 
-    int PlayerInfo::MaxSingleWin() const
+    int PlayerInfo::UnmultipliedScore() const
     {
-        if(this->multipliedResults.empty())
-        {
-            return 0;
-        }
+        return this->Statistics().unmultipliedScore;
+    }
 
-        return std::max(0, *std::ranges::max_element(this->multipliedResults));
+    std::span<const std::int32_t> PlayerInfo::ScoreHistory() const
+    {
+        return this->scoreTable->Totals(this->column);
     }
 
-    int PlayerInfo::MaxSingleLoss() const
+    std::vector<ScoreTable::Point> PlayerInfo::DecimatedScoreHistory(size_t begin, size_t end, size_t maximumPoints) const
     {
-        if(this->multipliedResults.empty())
-        {
-            return 0;
-        }
+        return this->scoreTable->DecimatedTotals(this->column, begin, end, maximumPoints);
+    }
 
-        return std::min(0, *std::ranges::min_element(this->multipliedResults));
+    Statistics PlayerInfo::Statistics() const
+    {
+        return this->StatisticsInRange(0, this->scoreTable->Rows());
     }
 
-    int PlayerInfo::UnmultipliedScore() const
+    Statistics PlayerInfo::StatisticsInRange(size_t begin, size_t end) const
     {
-        return std::accumulate(this->dealResults.begin(),
-                               this->dealResults.end(),
-                               0,
-                               [](int total, DealResult item) { total += item.UnmultipliedScore; return total; });
+        return this->scoreTable->StatisticsInRange(this->column, begin, end);
+    }
+
+    Statistics PlayerInfo::StatisticsOfLastDeals(size_t count) const
+    {
+        const auto rows = this->scoreTable->Rows();
+
+        return this->StatisticsInRange(rows - std::min(count, rows), rows);
     }
 
-    std::vector<int> PlayerInfo::ScoreHistory() const
+    void PlayerInfo::Detach()
     {
-        return this->accumulatedMultipliedResults;
+        this->scoreTable = &DetachedScoreTable();
+        this->column = 0;
+        this->hasPlayed = false;
+        this->isPresent = false;
+        this->isPlaying = false;
+        this->cashCents = 0;
     }
 }
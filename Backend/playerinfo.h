@@ -19,7 +19,10 @@
 #ifndef PLAYERINFO_H
 #define PLAYERINFO_H
 
-#include <functional>
+#include "scoretable.h"
+#include "statistics.h"
+#include <cstdint>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -28,52 +31,42 @@ namespace Backend
     /*!
      * \brief The PlayerInfo class collects information
      *        regarding a player identified by name.
+     *        The results of the deals are read from the column of the player in the score table of the game.
      */
     class PlayerInfo
     {
     protected:
-        struct DealResult
-        {
-        public:
-            DealResult(bool hasPlayedInDeal, int unmultipliedScore, bool playedSolo)
-                : HasPlayedInDeal(hasPlayedInDeal),
-                  UnmultipliedScore(unmultipliedScore),
-                  PlayedSolo(playedSolo)
-            {
-            }
-
-            const bool HasPlayedInDeal;
-            const int UnmultipliedScore;
-            const bool PlayedSolo;
-        };
-
         std::string name;
+        const ScoreTable* scoreTable;
+        unsigned int column;
         bool hasPlayed;
         bool isPresent;
         bool isPlaying;
-        std::vector<DealResult> dealResults;
-        std::vector<int> multipliedResults;
-        std::vector<int> accumulatedMultipliedResults;
-        std::vector<std::string> dealInput;
-        std::function<unsigned short(unsigned int)> multiplierAccessor; //NOLINT(google-runtime-int)
-        std::function<int()> maxCurrentScoreAccessor;
+        unsigned int cashCents{};
 
     public:
         /*!
          * \brief Initializes a new instance from the given name.
          * \param name The unique name of the player.
-         * \param multiplierAccessor A function to obtain the multiplier for the indexed game.
-         * \param maxCurrentScoreAccessor A function to obtain the maximum current score among the players.
+         * \param scoreTable The score table holding the results of the player, which must outlive this instance.
+         * \param column The column of the player in the score table.
          */
         PlayerInfo(std::string name,
-                   std::function<unsigned short(unsigned int)> multiplierAccessor, //NOLINT(google-runtime-int)
-                   std::function<int()> maxCurrentScoreAccessor);
+                   const ScoreTable& scoreTable,
+                   unsigned int column);
+
+        /*!
+         * \brief Gets a value indicating whether the player was dropped from the game, e.g. by loading a game without the player.
+         *        A detached player keeps the name, but reports neither presence nor any deals.
+         * \return A value indicating whether the player was dropped from the game.
+         */
+        [[nodiscard]] bool IsDetached() const;
 
         /*!
          * \brief Gets the name of the player.
-         * \return The name of the player.
+         * \return The name of the player, which is kept for the lifetime of this instance.
          */
-        [[nodiscard]] std::string Name() const;
+        [[nodiscard]] const std::string& Name() const;
 
         /*!
          * \brief Gets a value indicating whether the player has participated in any deal.
@@ -179,9 +172,46 @@ namespace Backend
 
         /*!
          * \brief Gets the entire history of scores.
-         * \return The entire history of scores.
+         * \return The entire history of scores, valid until the next change to the game.
+         */
+        [[nodiscard]] std::span<const std::int32_t> ScoreHistory() const;
+
+        /*!
+         * \brief Gets the history of scores over a range of deals with a bounded number of points,
+         *        which keep the minimum and the maximum of the deals they stand for.
+         * \param begin The index of the first deal in the range.
+         * \param end The index after the last deal in the range, which is limited to the deals recorded.
+         * \param maximumPoints The maximal number of points, which is raised to four if smaller.
+         * \return The points ordered by their deals.
+         */
+        [[nodiscard]] std::vector<ScoreTable::Point> DecimatedScoreHistory(size_t begin, size_t end, size_t maximumPoints) const;
+
+        /*!
+         * \brief Gets the statistics over all deals at once.
+         * \return The statistics over all deals.
+         */
+        [[nodiscard]] Backend::Statistics Statistics() const;
+
+        /*!
+         * \brief Gets the statistics over a range of deals, e.g. a round.
+         * \param begin The index of the first deal in the range.
+         * \param end The index after the last deal in the range.
+         * \return The statistics over the range of deals.
+         */
+        [[nodiscard]] Backend::Statistics StatisticsInRange(size_t begin, size_t end) const;
+
+        /*!
+         * \brief Gets the statistics over the last deals.
+         * \param count The number of deals, which is limited to the deals recorded.
+         * \return The statistics over the last deals.
+         */
+        [[nodiscard]] Backend::Statistics StatisticsOfLastDeals(size_t count) const;
+
+    protected:
+        /*!
+         * \brief Detaches the player from the score table of the game, which may be replaced afterwards.
          */
-        [[nodiscard]] std::vector<int> ScoreHistory() const;
+        void Detach();
     };
 }
 
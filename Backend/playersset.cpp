@@ -31,11 +31,6 @@ Backend::PlayersSet::PlayersSet(std::vector<std::string> players,
 {
 }
 
-enum Backend::Entry::Kind Backend::PlayersSet::Kind() const
-{
-    return Backend::Entry::Kind::PlayersSet;
-}
-
 std::set<unsigned int> Backend::PlayersSet::SitOutScheme() const
 {
     return this->sitOutScheme;
@@ -16,7 +16,6 @@
  *
  */
 
-#include "entry.h"
 #include <set>
 #include <string>
 #include <vector>
@@ -30,7 +29,7 @@ namespace Backend
      * \brief The PlayersSet class represents a change in the players
      *        present at the table.
      */
-    class PlayersSet final : public Entry
+    class PlayersSet final
     {
     private:
         std::vector<std::string> players;
@@ -50,11 +49,6 @@ namespace Backend
                    std::set<unsigned int> sitOutScheme,
                    std::string previousDealer);
 
-        /*!
-         * \reimp
-         */
-        [[nodiscard]] enum Entry::Kind Kind() const override;
-
         /*!
          * \brief Gets the names of the players.
          * \return The names of the players.
@@ -78,6 +72,13 @@ namespace Backend
          * \return The name of the last current dealer before this set.
          */
         [[nodiscard]] std::string PreviousDealer() const;
+
+        /*!
+         * \brief Compares the players set with another one.
+         * \param other The players set to compare with.
+         * \return A value indicating whether both players sets are equal.
+         */
+        [[nodiscard]] bool operator==(const PlayersSet& other) const = default;
     };
 }
 
@@ -0,0 +1,217 @@
+/*
+ * This file is part of QtDoppelKopf.
+ *
+ * QtDoppelKopf is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtDoppelKopf is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtDoppelKopf.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef RANGEEXTREMUM_H
+#define RANGEEXTREMUM_H
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace Backend
+{
+    /*!
+     * \brief The RangeExtremum class indexes a sequence that grows and shrinks at the back
+     *        and answers for the position of the extremum of any range of it in O(log n).
+     *        The values stay with the caller, who hands them in on each call, so that they are not copied.
+     *        Level k holds the index of the extremum of each aligned block of 2^k values for k >= FirstLevel,
+     *        the blocks below are scanned, so that about n / 2^(FirstLevel - 1) indices are kept.
+     *        The storage of all levels is kept when shrinking, so that growing again does not allocate.
+     * \tparam T The type of the values.
+     * \tparam Compare The ordering, the extremum is the maximum with respect to it.
+     */
+    template<typename T, typename Compare = std::less<T>>
+    class RangeExtremum
+    {
+    private:
+        static constexpr size_t FirstLevel = 4U;
+
+        std::vector<std::vector<std::uint32_t>> levels;
+        size_t size{};
+        Compare compare{};
+
+    public:
+        /*!
+         * \brief Gets the number of values.
+         * \return The number of values.
+         */
+        [[nodiscard]] size_t Size() const
+        {
+            return this->size;
+        }
+
+        /*!
+         * \brief Indexes the value appended to the values.
+         * \param values The values, which hold one more value than before.
+         */
+        template<typename Values>
+        void PushBack(const Values& values)
+        {
+            ++(this->size);
+
+            const auto activeLevels = this->ActiveLevels();
+            while(this->levels.size() + FirstLevel < activeLevels)
+            {
+                this->levels.emplace_back();
+            }
+
+            for(size_t level = FirstLevel; level < activeLevels; ++level)
+            {
+                this->levels[level - FirstLevel].resize(((this->size - 1) >> level) + 1);
+            }
+
+            this->UpdateBack(values);
+        }
+
+        /*!
+         * \brief Forgets the value removed from the values, which must have existed.
+         * \param values The values, which hold one value less than before.
+         */
+        template<typename Values>
+        void PopBack(const Values& values)
+        {
+            --(this->size);
+
+            const auto activeLevels = this->ActiveLevels();
+
+            for(size_t level = FirstLevel; level < this->levels.size() + FirstLevel; ++level)
+            {
+                this->levels[level - FirstLevel].resize(level < activeLevels ? ((this->size - 1) >> level) + 1 : 0);
+            }
+
+            for(size_t level = FirstLevel; level < activeLevels; ++level)
+            {
+                this->Recompute(values, level, this->levels[level - FirstLevel].size() - 1);
+            }
+        }
+
+        /*!
+         * \brief Reindexes after the last value changed, which must exist.
+         * \param values The values.
+         */
+        template<typename Values>
+        void UpdateBack(const Values& values)
+        {
+            for(size_t level = FirstLevel; level < this->ActiveLevels(); ++level)
+            {
+                this->Recompute(values, level, this->levels[level - FirstLevel].size() - 1);
+            }
+        }
+
+        /*!
+         * \brief Gets the index of the extremum of the values in the range, which must not be empty.
+         * \param values The values.
+         * \param begin The index of the first value in the range.
+         * \param end The index after the last value in the range.
+         * \return The index of the extremum of the values in the range, the first one if it occurs repeatedly.
+         */
+        template<typename Values>
+        [[nodiscard]] size_t Query(const Values& values, size_t begin, size_t end) const
+        {
+            constexpr size_t blockSize = size_t { 1 } << FirstLevel;
+            size_t result = begin;
+
+            // the values before the first and after the last whole block of the first level are scanned
+            const auto blocksBegin = std::min(end, (begin + blockSize - 1) & ~(blockSize - 1));
+            const auto blocksEnd = std::max(blocksBegin, end & ~(blockSize - 1));
+
+            for(size_t index = begin + 1; index < blocksBegin; ++index)
+            {
+                result = this->Better(values, result, index);
+            }
+
+            for(size_t index = blocksEnd; index < end; ++index)
+            {
+                result = this->Better(values, result, index);
+            }
+
+            begin = blocksBegin >> FirstLevel;
+            end = blocksEnd >> FirstLevel;
+
+            for(size_t level = FirstLevel; begin < end; ++level, begin >>= 1U, end >>= 1U)
+            {
+                if((begin & 1U) != 0U)
+                {
+                    result = this->Better(values, result, this->IndexAt(level, begin++));
+                }
+
+                if((end & 1U) != 0U)
+                {
+                    result = this->Better(values, result, this->IndexAt(level, --end));
+                }
+            }
+
+            return result;
+        }
+
+    private:
+        [[nodiscard]] size_t ActiveLevels() const
+        {
+            return this->size == 0 ? 0 : static_cast<size_t>(std::bit_width(this->size - 1)) + 1;
+        }
+
+        [[nodiscard]] size_t IndexAt(size_t level, size_t block) const
+        {
+            return this->levels[level - FirstLevel][block];
+        }
+
+        template<typename Values>
+        [[nodiscard]] size_t Better(const Values& values, size_t left, size_t right) const
+        {
+            // on equal values the earlier index wins, so that the result does not depend on the order of combining
+            if(this->compare(values[left], values[right]))
+            {
+                return right;
+            }
+
+            return this->compare(values[right], values[left]) || left < right ? left : right;
+        }
+
+        template<typename Values>
+        void Recompute(const Values& values, size_t level, size_t block)
+        {
+            if(level == FirstLevel)
+            {
+                // the first level scans its block of values
+                const auto first = block << FirstLevel;
+                const auto last = std::min(this->size, first + (size_t { 1 } << FirstLevel));
+
+                size_t result = first;
+                for(size_t index = first + 1; index < last; ++index)
+                {
+                    result = this->Better(values, result, index);
+                }
+
+                this->levels[0][block] = static_cast<std::uint32_t>(result);
+                return;
+            }
+
+            const auto children = this->levels[level - FirstLevel - 1].size();
+            const auto child = 2 * block;
+
+            this->levels[level - FirstLevel][block] = static_cast<std::uint32_t>(child + 1 < children
+                    ? this->Better(values, this->IndexAt(level - 1, child), this->IndexAt(level - 1, child + 1))
+                    : this->IndexAt(level - 1, child));
+        }
+    };
+}
+
+#endif // RANGEEXTREMUM_H
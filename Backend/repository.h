@@ -18,12 +18,43 @@
 
 #include "deserializer.h"
 #include "entry.h"
+#include <atomic>
 
 #ifndef REPOSITORY_H
 #define REPOSITORY_H
 
 namespace Backend
 {
+    /*!
+     * \brief The EntryRevision struct describes how a collection of entries evolved,
+     *        so that a repository can tell which entries changed since it last saved them
+     *        without comparing the entries.
+     */
+    struct EntryRevision
+    {
+        /*!
+         * \brief Identifies the collection, which starts a new lineage whenever it is replaced as a whole.
+         *        The default of zero is never issued and stands for an unknown lineage.
+         */
+        unsigned long long lineage{}; //NOLINT(google-runtime-int)
+
+        /*!
+         * \brief The number of entries popped from the end of the collection so far.
+         */
+        unsigned long long pops{}; //NOLINT(google-runtime-int)
+
+        /*!
+         * \brief Creates the revision of a new collection, whose lineage differs from all others.
+         * \return The revision of a new collection.
+         */
+        [[nodiscard]] static EntryRevision New()
+        {
+            static std::atomic<unsigned long long> lastLineage; //NOLINT(google-runtime-int)
+
+            return EntryRevision { ++lastLineage, 0U };
+        }
+    };
+
     class Repository
     {
     public:
@@ -32,14 +63,27 @@ namespace Backend
          * \param game The entries to save.
          * \param identifier The identifier, which may be a file path if the underlying storage is the disk.
          */
-        virtual void Save(const std::vector<std::shared_ptr<Entry>> & entries, const std::u8string & identifier) = 0;
+        virtual void Save(const std::vector<Entry> & entries, const std::u8string & identifier) = 0;
 
         /*!
          * \brief Loads entries from storage.
          * \param identifier The identifier, which may be a file path if the underlying storage is the disk.
          * \return The loaded entries.
          */
-        virtual std::vector<std::shared_ptr<Entry>> Load(const std::u8string & identifier) = 0;
+        virtual std::vector<Entry> Load(const std::u8string & identifier) = 0;
+
+        /*!
+         * \brief Saves entries to the storage, which only changed by pushing and popping at the end
+         *        since they were saved under the same revision lineage.
+         *        Repositories may use this to store only the changes.
+         * \param entries The entries to save.
+         * \param revision The revision of the entries.
+         * \param identifier The identifier, which may be a file path if the underlying storage is the disk.
+         */
+        virtual void SaveRevision(const std::vector<Entry> & entries, const EntryRevision & /*revision*/, const std::u8string & identifier)
+        {
+            this->Save(entries, identifier);
+        }
     };
 }
 
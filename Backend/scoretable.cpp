@@ -0,0 +1,285 @@
+/*
+ * This file is part of QtDoppelKopf.
+ *
+ * QtDoppelKopf is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtDoppelKopf is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtDoppelKopf.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "scoretable.h"
+#include <algorithm>
+#include <limits>
+
+namespace Backend
+{
+    size_t ScoreTable::Rows() const
+    {
+        return this->rows;
+    }
+
+    size_t ScoreTable::Columns() const
+    {
+        return this->columns.size();
+    }
+
+    void ScoreTable::AddColumn()
+    {
+        auto & column = this->columns.emplace_back();
+
+        column.flags.resize(this->rows, 0U);
+        column.unmultipliedScores.resize(this->rows, 0);
+        column.totals.resize(this->rows, 0);
+        column.sumsBeforeBlock.resize((this->rows + RowsPerBlock - 1) / RowsPerBlock);
+
+        const Scores scores { column.totals };
+        for(size_t row = 0; row < this->rows; ++row)
+        {
+            column.maximalScores.PushBack(scores);
+            column.minimalScores.PushBack(scores);
+            column.maximalTotals.PushBack(column.totals);
+            column.minimalTotals.PushBack(column.totals);
+        }
+    }
+
+    void ScoreTable::PushRow()
+    {
+        const auto startsBlock = this->rows % RowsPerBlock == 0;
+
+        for(auto & column : this->columns)
+        {
+            if(startsBlock)
+            {
+                // the previous block is complete, as only the last row can be set
+                column.sumsBeforeBlock.push_back(ScoreTable::SumsBefore(column, this->rows));
+            }
+
+            column.flags.push_back(0U);
+            column.unmultipliedScores.push_back(0);
+            column.totals.push_back(this->rows > 0 ? column.totals.back() : 0);
+
+            const Scores scores { column.totals };
+            column.maximalScores.PushBack(scores);
+            column.minimalScores.PushBack(scores);
+            column.maximalTotals.PushBack(column.totals);
+            column.minimalTotals.PushBack(column.totals);
+        }
+
+        ++(this->rows);
+    }
+
+    void ScoreTable::PopRow()
+    {
+        --(this->rows);
+
+        const auto endsBlock = this->rows % RowsPerBlock == 0;
+
+        // the capacity is kept, so that pushing again does not allocate
+        for(auto & column : this->columns)
+        {
+            column.flags.pop_back();
+            column.unmultipliedScores.pop_back();
+            column.totals.pop_back();
+
+            if(endsBlock)
+            {
+                column.sumsBeforeBlock.pop_back();
+            }
+
+            const Scores scores { column.totals };
+            column.maximalScores.PopBack(scores);
+            column.minimalScores.PopBack(scores);
+            column.maximalTotals.PopBack(column.totals);
+            column.minimalTotals.PopBack(column.totals);
+        }
+    }
+
+    void ScoreTable::SetInLastRow(size_t column, int unmultipliedScore, int multipliedScore, bool playedSolo, bool hasInput)
+    {
+        const auto row = this->rows - 1;
+        auto & target = this->columns[column];
+
+        target.flags[row] = static_cast<std::uint8_t>(PlayedFlag | (playedSolo ? SoloFlag : 0U) | (hasInput ? InputFlag : 0U));
+        target.unmultipliedScores[row] = static_cast<std::int16_t>(unmultipliedScore);
+        target.totals[row] = (row > 0 ? target.totals[row - 1] : 0) + multipliedScore;
+
+        const Scores scores { target.totals };
+        target.maximalScores.UpdateBack(scores);
+        target.minimalScores.UpdateBack(scores);
+        target.maximalTotals.UpdateBack(target.totals);
+        target.minimalTotals.UpdateBack(target.totals);
+    }
+
+    bool ScoreTable::HasPlayed(size_t row, size_t column) const
+    {
+        return (this->columns[column].flags[row] & PlayedFlag) != 0U;
+    }
+
+    bool ScoreTable::PlayedSolo(size_t row, size_t column) const
+    {
+        return (this->columns[column].flags[row] & SoloFlag) != 0U;
+    }
+
+    bool ScoreTable::HasInput(size_t row, size_t column) const
+    {
+        return (this->columns[column].flags[row] & InputFlag) != 0U;
+    }
+
+    int ScoreTable::UnmultipliedScore(size_t row, size_t column) const
+    {
+        return this->columns[column].unmultipliedScores[row];
+    }
+
+    int ScoreTable::MultipliedScore(size_t row, size_t column) const
+    {
+        return Scores { this->columns[column].totals }[row];
+    }
+
+    int ScoreTable::Total(size_t row, size_t column) const
+    {
+        return this->columns[column].totals[row];
+    }
+
+    std::span<const std::int32_t> ScoreTable::Totals(size_t column) const
+    {
+        return this->columns[column].totals;
+    }
+
+    std::vector<ScoreTable::Point> ScoreTable::DecimatedTotals(size_t column, size_t begin, size_t end, size_t maximumPoints) const
+    {
+        const auto & source = this->columns[column];
+        end = std::min(end, this->rows);
+        maximumPoints = std::max(maximumPoints, size_t { 4 });
+
+        std::vector<Point> points;
+
+        if(begin >= end)
+        {
+            return points;
+        }
+
+        if(end - begin <= maximumPoints)
+        {
+            points.reserve(end - begin);
+            for(size_t row = begin; row < end; ++row)
+            {
+                points.push_back(Point { row, source.totals[row] });
+            }
+
+            return points;
+        }
+
+        // the buckets are aligned, so that moving the range keeps the points of the buckets inside it
+        size_t bucketSize = 2;
+        while(2 * ((end - 1) / bucketSize - begin / bucketSize + 1) > maximumPoints)
+        {
+            bucketSize *= 2;
+        }
+
+        points.reserve(2 * ((end - 1) / bucketSize - begin / bucketSize + 1));
+
+        for(size_t first = begin / bucketSize * bucketSize; first < end; first += bucketSize)
+        {
+            const auto last = std::min(first + bucketSize, this->rows);
+            const auto minimum = source.minimalTotals.Query(source.totals, first, last);
+            const auto maximum = source.maximalTotals.Query(source.totals, first, last);
+
+            points.push_back(Point { std::min(minimum, maximum), source.totals[std::min(minimum, maximum)] });
+
+            if(minimum != maximum)
+            {
+                points.push_back(Point { std::max(minimum, maximum), source.totals[std::max(minimum, maximum)] });
+            }
+        }
+
+        return points;
+    }
+
+    Statistics ScoreTable::StatisticsInRange(size_t column, size_t begin, size_t end) const
+    {
+        if(begin > end || end > this->rows)
+        {
+            throw std::exception("invalid range of deals");
+        }
+
+        if(begin == end)
+        {
+            return {};
+        }
+
+        const auto & source = this->columns[column];
+        const auto last = ScoreTable::SumsBefore(source, end);
+        const auto first = ScoreTable::SumsBefore(source, begin);
+        const Scores scores { source.totals };
+
+        return Statistics
+        {
+            last.numberGames - first.numberGames,
+            last.numberGamesWon - first.numberGamesWon,
+            last.numberGamesLost - first.numberGamesLost,
+            last.solosWon - first.solosWon,
+            last.solosLost - first.solosLost,
+            last.soloTotal - first.soloTotal,
+            last.unmultipliedTotal - first.unmultipliedTotal,
+            std::max(0, scores[source.maximalScores.Query(scores, begin, end)]),
+            std::min(0, scores[source.minimalScores.Query(scores, begin, end)]),
+            ScoreTable::SumBefore(source.totals, end) - ScoreTable::SumBefore(source.totals, begin),
+        };
+    }
+
+    bool ScoreTable::IsRepresentable(int unmultipliedScore)
+    {
+        return unmultipliedScore >= std::numeric_limits<std::int16_t>::min()
+                && unmultipliedScore <= std::numeric_limits<std::int16_t>::max();
+    }
+
+    ScoreTable::Sums ScoreTable::SumsBefore(const Column& column, size_t end)
+    {
+        if(end == 0)
+        {
+            return {};
+        }
+
+        const auto block = (end - 1) / RowsPerBlock;
+        const Scores scores { column.totals };
+        auto sums = column.sumsBeforeBlock[block];
+
+        for(size_t row = block * RowsPerBlock; row < end; ++row)
+        {
+            if((column.flags[row] & PlayedFlag) == 0U)
+            {
+                continue;
+            }
+
+            const int unmultipliedScore = column.unmultipliedScores[row];
+
+            ++(sums.numberGames);
+            sums.numberGamesWon += unmultipliedScore > 0 ? 1U : 0U;
+            sums.numberGamesLost += unmultipliedScore < 0 ? 1U : 0U;
+            sums.unmultipliedTotal += unmultipliedScore;
+
+            if((column.flags[row] & SoloFlag) != 0U)
+            {
+                sums.solosWon += unmultipliedScore > 0 ? 1U : 0U;
+                sums.solosLost += unmultipliedScore < 0 ? 1U : 0U;
+                sums.soloTotal += scores[row];
+            }
+        }
+
+        return sums;
+    }
+
+    std::int32_t ScoreTable::SumBefore(const std::vector<std::int32_t>& totals, size_t end)
+    {
+        return end > 0 ? totals[end - 1] : 0;
+    }
+}
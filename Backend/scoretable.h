@@ -0,0 +1,233 @@
+/*
+ * This file is part of QtDoppelKopf.
+ *
+ * QtDoppelKopf is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtDoppelKopf is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtDoppelKopf.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SCORETABLE_H
+#define SCORETABLE_H
+
+#include "rangeextremum.h"
+#include "statistics.h"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Backend
+{
+    /*!
+     * \brief The ScoreTable class stores the results of all players in all deals,
+     *        with one row per deal and one column per player.
+     *        Each column is stored contiguously in separate arrays for the flags, the unmultiplied scores in 16 bits
+     *        and the running totals, so that the history of a player can be handed out without copying.
+     *        Next to the results, each column keeps the sums of the counters before each block of rows
+     *        and an index of the extremes of the scores, so that the statistics over any range of deals
+     *        only scan the rows within the blocks at its ends.
+     *        An index of the extremes of the totals gives a decimated history of any range with a bounded number of points.
+     *        Thus a cell takes about 8 bytes.
+     */
+    class ScoreTable
+    {
+    public:
+        /*!
+         * \brief The Point struct holds the total of a player after the deal of a row.
+         */
+        struct Point
+        {
+            size_t row{};
+            std::int32_t total{};
+
+            bool operator==(const Point& other) const = default;
+        };
+
+    private:
+        static constexpr std::uint8_t PlayedFlag = 1U;
+        static constexpr std::uint8_t SoloFlag = 2U;
+        static constexpr std::uint8_t InputFlag = 4U;
+
+        static constexpr size_t RowsPerBlock = 64U;
+
+        /*!
+         * \brief The Sums struct holds the counters and the sums of the scores over the rows before a row.
+         */
+        struct Sums
+        {
+            std::uint32_t numberGames{};
+            std::uint32_t numberGamesWon{};
+            std::uint32_t numberGamesLost{};
+            std::uint32_t solosWon{};
+            std::uint32_t solosLost{};
+            std::int32_t unmultipliedTotal{};
+            std::int32_t soloTotal{};
+        };
+
+        struct Column
+        {
+            std::vector<std::uint8_t> flags;
+            std::vector<std::int16_t> unmultipliedScores;
+            std::vector<std::int32_t> totals;
+            std::vector<Sums> sumsBeforeBlock;
+            RangeExtremum<std::int32_t, std::less<>> maximalScores;
+            RangeExtremum<std::int32_t, std::greater<>> minimalScores;
+            RangeExtremum<std::int32_t, std::less<>> maximalTotals;
+            RangeExtremum<std::int32_t, std::greater<>> minimalTotals;
+        };
+
+        /*!
+         * \brief The Scores struct reads the change in score of each deal from the running totals.
+         */
+        struct Scores
+        {
+            std::span<const std::int32_t> totals;
+
+            std::int32_t operator[](size_t row) const
+            {
+                return this->totals[row] - (row > 0 ? this->totals[row - 1] : 0);
+            }
+        };
+
+        size_t rows{};
+        std::vector<Column> columns;
+
+    public:
+        /*!
+         * \brief Gets the number of rows, i.e. deals.
+         * \return The number of rows.
+         */
+        [[nodiscard]] size_t Rows() const;
+
+        /*!
+         * \brief Gets the number of columns, i.e. players.
+         * \return The number of columns.
+         */
+        [[nodiscard]] size_t Columns() const;
+
+        /*!
+         * \brief Appends a column, in which the player did not play in any of the existing rows.
+         */
+        void AddColumn();
+
+        /*!
+         * \brief Appends a row, in which no player played and all totals are carried over.
+         */
+        void PushRow();
+
+        /*!
+         * \brief Removes the last row, which must exist.
+         */
+        void PopRow();
+
+        /*!
+         * \brief Records that the player played in the last row, which must exist.
+         * \param column The column of the player.
+         * \param unmultipliedScore The change in score, which must be representable.
+         * \param multipliedScore The change in score after applying the multiplier.
+         * \param playedSolo Value indicating whether the player played solo.
+         * \param hasInput Value indicating whether the score was given rather than completed.
+         */
+        void SetInLastRow(size_t column, int unmultipliedScore, int multipliedScore, bool playedSolo, bool hasInput);
+
+        /*!
+         * \brief Gets a value indicating whether the player played in the deal.
+         * \param row The row of the deal.
+         * \param column The column of the player.
+         * \return A value indicating whether the player played in the deal.
+         */
+        [[nodiscard]] bool HasPlayed(size_t row, size_t column) const;
+
+        /*!
+         * \brief Gets a value indicating whether the player played solo in the deal.
+         * \param row The row of the deal.
+         * \param column The column of the player.
+         * \return A value indicating whether the player played solo in the deal.
+         */
+        [[nodiscard]] bool PlayedSolo(size_t row, size_t column) const;
+
+        /*!
+         * \brief Gets a value indicating whether the score of the player was given rather than completed.
+         * \param row The row of the deal.
+         * \param column The column of the player.
+         * \return A value indicating whether the score of the player was given.
+         */
+        [[nodiscard]] bool HasInput(size_t row, size_t column) const;
+
+        /*!
+         * \brief Gets the change in score without applying the multiplier.
+         * \param row The row of the deal.
+         * \param column The column of the player.
+         * \return The change in score without applying the multiplier.
+         */
+        [[nodiscard]] int UnmultipliedScore(size_t row, size_t column) const;
+
+        /*!
+         * \brief Gets the change in score after applying the multiplier.
+         * \param row The row of the deal.
+         * \param column The column of the player.
+         * \return The change in score after applying the multiplier.
+         */
+        [[nodiscard]] int MultipliedScore(size_t row, size_t column) const;
+
+        /*!
+         * \brief Gets the score of the player after the deal.
+         * \param row The row of the deal.
+         * \param column The column of the player.
+         * \return The score of the player after the deal.
+         */
+        [[nodiscard]] int Total(size_t row, size_t column) const;
+
+        /*!
+         * \brief Gets the scores of the player after each deal.
+         * \param column The column of the player.
+         * \return The scores of the player after each deal, valid until the table is changed.
+         */
+        [[nodiscard]] std::span<const std::int32_t> Totals(size_t column) const;
+
+        /*!
+         * \brief Gets the totals of the player over a range of deals with a bounded number of points.
+         *        If the range holds more rows than allowed, the rows are split into aligned buckets,
+         *        whose size is the smallest sufficient power of two, and the minimum and the maximum of each bucket
+         *        are given in the order of their rows. The buckets at the ends of the range may extend beyond it.
+         * \param column The column of the player.
+         * \param begin The row of the first deal in the range.
+         * \param end The row after the last deal in the range, which is limited to the rows.
+         * \param maximumPoints The maximal number of points, which is raised to four if smaller.
+         * \return The points ordered by their rows.
+         */
+        [[nodiscard]] std::vector<Point> DecimatedTotals(size_t column, size_t begin, size_t end, size_t maximumPoints) const;
+
+        /*!
+         * \brief Gets the statistics of the player over a range of deals in O(log n), scanning at most two blocks of rows.
+         * \param column The column of the player.
+         * \param begin The row of the first deal in the range.
+         * \param end The row after the last deal in the range, which must not be before begin or after the last row.
+         * \return The statistics of the player over the range of deals.
+         */
+        [[nodiscard]] Statistics StatisticsInRange(size_t column, size_t begin, size_t end) const;
+
+        /*!
+         * \brief Gets a value indicating whether an unmultiplied score fits into the table.
+         * \param unmultipliedScore The score to check.
+         * \return A value indicating whether the score fits into the table.
+         */
+        [[nodiscard]] static bool IsRepresentable(int unmultipliedScore);
+
+    private:
+        [[nodiscard]] static Sums SumsBefore(const Column& column, size_t end);
+        [[nodiscard]] static std::int32_t SumBefore(const std::vector<std::int32_t>& totals, size_t end);
+    };
+}
+
+#endif // SCORETABLE_H
@@ -16,12 +16,29 @@
  *
  */
 
-#include "cashcalculation.h"
+#ifndef STATISTICS_H
+#define STATISTICS_H
 
-unsigned int Backend::CalculateCashCents(unsigned int pointDifference)
+namespace Backend
 {
-    const unsigned int PointToCentConversionNumerator = 1;
-    const unsigned int PointToCentConversionDenominator = 2;
+    /*!
+     * \brief The Statistics struct holds the statistics of a player over a range of deals.
+     */
+    struct Statistics
+    {
+        unsigned int numberGames{};
+        unsigned int numberGamesWon{};
+        unsigned int numberGamesLost{};
+        unsigned int solosWon{};
+        unsigned int solosLost{};
+        int totalSoloPoints{};
+        int unmultipliedScore{};
+        int maxSingleWin{};
+        int maxSingleLoss{};
+        int scoreDelta{};
 
-    return pointDifference * PointToCentConversionNumerator / PointToCentConversionDenominator;
+        bool operator==(const Statistics& other) const = default;
+    };
 }
+
+#endif // STATISTICS_H
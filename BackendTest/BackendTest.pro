@@ -29,12 +29,17 @@ CONFIG += console c++20 thread
 CONFIG -= app_bundle
 
 HEADERS += \
+    tst_changeset.h \
     tst_deserializer.h \
     tst_diskrepository.h \
     tst_gameinfo.h \
+    tst_journalrepository.h \
+    tst_largetable.h \
     tst_memoryrepository.h \
     tst_multiplierinfo.h \
-    tst_playerinfo.h
+    tst_playerinfo.h \
+    tst_rangeextremum.h \
+    tst_scoretable.h
 
 SOURCES += \
         main.cpp
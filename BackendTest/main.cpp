@@ -18,12 +18,17 @@
 
 #include <gtest/gtest.h>
 
+#include "tst_changeset.h"
 #include "tst_deserializer.h"
 #include "tst_diskrepository.h"
 #include "tst_gameinfo.h"
+#include "tst_journalrepository.h"
+#include "tst_largetable.h"
 #include "tst_memoryrepository.h"
 #include "tst_multiplierinfo.h"
 #include "tst_playerinfo.h"
+#include "tst_rangeextremum.h"
+#include "tst_scoretable.h"
 
 int main(int argc, char *argv[])
 {
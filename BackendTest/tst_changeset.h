@@ -0,0 +1,154 @@
+/*
+ * This file is part of QtDoppelKopf.
+ *
+ * QtDoppelKopf is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtDoppelKopf is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtDoppelKopf.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef TST_CHANGESET_H
+#define TST_CHANGESET_H
+
+#include "../Backend/changeset.h"
+#include "../Backend/gameinfo.h"
+#include "../TestHelper/memoryrepository.h"
+#include <atomic>
+#include <cstdlib>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <memory>
+#include <new>
+#include <numeric>
+
+namespace AllocationCounter
+{
+    inline std::atomic<bool> isCounting { false }; //NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+    inline std::atomic<size_t> count { 0 }; //NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+    inline void Start()
+    {
+        count = 0;
+        isCounting = true;
+    }
+
+    inline size_t Stop()
+    {
+        isCounting = false;
+        return count;
+    }
+}
+
+// the replacement is defined here, as this header is only included by main.cpp
+void* operator new(std::size_t size)
+{
+    if(AllocationCounter::isCounting)
+    {
+        ++AllocationCounter::count;
+    }
+
+    if(void* memory = std::malloc(size == 0 ? 1 : size)) //NOLINT(cppcoreguidelines-no-malloc, hicpp-no-malloc)
+    {
+        return memory;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory); //NOLINT(cppcoreguidelines-no-malloc, hicpp-no-malloc)
+}
+
+void operator delete(void* memory, std::size_t /*size*/) noexcept
+{
+    std::free(memory); //NOLINT(cppcoreguidelines-no-malloc, hicpp-no-malloc)
+}
+
+TEST(BackendTest, ChangeSetShallHoldUpToFourChanges) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
+{
+    // Arrange
+    Backend::ChangeSet<unsigned int> changes { std::make_pair(2U, 3), std::make_pair(0U, -1) };
+
+    // Act
+    changes.emplace_back(1U, -1);
+    changes.push_back(std::make_pair(3U, -1));
+
+    // Assert
+    ASSERT_EQ(4U, changes.size());
+    EXPECT_FALSE(changes.empty());
+    EXPECT_EQ(2U, changes[0].first);
+    EXPECT_EQ(3, changes[0].second);
+    EXPECT_EQ(3U, changes[3].first);
+    EXPECT_EQ(0, std::accumulate(changes.begin(), changes.end(), 0, [](int sum, const std::pair<unsigned int, int>& change){ return sum + change.second; }));
+
+    EXPECT_THROW( //NOLINT(cppcoreguidelines-avoid-goto, hicpp-avoid-goto)
+    {
+        try
+        {
+            changes.emplace_back(4U, 0);
+        }
+        catch( const std::exception& e )
+        {
+            EXPECT_STREQ("there can never be more than 4 or zero changes", e.what());
+            throw;
+        }
+    }, std::exception);
+
+    EXPECT_EQ(4U, changes.size());
+}
+
+TEST(BackendTest, GameInfoShallOnlyAllocateForGrowthWhenPushingDeals) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
+{
+    // Arrange
+    // the names exceed the small string buffer, so that each copy of a name allocates
+    const std::vector<std::string> names { "Alexandra Hamilton", "Bernadette Peterson", "Christopher Columbus", "Dominique Fontaine" };
+    Backend::GameInfo gameInfo(std::make_shared<MemoryRepository>());
+    gameInfo.SetPlayers(names, names[0], {});
+
+    // the events fill the multiplier journal as well
+    const std::vector<std::pair<std::vector<std::pair<std::string, int>>, unsigned int>> deals
+    {
+        { { std::make_pair(names[0], 1), std::make_pair(names[1], 1) }, 0U },
+        { { std::make_pair(names[0], -3) }, 2U },
+        { { std::make_pair(names[0], 2), std::make_pair(names[1], -2), std::make_pair(names[2], 2), std::make_pair(names[3], -2) }, 1U },
+        { { std::make_pair(names[2], -1), std::make_pair(names[3], -1) }, 3U },
+    };
+
+    constexpr size_t NumberOfDeals = 4096U;
+
+    // the capacities of all containers are larger than the deals pushed so far, so that only few of them grow
+    for(size_t index = 0; index < NumberOfDeals; ++index)
+    {
+        const auto & [deal, numberOfEvents] = deals[index % deals.size()];
+        gameInfo.PushDeal(deal, numberOfEvents);
+    }
+
+    // Act
+    AllocationCounter::Start();
+
+    for(size_t index = 0; index < NumberOfDeals; ++index)
+    {
+        const auto & [deal, numberOfEvents] = deals[index % deals.size()];
+        gameInfo.PushDeal(deal, numberOfEvents);
+    }
+
+    auto allocations = AllocationCounter::Stop();
+
+    // Assert
+    // the deals are stored by the positions of the players, the containers double their capacity when growing
+    EXPECT_LT(allocations, NumberOfDeals / 8U);
+    EXPECT_EQ(2U * NumberOfDeals, gameInfo.DealsRecorded());
+    EXPECT_EQ(2U * NumberOfDeals, gameInfo.PlayerInfos()[0]->ScoreHistory().size());
+}
+
+#endif // TST_CHANGESET_H
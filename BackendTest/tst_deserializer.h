@@ -30,9 +30,9 @@ TEST(BackendTest, SerializationOfEntriesShallWorkCorrectly) //NOLINT (cert-err58
     // Arrange
     std::stringstream ss;
     Backend::DeSerializer ds;
-    std::vector<std::shared_ptr<Backend::Entry>> entries;
+    std::vector<Backend::Entry> entries;
 
-    entries.push_back(std::make_shared<Backend::PlayersSet>(
+    entries.push_back(Backend::PlayersSet(
                           std::vector<std::string>
                           {
                               "A",
@@ -46,17 +46,17 @@ TEST(BackendTest, SerializationOfEntriesShallWorkCorrectly) //NOLINT (cert-err58
                           "C",
                           std::set<unsigned int> { 2, 4 },
                           "Z"));
-    entries.push_back(std::make_shared<Backend::Deal>(
-                          std::vector<std::pair<std::string, int>>
+    entries.push_back(Backend::Deal(
+                          Backend::ChangeSet<unsigned int>
                           {
-                              std::make_pair<std::string, int>("A", 1),
-                              std::make_pair<std::string, int>("B", 1),
-                              std::make_pair<std::string, int>("C", -1),
-                              std::make_pair<std::string, int>("D", -1)
+                              std::make_pair(0U, 1),
+                              std::make_pair(1U, 1),
+                              std::make_pair(2U, -1),
+                              std::make_pair(3U, -1)
                           },
                           Backend::NumberOfEvents(2),
                           Backend::Players(7)));
-    entries.push_back(std::make_shared<Backend::MandatorySoloTrigger>());
+    entries.push_back(Backend::MandatorySoloTrigger());
 
     // Act
     ds.Serialize(entries, ss);
@@ -102,6 +102,58 @@ TEST(BackendTest, SerializationOfEntriesShallWorkCorrectly) //NOLINT (cert-err58
     EXPECT_TRUE(std::regex_search(result, mandatorySoloTriggerKindRegex));
 }
 
+TEST(BackendTest, SerializationOfEntriesShallGiveExactOutput) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
+{
+    // Arrange
+    std::stringstream ss;
+    Backend::DeSerializer ds;
+    std::vector<Backend::Entry> entries;
+
+    entries.push_back(Backend::PlayersSet(
+                          std::vector<std::string>
+                          {
+                              "A",
+                              "B",
+                              "C",
+                              "D",
+                              "E",
+                              "F",
+                              "文字",
+                          },
+                          "C",
+                          std::set<unsigned int> { 2, 4 },
+                          "Z"));
+    entries.push_back(Backend::Deal(
+                          Backend::ChangeSet<unsigned int>
+                          {
+                              std::make_pair(0U, 1),
+                              std::make_pair(1U, 1),
+                              std::make_pair(6U, -1),
+                              std::make_pair(3U, -1)
+                          },
+                          Backend::NumberOfEvents(2),
+                          Backend::Players(7)));
+    entries.push_back(Backend::MandatorySoloTrigger());
+    entries.push_back(Backend::PlayersSet(
+                          std::vector<std::string>
+                          {
+                              "A",
+                              "B",
+                              "C",
+                              "D",
+                          },
+                          "A",
+                          std::set<unsigned int> { },
+                          ""));
+
+    // Act
+    ds.Serialize(entries, ss);
+
+    // Assert
+    const char * expected = R"foo({"dataVersion":"2","data":[{"kind":"playersSet","playerNames":["A","B","C","D","E","F","\u6587\u5B57"],"dealerName":"C","sitOutScheme":[2,4],"previousDealerName":"Z"},{"kind":"deal","players":7,"numberOfEvents":2,"changes":[{"name":"A","diff":1},{"name":"B","diff":1},{"name":"\u6587\u5B57","diff":-1},{"name":"D","diff":-1}]},{"kind":"mandatorySoloTrigger"},{"kind":"playersSet","playerNames":["A","B","C","D"],"dealerName":"A","sitOutScheme":[],"previousDealerName":""}]})foo";
+    EXPECT_STREQ(expected, ss.str().c_str());
+}
+
 TEST(BackendTest, DeserializationOfEntriesShallWorkCorrectly) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
 {
     // Arrange
@@ -168,27 +220,27 @@ TEST(BackendTest, DeserializationOfEntriesShallWorkCorrectly) //NOLINT (cert-err
     // Assert
     ASSERT_EQ(3, result.size());
 
-    auto playersSet = std::static_pointer_cast<Backend::PlayersSet>(result[0]);
-    EXPECT_THAT(playersSet->Players(), ::testing::ElementsAre(std::string("A"), std::string("B"), std::string("C"), std::string("D"), std::string("E"), std::string("F"), std::string("G")));
-    EXPECT_STREQ("C", playersSet->Dealer().c_str());
-    EXPECT_THAT(playersSet->SitOutScheme(), ::testing::ElementsAre(2, 4));
-    EXPECT_STREQ("B", playersSet->PreviousDealer().c_str());
-
-    auto deal = std::static_pointer_cast<Backend::Deal>(result[1]);
-    EXPECT_EQ(7, deal->Players().Value());
-    EXPECT_EQ(2, deal->NumberOfEvents().Value());
-    auto changes = deal->Changes();
-    EXPECT_STREQ("A", changes[0].first.c_str());
-    EXPECT_STREQ("B", changes[1].first.c_str());
-    EXPECT_STREQ("C", changes[2].first.c_str());
-    EXPECT_STREQ("D", changes[3].first.c_str());
+    const auto & playersSet = result[0].Get<Backend::PlayersSet>();
+    EXPECT_THAT(playersSet.Players(), ::testing::ElementsAre(std::string("A"), std::string("B"), std::string("C"), std::string("D"), std::string("E"), std::string("F"), std::string("G")));
+    EXPECT_STREQ("C", playersSet.Dealer().c_str());
+    EXPECT_THAT(playersSet.SitOutScheme(), ::testing::ElementsAre(2, 4));
+    EXPECT_STREQ("B", playersSet.PreviousDealer().c_str());
+
+    const auto & deal = result[1].Get<Backend::Deal>();
+    EXPECT_EQ(7, deal.Players().Value());
+    EXPECT_EQ(2, deal.NumberOfEvents().Value());
+    auto changes = deal.Changes();
+    EXPECT_EQ(0U, changes[0].first);
+    EXPECT_EQ(1U, changes[1].first);
+    EXPECT_EQ(2U, changes[2].first);
+    EXPECT_EQ(3U, changes[3].first);
     EXPECT_EQ( 1, changes[0].second);
     EXPECT_EQ( 1, changes[1].second);
     EXPECT_EQ(-1, changes[2].second);
     EXPECT_EQ(-1, changes[3].second);
 
     auto mandatorySoloTrigger = result[2];
-    EXPECT_EQ(Backend::Entry::Kind::MandatorySoloTrigger, mandatorySoloTrigger->Kind());
+    EXPECT_EQ(Backend::Entry::Kind::MandatorySoloTrigger, mandatorySoloTrigger.Kind());
 }
 
 TEST(BackendTest, DeserializationRoundtripShallWorkCorrectly) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
@@ -196,9 +248,9 @@ TEST(BackendTest, DeserializationRoundtripShallWorkCorrectly) //NOLINT (cert-err
     // Arrange
     std::stringstream ss;
     Backend::DeSerializer ds;
-    std::vector<std::shared_ptr<Backend::Entry>> entries;
+    std::vector<Backend::Entry> entries;
 
-    entries.push_back(std::make_shared<Backend::PlayersSet>(
+    entries.push_back(Backend::PlayersSet(
                           std::vector<std::string>
                           {
                               "A",
@@ -212,17 +264,17 @@ TEST(BackendTest, DeserializationRoundtripShallWorkCorrectly) //NOLINT (cert-err
                           "C",
                           std::set<unsigned int> { 2, 4 },
                           "Z"));
-    entries.push_back(std::make_shared<Backend::Deal>(
-                          std::vector<std::pair<std::string, int>>
+    entries.push_back(Backend::Deal(
+                          Backend::ChangeSet<unsigned int>
                           {
-                              std::make_pair<std::string, int>("A", 1),
-                              std::make_pair<std::string, int>("B", 1),
-                              std::make_pair<std::string, int>("C", -1),
-                              std::make_pair<std::string, int>("D", -1)
+                              std::make_pair(0U, 1),
+                              std::make_pair(1U, 1),
+                              std::make_pair(2U, -1),
+                              std::make_pair(3U, -1)
                           },
                           Backend::NumberOfEvents(2),
                           Backend::Players(7)));
-    entries.push_back(std::make_shared<Backend::MandatorySoloTrigger>());
+    entries.push_back(Backend::MandatorySoloTrigger());
 
     // Act
     ds.Serialize(entries, ss);
@@ -233,27 +285,174 @@ TEST(BackendTest, DeserializationRoundtripShallWorkCorrectly) //NOLINT (cert-err
     // Assert
     ASSERT_EQ(3, result.size());
 
-    auto playersSet = std::static_pointer_cast<Backend::PlayersSet>(result[0]);
-    EXPECT_THAT(playersSet->Players(), ::testing::ElementsAre(std::string("A"), std::string("B"), std::string("C"), std::string("D"), std::string("E"), std::string("F"), std::string("G")));
-    EXPECT_STREQ("C", playersSet->Dealer().c_str());
-    EXPECT_THAT(playersSet->SitOutScheme(), ::testing::ElementsAre(2, 4));
-    EXPECT_STREQ("Z", playersSet->PreviousDealer().c_str());
-
-    auto deal = std::static_pointer_cast<Backend::Deal>(result[1]);
-    EXPECT_EQ(7, deal->Players().Value());
-    EXPECT_EQ(2, deal->NumberOfEvents().Value());
-    auto changes = deal->Changes();
-    EXPECT_STREQ("A", changes[0].first.c_str());
-    EXPECT_STREQ("B", changes[1].first.c_str());
-    EXPECT_STREQ("C", changes[2].first.c_str());
-    EXPECT_STREQ("D", changes[3].first.c_str());
+    const auto & playersSet = result[0].Get<Backend::PlayersSet>();
+    EXPECT_THAT(playersSet.Players(), ::testing::ElementsAre(std::string("A"), std::string("B"), std::string("C"), std::string("D"), std::string("E"), std::string("F"), std::string("G")));
+    EXPECT_STREQ("C", playersSet.Dealer().c_str());
+    EXPECT_THAT(playersSet.SitOutScheme(), ::testing::ElementsAre(2, 4));
+    EXPECT_STREQ("Z", playersSet.PreviousDealer().c_str());
+
+    const auto & deal = result[1].Get<Backend::Deal>();
+    EXPECT_EQ(7, deal.Players().Value());
+    EXPECT_EQ(2, deal.NumberOfEvents().Value());
+    auto changes = deal.Changes();
+    EXPECT_EQ(0U, changes[0].first);
+    EXPECT_EQ(1U, changes[1].first);
+    EXPECT_EQ(2U, changes[2].first);
+    EXPECT_EQ(3U, changes[3].first);
     EXPECT_EQ( 1, changes[0].second);
     EXPECT_EQ( 1, changes[1].second);
     EXPECT_EQ(-1, changes[2].second);
     EXPECT_EQ(-1, changes[3].second);
 
     auto mandatorySoloTrigger = result[2];
-    EXPECT_EQ(Backend::Entry::Kind::MandatorySoloTrigger, mandatorySoloTrigger->Kind());
+    EXPECT_EQ(Backend::Entry::Kind::MandatorySoloTrigger, mandatorySoloTrigger.Kind());
+}
+
+TEST(BackendTest, BinaryDeserializationRoundtripShallWorkCorrectly) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
+{
+    // Arrange
+    std::stringstream ss;
+    Backend::DeSerializer ds;
+    std::vector<Backend::Entry> entries;
+
+    entries.push_back(Backend::PlayersSet(
+                          std::vector<std::string>
+                          {
+                              "A",
+                              "B",
+                              "C",
+                              "D",
+                              "E",
+                              "F",
+                              "文字",
+                          },
+                          "C",
+                          std::set<unsigned int> { 2, 4, 9 },
+                          ""));
+    entries.push_back(Backend::Deal(
+                          Backend::ChangeSet<unsigned int>
+                          {
+                              std::make_pair(0U, 300),
+                              std::make_pair(6U, 1),
+                              std::make_pair(2U, -1),
+                              std::make_pair(3U, -300)
+                          },
+                          Backend::NumberOfEvents(2),
+                          Backend::Players(7)));
+    entries.push_back(Backend::MandatorySoloTrigger());
+
+    // Act
+    ds.SerializeBinary(entries, ss);
+    auto result = ds.Deserialize(ss);
+
+    entries.clear();
+
+    // Assert
+    ASSERT_EQ(3, result.size());
+
+    const auto & playersSet = result[0].Get<Backend::PlayersSet>();
+    EXPECT_THAT(playersSet.Players(), ::testing::ElementsAre(std::string("A"), std::string("B"), std::string("C"), std::string("D"), std::string("E"), std::string("F"), std::string("文字")));
+    EXPECT_STREQ("C", playersSet.Dealer().c_str());
+    EXPECT_THAT(playersSet.SitOutScheme(), ::testing::ElementsAre(2, 4, 9));
+    EXPECT_STREQ("", playersSet.PreviousDealer().c_str());
+
+    const auto & deal = result[1].Get<Backend::Deal>();
+    EXPECT_EQ(7, deal.Players().Value());
+    EXPECT_EQ(2, deal.NumberOfEvents().Value());
+    auto changes = deal.Changes();
+    EXPECT_EQ(0U, changes[0].first);
+    EXPECT_EQ(6U, changes[1].first);
+    EXPECT_EQ(2U, changes[2].first);
+    EXPECT_EQ(3U, changes[3].first);
+    EXPECT_EQ( 300, changes[0].second);
+    EXPECT_EQ(   1, changes[1].second);
+    EXPECT_EQ(  -1, changes[2].second);
+    EXPECT_EQ(-300, changes[3].second);
+
+    auto mandatorySoloTrigger = result[2];
+    EXPECT_EQ(Backend::Entry::Kind::MandatorySoloTrigger, mandatorySoloTrigger.Kind());
+}
+
+TEST(BackendTest, BinarySerializationShallBeMuchSmallerThanJson) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
+{
+    // Arrange
+    std::stringstream json;
+    std::stringstream binary;
+    Backend::DeSerializer ds;
+    std::vector<Backend::Entry> entries;
+
+    entries.push_back(Backend::PlayersSet(
+                          std::vector<std::string> { "Alexander", "Bernadette", "Christopher", "Dominique", "Elisabeth" },
+                          "Alexander",
+                          std::set<unsigned int> {},
+                          ""));
+
+    for(int index = 0; index < 100; ++index)
+    {
+        entries.push_back(Backend::Deal(
+                              Backend::ChangeSet<unsigned int>
+                              {
+                                  std::make_pair(0U, index),
+                                  std::make_pair(1U, index),
+                                  std::make_pair(2U, -index),
+                                  std::make_pair(3U, -index)
+                              },
+                              Backend::NumberOfEvents(index % 3),
+                              Backend::Players(5)));
+    }
+
+    // Act
+    ds.Serialize(entries, json);
+    ds.SerializeBinary(entries, binary);
+
+    // Assert
+    EXPECT_LT(binary.str().size() * 10U, json.str().size());
+}
+
+struct TestBinaryDeserializationErrorResult
+{
+    std::string testname;
+    std::string data;
+    std::string message;
+    friend std::ostream& operator<<(std::ostream& wos, const TestBinaryDeserializationErrorResult& obj)
+    {
+        return wos
+                << "testname: " << obj.testname
+                << " message: " << obj.message;
+    }
+};
+
+class BinaryDeserializationErrorMessageTest : public testing::TestWithParam<TestBinaryDeserializationErrorResult>
+{
+};
+
+INSTANTIATE_TEST_SUITE_P(BackendTest, BinaryDeserializationErrorMessageTest, // clazy:exclude=non-pod-global-static //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, fuchsia-statically-constructed-objects)
+    testing::Values(
+    TestBinaryDeserializationErrorResult{"BadMagic", std::string("\x89QDX\x01\x00\x00", 7), "no valid binary header found"},
+    TestBinaryDeserializationErrorResult{"BadVersion", std::string("\x89QDK\x02\x00\x00", 7), "unsupported binary version"},
+    TestBinaryDeserializationErrorResult{"Truncated", std::string("\x89QDK\x01\x01\x05" "AB", 9), "unexpected end of binary data"},
+    TestBinaryDeserializationErrorResult{"UnknownKind", std::string("\x89QDK\x01\x00\x01\x07", 8), "unknown kind value in binary data: 7"},
+    TestBinaryDeserializationErrorResult{"NameIndex", std::string("\x89QDK\x01\x01\x01" "A" "\x01\x01\x04\x00\x01\x01\x05\x02", 16), "name index out of range in binary data"},
+    TestBinaryDeserializationErrorResult{"TrailingData", std::string("\x89QDK\x01\x00\x01\x02\x02", 9), "unexpected data after binary entries"}
+    ));
+
+TEST_P(BinaryDeserializationErrorMessageTest, GivenBadBinaryDeserializationShallGiveErrorMessage) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
+{
+    // Arrange
+    auto testData = GetParam();
+    std::stringstream ss(testData.data);
+    Backend::DeSerializer ds;
+
+    // Act, Assert
+    try
+    {
+        ds.Deserialize(ss);
+        FAIL() << "no exception thrown";
+    }
+    catch (const std::exception & exception)
+    {
+        EXPECT_STREQ(testData.message.c_str(), exception.what());
+    }
 }
 
 struct TestDeserializationErrorResult
@@ -321,4 +520,103 @@ TEST_P(DeserializationErrorTest, GivenBadJsonDeserializationShallGiveError) //NO
     EXPECT_THROW({ auto result = ds.Deserialize(ss); }, std::exception); //NOLINT(cppcoreguidelines-avoid-goto, hicpp-avoid-goto)
 }
 
+struct TestDeserializationErrorMessageResult
+{
+    std::string testname;
+    std::string json;
+    std::string message;
+    friend std::ostream& operator<<(std::ostream& wos, const TestDeserializationErrorMessageResult& obj)
+    {
+        return wos
+                << "testname: " << obj.testname
+                << " json: " << obj.json
+                << " message: " << obj.message;
+    }
+};
+
+class DeserializationErrorMessageTest : public testing::TestWithParam<TestDeserializationErrorMessageResult>
+{
+};
+
+INSTANTIATE_TEST_SUITE_P(BackendTest, DeserializationErrorMessageTest, // clazy:exclude=non-pod-global-static //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, fuchsia-statically-constructed-objects)
+    testing::Values(
+    TestDeserializationErrorMessageResult{"NotJson", R"foo({"dataVersion":"2","data":[)foo", "did not parse to object"},
+    TestDeserializationErrorMessageResult{"NotObject", R"foo([])foo", "did not parse to object"},
+    TestDeserializationErrorMessageResult{"DataVersionNotCorrect", R"foo({"data":[false],"dataVersion":"1"})foo", "no valid data version found"},
+    TestDeserializationErrorMessageResult{"NoDataMember", R"foo({"dataVersion":"2"})foo", "no valid data member found"},
+    TestDeserializationErrorMessageResult{"InvalidDataMember", R"foo({"dataVersion":"2","data":{}})foo", "no valid data member found"},
+    TestDeserializationErrorMessageResult{"EntryNotObject", R"foo({"dataVersion":"2","data":[[{"kind":"deal"}]]})foo", "entry is not object"},
+    TestDeserializationErrorMessageResult{"NoKindMember", R"foo({"dataVersion":"2","data":[{"nokind":""}]})foo", "missing kind in entry"},
+    TestDeserializationErrorMessageResult{"InvalidKindMember", R"foo({"dataVersion":"2","data":[{"kind":{"kind":"deal"}}]})foo", "kind is not string"},
+    TestDeserializationErrorMessageResult{"UnknownKindMember", R"foo({"dataVersion":"2","data":[{"kind":"invalid"}]})foo", "unknown kind value in data: \"invalid\""},
+    TestDeserializationErrorMessageResult{"FirstErrorWins", R"foo({"dataVersion":"2","data":[{"kind":"mandatorySoloTrigger"},{"kind":"invalid"},false]})foo", "unknown kind value in data: \"invalid\""},
+    TestDeserializationErrorMessageResult{"NoPlayerNamesMember", R"foo({"dataVersion":"2","data":[{"kind":"playersSet","dealerName":"C","sitOutScheme":[2,4],"previousDealerName":"B"}]})foo", "no member playerNames"},
+    TestDeserializationErrorMessageResult{"PlayerNameNotString", R"foo({"dataVersion":"2","data":[{"kind":"playersSet","playerNames":["A",["B"],"C","D","E","F","G"],"dealerName":"C","sitOutScheme":[2,4],"previousDealerName":"B"}]})foo", "player name is not a string"},
+    TestDeserializationErrorMessageResult{"InvalidDealerMember", R"foo({"dataVersion":"2","data":[{"kind":"playersSet","playerNames":["A","B","C","D","E","F","G"],"dealerName":{},"sitOutScheme":[2,4],"previousDealerName":"B"}]})foo", "dealerName is not string"},
+    TestDeserializationErrorMessageResult{"SitOutSchemeItemNotInt", R"foo({"dataVersion":"2","data":[{"kind":"playersSet","playerNames":["A","B","C","D","E","F","G"],"dealerName":"C","sitOutScheme":[1,5.1],"previousDealerName":"B"}]})foo", "sit out scheme item is not an int"},
+    TestDeserializationErrorMessageResult{"NoPreviousDealerMember", R"foo({"dataVersion":"2","data":[{"kind":"playersSet","playerNames":["A","B","C","D","E","F","G"],"dealerName":"C","sitOutScheme":[1,3]}]})foo", "no member previousDealerName"},
+    TestDeserializationErrorMessageResult{"InvalidPlayersMember", R"foo({"dataVersion":"2","data":[{"kind":"deal","players":4294967295,"numberOfEvents":2,"changes":[]}]})foo", "players is not int"},
+    TestDeserializationErrorMessageResult{"NoNumberOfEventsMember", R"foo({"dataVersion":"2","data":[{"kind":"deal","players":7,"changes":[]}]})foo", "no member numberOfEvents"},
+    TestDeserializationErrorMessageResult{"InvalidChangesMember", R"foo({"dataVersion":"2","data":[{"kind":"deal","players":7,"numberOfEvents":2,"changes":{}}]})foo", "changes is not array"},
+    TestDeserializationErrorMessageResult{"ChangesItemNotObject", R"foo({"dataVersion":"2","data":[{"kind":"deal","players":7,"numberOfEvents":2,"changes":[true,{"name":"B","diff":1}]}]})foo", "changes item is not an object"},
+    TestDeserializationErrorMessageResult{"ChangesItemNoName", R"foo({"dataVersion":"2","data":[{"kind":"deal","players":7,"numberOfEvents":2,"changes":[{"diff":1}]}]})foo", "changes item does not have a name member"},
+    TestDeserializationErrorMessageResult{"ChangesItemNameNotString", R"foo({"dataVersion":"2","data":[{"kind":"deal","players":7,"numberOfEvents":2,"changes":[{"name":42,"diff":1}]}]})foo", "change member name is not a string"},
+    TestDeserializationErrorMessageResult{"ChangesItemNoDiff", R"foo({"dataVersion":"2","data":[{"kind":"deal","players":7,"numberOfEvents":2,"changes":[{"name":"A"}]}]})foo", "changes item does not have a diff member"},
+    TestDeserializationErrorMessageResult{"ChangesItemDiffNotInt", R"foo({"dataVersion":"2","data":[{"kind":"deal","players":7,"numberOfEvents":2,"changes":[{"name":"A","diff":{"diff":1}}]}]})foo", "change member diff is not an int"},
+    TestDeserializationErrorMessageResult{"ChangesItemWithoutPlayersSet", R"foo({"dataVersion":"2","data":[{"kind":"deal","players":4,"numberOfEvents":0,"changes":[{"name":"A","diff":1}]}]})foo", "found change for unknown player: \"A\""},
+    TestDeserializationErrorMessageResult{"ChangesItemUnknownPlayer", R"foo({"dataVersion":"2","data":[{"kind":"playersSet","playerNames":["A","B","C","D"],"dealerName":"A","sitOutScheme":[],"previousDealerName":""},{"kind":"deal","players":4,"numberOfEvents":0,"changes":[{"name":"A","diff":1},{"name":"X","diff":1}]}]})foo", "found change for unknown player: \"X\""}
+    ));
+
+TEST_P(DeserializationErrorMessageTest, GivenBadJsonDeserializationShallGiveErrorMessage) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
+{
+    // Arrange
+    TestDeserializationErrorMessageResult tdemr = GetParam();
+    std::stringstream ss;
+    ss << tdemr.json;
+    ss.seekg(0, std::ios::beg);
+
+    Backend::DeSerializer ds;
+
+    // Act, Assert
+    EXPECT_THROW( //NOLINT(cppcoreguidelines-avoid-goto, hicpp-avoid-goto)
+    {
+        try
+        {
+            auto result = ds.Deserialize(ss);
+        }
+        catch( const std::exception& e )
+        {
+            EXPECT_STREQ(tdemr.message.c_str(), e.what());
+            throw;
+        }
+    }, std::exception);
+}
+
+TEST(BackendTest, DeserializationShallIgnoreMemberOrderAndUnknownMembers) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
+{
+    // Arrange
+    const char * json = R"foo({"data":[{"kind":"playersSet","playerNames":["A","B","C","D"],"dealerName":"A","sitOutScheme":[],"previousDealerName":""},{"changes":[{"diff":-2,"name":"B","extra":[1,{"name":"X"}]},{"name":"C","diff":2}],"numberOfEvents":1,"unknown":{"kind":"playersSet"},"players":4,"kind":"deal"}],"comment":["data"],"dataVersion":"2"})foo";
+
+    std::stringstream ss;
+    ss << json;
+
+    Backend::DeSerializer ds;
+
+    // Act
+    auto result = ds.Deserialize(ss);
+
+    // Assert
+    ASSERT_EQ(2, result.size());
+
+    const auto & deal = result[1].Get<Backend::Deal>();
+    EXPECT_EQ(4, deal.Players().Value());
+    EXPECT_EQ(1, deal.NumberOfEvents().Value());
+    auto changes = deal.Changes();
+    ASSERT_EQ(2, changes.size());
+    EXPECT_EQ(1U, changes[0].first);
+    EXPECT_EQ(2U, changes[1].first);
+    EXPECT_EQ(-2, changes[0].second);
+    EXPECT_EQ( 2, changes[1].second);
+}
+
 #endif // TST_DESERIALIZER_H
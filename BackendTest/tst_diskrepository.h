@@ -17,6 +17,7 @@
  */
 
 #include "../Backend/diskrepository.h"
+#include "../Backend/gameinfo.h"
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include <filesystem>
@@ -30,9 +31,9 @@ TEST(BackendTest, DiskRepositoryShallCorrectlyRoundtripGame) //NOLINT (cert-err5
 {
     // Arrange
     auto tempFile = std::filesystem::temp_directory_path() / std::filesystem::path(u8"qtdoppelkopf.testing.文字.temp.file");
-    std::vector<std::shared_ptr<Backend::Entry>> entries;
+    std::vector<Backend::Entry> entries;
 
-    entries.push_back(std::make_shared<Backend::PlayersSet>(
+    entries.push_back(Backend::PlayersSet(
                           std::vector<std::string>
                           {
                               "A",
@@ -46,17 +47,17 @@ TEST(BackendTest, DiskRepositoryShallCorrectlyRoundtripGame) //NOLINT (cert-err5
                           "C",
                           std::set<unsigned int> { 2, 4 },
                           "Z"));
-    entries.push_back(std::make_shared<Backend::Deal>(
-                          std::vector<std::pair<std::string, int>>
+    entries.push_back(Backend::Deal(
+                          Backend::ChangeSet<unsigned int>
                           {
-                              std::make_pair<std::string, int>("A", 1),
-                              std::make_pair<std::string, int>("B", 1),
-                              std::make_pair<std::string, int>("C", -1),
-                              std::make_pair<std::string, int>("D", -1)
+                              std::make_pair(0U, 1),
+                              std::make_pair(1U, 1),
+                              std::make_pair(2U, -1),
+                              std::make_pair(3U, -1)
                           },
                           Backend::NumberOfEvents(2),
                           Backend::Players(7)));
-    entries.push_back(std::make_shared<Backend::MandatorySoloTrigger>());
+    entries.push_back(Backend::MandatorySoloTrigger());
 
     Backend::DiskRepository repo;
     auto id = tempFile.u8string();
@@ -68,33 +69,198 @@ TEST(BackendTest, DiskRepositoryShallCorrectlyRoundtripGame) //NOLINT (cert-err5
     // Assert
     ASSERT_EQ(3, entries.size());
 
-    auto playersSet = std::static_pointer_cast<Backend::PlayersSet>(result[0]);
-    EXPECT_THAT(playersSet->Players(), ::testing::ElementsAre(std::string("A"), std::string("B"), std::string("C"), std::string("D"), std::string("E"), std::string("F"), std::string("文字")));
-    EXPECT_STREQ("C", playersSet->Dealer().c_str());
-    EXPECT_THAT(playersSet->SitOutScheme(), ::testing::ElementsAre(2, 4));
-    EXPECT_STREQ("Z", playersSet->PreviousDealer().c_str());
-
-    auto deal = std::static_pointer_cast<Backend::Deal>(result[1]);
-    EXPECT_EQ(7, deal->Players().Value());
-    EXPECT_EQ(2, deal->NumberOfEvents().Value());
-    auto changes = deal->Changes();
-    EXPECT_STREQ("A", changes[0].first.c_str());
-    EXPECT_STREQ("B", changes[1].first.c_str());
-    EXPECT_STREQ("C", changes[2].first.c_str());
-    EXPECT_STREQ("D", changes[3].first.c_str());
+    const auto & playersSet = result[0].Get<Backend::PlayersSet>();
+    EXPECT_THAT(playersSet.Players(), ::testing::ElementsAre(std::string("A"), std::string("B"), std::string("C"), std::string("D"), std::string("E"), std::string("F"), std::string("文字")));
+    EXPECT_STREQ("C", playersSet.Dealer().c_str());
+    EXPECT_THAT(playersSet.SitOutScheme(), ::testing::ElementsAre(2, 4));
+    EXPECT_STREQ("Z", playersSet.PreviousDealer().c_str());
+
+    const auto & deal = result[1].Get<Backend::Deal>();
+    EXPECT_EQ(7, deal.Players().Value());
+    EXPECT_EQ(2, deal.NumberOfEvents().Value());
+    auto changes = deal.Changes();
+    EXPECT_EQ(0U, changes[0].first);
+    EXPECT_EQ(1U, changes[1].first);
+    EXPECT_EQ(2U, changes[2].first);
+    EXPECT_EQ(3U, changes[3].first);
     EXPECT_EQ( 1, changes[0].second);
     EXPECT_EQ( 1, changes[1].second);
     EXPECT_EQ(-1, changes[2].second);
     EXPECT_EQ(-1, changes[3].second);
 
     auto mandatorySoloTrigger = result[2];
-    EXPECT_EQ(Backend::Entry::Kind::MandatorySoloTrigger, mandatorySoloTrigger->Kind());
+    EXPECT_EQ(Backend::Entry::Kind::MandatorySoloTrigger, mandatorySoloTrigger.Kind());
+
+    if(std::filesystem::exists(tempFile) && !std::filesystem::is_directory(tempFile))
+    {
+        std::filesystem::remove(tempFile);
+    }
+}
+TEST(BackendTest, DiskRepositoryShallLoadBinaryFormatByMagicNumber) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
+{
+    // Arrange
+    auto tempFile = std::filesystem::temp_directory_path() / std::filesystem::path(u8"qtdoppelkopf.testing.binary.文字.temp.file");
+    std::vector<Backend::Entry> entries;
+
+    entries.push_back(Backend::PlayersSet(
+                          std::vector<std::string> { "A", "B", "C", "D", "文字" },
+                          "C",
+                          std::set<unsigned int> {},
+                          ""));
+    entries.push_back(Backend::Deal(
+                          Backend::ChangeSet<unsigned int>
+                          {
+                              std::make_pair(0U, 1),
+                              std::make_pair(4U, 1),
+                              std::make_pair(2U, -1),
+                              std::make_pair(3U, -1)
+                          },
+                          Backend::NumberOfEvents(1),
+                          Backend::Players(5)));
+
+    Backend::DiskRepository binaryRepo(Backend::DeSerializer::Format::Binary);
+    Backend::DiskRepository defaultRepo;
+    auto id = tempFile.u8string();
+
+    // Act
+    binaryRepo.Save(entries, id);
+    auto result = defaultRepo.Load(id);
+
+    // Assert
+    ASSERT_EQ(2, result.size());
+
+    const auto & playersSet = result[0].Get<Backend::PlayersSet>();
+    EXPECT_THAT(playersSet.Players(), ::testing::ElementsAre(std::string("A"), std::string("B"), std::string("C"), std::string("D"), std::string("文字")));
+
+    const auto & deal = result[1].Get<Backend::Deal>();
+    EXPECT_EQ(1, deal.NumberOfEvents().Value());
+    auto changes = deal.Changes();
+    EXPECT_EQ(4U, changes[1].first);
+    EXPECT_EQ(-1, changes[3].second);
+
+    if(std::filesystem::exists(tempFile) && !std::filesystem::is_directory(tempFile))
+    {
+        std::filesystem::remove(tempFile);
+    }
+}
+static void ExpectSameGameState(const Backend::GameInfo & expected, const Backend::GameInfo & actual)
+{
+    auto expectedInfos = expected.PlayerInfos();
+    auto actualInfos = actual.PlayerInfos();
+    ASSERT_EQ(expectedInfos.size(), actualInfos.size());
+
+    for(size_t index = 0; index < expectedInfos.size(); ++index)
+    {
+        EXPECT_EQ(expectedInfos[index]->Name(), actualInfos[index]->Name());
+        EXPECT_EQ(expectedInfos[index]->IsPresent(), actualInfos[index]->IsPresent());
+        EXPECT_EQ(expectedInfos[index]->IsPlaying(), actualInfos[index]->IsPlaying());
+        EXPECT_THAT(actualInfos[index]->ScoreHistory(), ::testing::ElementsAreArray(expectedInfos[index]->ScoreHistory()));
+        EXPECT_EQ(expectedInfos[index]->InputInLastDeal(), actualInfos[index]->InputInLastDeal());
+        EXPECT_EQ(expectedInfos[index]->NumberGames(), actualInfos[index]->NumberGames());
+        EXPECT_EQ(expectedInfos[index]->SolosWon(), actualInfos[index]->SolosWon());
+        EXPECT_EQ(expectedInfos[index]->UnmultipliedScore(), actualInfos[index]->UnmultipliedScore());
+    }
+
+    EXPECT_EQ(expected.Dealer()->Name(), actual.Dealer()->Name());
+    EXPECT_EQ(expected.MultiplierPreview(), actual.MultiplierPreview());
+    EXPECT_EQ(expected.MandatorySolo(), actual.MandatorySolo());
+    EXPECT_EQ(expected.RemainingGamesInRound(), actual.RemainingGamesInRound());
+    EXPECT_EQ(expected.LastPoppableEntry(), actual.LastPoppableEntry());
+    EXPECT_EQ(expected.CompletedRounds(), actual.CompletedRounds());
+}
+
+TEST(BackendTest, DiskRepositoryShallRestoreGameFromBinaryFormat) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
+{
+    // Arrange
+    auto tempFile = std::filesystem::temp_directory_path() / std::filesystem::path(u8"qtdoppelkopf.testing.binary.game.temp.file");
+    auto id = tempFile.u8string();
+    auto repository = std::make_shared<Backend::DiskRepository>(Backend::DeSerializer::Format::Binary);
+
+    Backend::GameInfo gameInfo(repository);
+    gameInfo.SetPlayers({"A", "B", "C", "D", "E"}, "A", std::set<unsigned int> {});
+    gameInfo.PushDeal({ std::make_pair<std::string, int>("B", 2), std::make_pair<std::string, int>("C", 2) }, 1U);
+    gameInfo.PushDeal({ std::make_pair<std::string, int>("C", -3) }, 0U);
+    gameInfo.TriggerMandatorySolo();
+    gameInfo.PushDeal({ std::make_pair<std::string, int>("A", 3), std::make_pair<std::string, int>("D", 3) }, 2U);
+    gameInfo.SetPlayers({"A", "B", "C", "F"}, "B", std::set<unsigned int> {});
+    gameInfo.PushDeal({ std::make_pair<std::string, int>("F", 1), std::make_pair<std::string, int>("A", 1) }, 0U);
+
+    // Act
+    gameInfo.SaveTo(id);
+
+    Backend::GameInfo loaded(repository);
+    loaded.LoadFrom(id);
+
+    // Assert
+    ExpectSameGameState(gameInfo, loaded);
+
+    // the loaded game undoes the same way
+    while(gameInfo.LastPoppableEntry() != Backend::GameInfo::PoppableEntry::None)
+    {
+        gameInfo.PopLastEntry();
+        loaded.PopLastEntry();
+        ExpectSameGameState(gameInfo, loaded);
+    }
 
     if(std::filesystem::exists(tempFile) && !std::filesystem::is_directory(tempFile))
     {
         std::filesystem::remove(tempFile);
     }
 }
+
+TEST(BackendTest, DiskRepositoryShallRestoreCompletedRoundsFromBinaryFormat) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
+{
+    // Arrange
+    auto tempFile = std::filesystem::temp_directory_path() / std::filesystem::path(u8"qtdoppelkopf.testing.binary.rounds.temp.file");
+    auto id = tempFile.u8string();
+    auto repository = std::make_shared<Backend::DiskRepository>(Backend::DeSerializer::Format::Binary);
+
+    Backend::GameInfo gameInfo(repository);
+    gameInfo.SetPlayers({"A", "B", "C", "D"}, "A", std::set<unsigned int> {});
+    for(int index = 0; index < 6; ++index) //NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    {
+        gameInfo.PushDeal({ std::make_pair<std::string, int>("A", index + 1), std::make_pair<std::string, int>("B", index + 1) }, 0U);
+    }
+
+    gameInfo.SetPlayers({"A", "B", "C", "D", "E"}, "C", std::set<unsigned int> {});
+    for(int index = 0; index < 6; ++index) //NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    {
+        std::vector<std::pair<std::string, int>> changes;
+        for(const auto & playerInfo : gameInfo.PlayerInfosView())
+        {
+            if(playerInfo.IsPlaying() && changes.size() < 2)
+            {
+                changes.emplace_back(playerInfo.Name(), 1);
+            }
+        }
+
+        gameInfo.PushDeal(changes, 0U);
+    }
+
+    ASSERT_EQ((std::vector<Backend::GameInfo::Round> { { 0U, 4U }, { 6U, 11U } }), gameInfo.CompletedRounds());
+
+    // Act
+    gameInfo.SaveTo(id);
+
+    Backend::GameInfo loaded(repository);
+    loaded.LoadFrom(id);
+
+    // Assert
+    ExpectSameGameState(gameInfo, loaded);
+
+    while(gameInfo.LastPoppableEntry() != Backend::GameInfo::PoppableEntry::None)
+    {
+        gameInfo.PopLastEntry();
+        loaded.PopLastEntry();
+        ExpectSameGameState(gameInfo, loaded);
+    }
+
+    if(std::filesystem::exists(tempFile) && !std::filesystem::is_directory(tempFile))
+    {
+        std::filesystem::remove(tempFile);
+    }
+}
+
 #endif // _USE_LONG_TEST
 
 #endif // TST_DISKREPOSITORY_H
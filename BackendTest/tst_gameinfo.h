@@ -21,6 +21,7 @@
 
 #include "../Backend/gameinfo.h"
 #include "../TestHelper/memoryrepository.h"
+#include <array>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include <memory>
@@ -208,6 +209,22 @@ TEST(BackendTest, GameInfoShallThrowOnSettingBadPlayerNames) //NOLINT (cert-err5
             throw;
         }
     }, std::exception );
+
+    EXPECT_THROW( //NOLINT(cppcoreguidelines-avoid-goto, hicpp-avoid-goto)
+    {
+        try
+        {
+            gameInfo.SetPlayers({"A", "B", "C", "D", "E", "F", "G"}, "A", std::set<unsigned int> { 3U, 7U });
+        }
+        catch( const std::exception& e )
+        {
+            EXPECT_STREQ("position in the sit out scheme out of range", e.what());
+            throw;
+        }
+    }, std::exception );
+
+    // the implied position of the dealer is accepted, as older files may list it
+    EXPECT_NO_THROW(gameInfo.SetPlayers({"A", "B", "C", "D", "E", "F"}, "A", std::set<unsigned int> { 0U }));
 }
 
 TEST(BackendTest, GameInfoShallCorrectlyReportIfPlayersWereSet) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
@@ -723,6 +740,41 @@ TEST(BackendTest, GameInfoShallCorrectlyPushDealAfterPopping) //NOLINT (cert-err
     EXPECT_EQ(Backend::GameInfo::PoppableEntry::Deal, gameInfo.LastPoppableEntry());
 }
 
+TEST(BackendTest, GameInfoShallTrackEntryQueriesThroughPushAndPop) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
+{
+    // Arrange
+    Backend::GameInfo gameInfo(std::make_shared<MemoryRepository>());
+    gameInfo.SetPlayers({"A", "B", "C", "D"}, "A", std::set<unsigned int> {});
+    gameInfo.PushDeal({ std::make_pair<std::string, int>("B", 1), std::make_pair<std::string, int>("C", 1) }, 1U);
+    gameInfo.TriggerMandatorySolo();
+    gameInfo.SetPlayers({"A", "B", "C", "D", "E"}, "C", std::set<unsigned int> {});
+    gameInfo.PushDeal({ std::make_pair<std::string, int>("A", 1), std::make_pair<std::string, int>("B", 1) }, 2U);
+
+    // Act, Assert
+    EXPECT_TRUE(gameInfo.HasPlayersSet());
+    EXPECT_EQ(2U, gameInfo.LastNumberOfEvents());
+    EXPECT_EQ(Backend::GameInfo::PoppableEntry::Deal, gameInfo.LastPoppableEntry());
+
+    gameInfo.PopLastEntry();
+    EXPECT_EQ(1U, gameInfo.LastNumberOfEvents());
+    EXPECT_EQ(Backend::GameInfo::PoppableEntry::PlayersSet, gameInfo.LastPoppableEntry());
+
+    gameInfo.PopLastEntry();
+    EXPECT_STREQ("B", gameInfo.Dealer()->Name().c_str());
+    EXPECT_EQ(Backend::GameInfo::MandatorySolo::Active, gameInfo.MandatorySolo());
+    EXPECT_EQ(Backend::GameInfo::PoppableEntry::MandatorySoloTrigger, gameInfo.LastPoppableEntry());
+
+    gameInfo.PopLastEntry();
+    EXPECT_EQ(Backend::GameInfo::MandatorySolo::Ready, gameInfo.MandatorySolo());
+    EXPECT_EQ(Backend::GameInfo::PoppableEntry::Deal, gameInfo.LastPoppableEntry());
+
+    gameInfo.PopLastEntry();
+    EXPECT_TRUE(gameInfo.HasPlayersSet());
+    EXPECT_EQ(0U, gameInfo.LastNumberOfEvents());
+    EXPECT_EQ(Backend::GameInfo::MandatorySolo::CannotTrigger, gameInfo.MandatorySolo());
+    EXPECT_EQ(Backend::GameInfo::PoppableEntry::None, gameInfo.LastPoppableEntry());
+}
+
 TEST(BackendTest, GameInfoShallCorrectlyPopAllKindsOfEntries) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
 {
     // Arrange
@@ -1603,9 +1655,9 @@ TEST(BackendTest, GameInfoShallCorrectlySaveToRepository) //NOLINT (cert-err58-c
 TEST(BackendTest, GameInfoShallCorrectlyLoadFromRepository) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
 {
     // Arrange
-    std::vector<std::shared_ptr<Backend::Entry>> entries;
+    std::vector<Backend::Entry> entries;
 
-    entries.push_back(std::make_shared<Backend::PlayersSet>(
+    entries.push_back(Backend::PlayersSet(
                           std::vector<std::string>
                           {
                               "A",
@@ -1619,17 +1671,17 @@ TEST(BackendTest, GameInfoShallCorrectlyLoadFromRepository) //NOLINT (cert-err58
                           "C",
                           std::set<unsigned int> { 2, 4 },
                           ""));
-    entries.push_back(std::make_shared<Backend::Deal>(
-                          std::vector<std::pair<std::string, int>>
+    entries.push_back(Backend::Deal(
+                          Backend::ChangeSet<unsigned int>
                           {
-                              std::make_pair<std::string, int>("A", 1),
-                              std::make_pair<std::string, int>("B", 1),
-                              std::make_pair<std::string, int>("D", -1),
-                              std::make_pair<std::string, int>("F", -1)
+                              std::make_pair(0U, 1),
+                              std::make_pair(1U, 1),
+                              std::make_pair(3U, -1),
+                              std::make_pair(5U, -1)
                           },
                           Backend::NumberOfEvents(2),
                           Backend::Players(7)));
-    entries.push_back(std::make_shared<Backend::MandatorySoloTrigger>());
+    entries.push_back(Backend::MandatorySoloTrigger());
 
     auto repository = std::make_shared<MemoryRepository>();
     std::u8string id(u8"some Id");
@@ -1791,6 +1843,141 @@ TEST(BackendTest, GameInfoShallCorrectlyHandleBadLoad) //NOLINT (cert-err58-cpp,
     EXPECT_EQ(Backend::GameInfo::MandatorySolo::Active, mandatorySolo);
 }
 
+TEST(BackendTest, GameInfoShallLeaveStateUntouchedWhenLoadedEntriesFail) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
+{
+    // Arrange
+    auto repository = std::make_shared<MemoryRepository>();
+    std::u8string id(u8"some Id");
+    std::string content(R"foo({"dataVersion":"2","data":[{"kind":"playersSet","playerNames":["A","B","C","D"],"dealerName":"A","sitOutScheme":[],"previousDealerName":""},{"kind":"deal","players":4,"numberOfEvents":0,"changes":[{"name":"A","diff":1},{"name":"X","diff":1}]}]})foo");
+    repository->SetByIdentifier(id, content);
+
+    Backend::GameInfo gameInfo(repository);
+    gameInfo.SetPlayers({"E", "F", "G", "H", "I"}, "F", std::set<unsigned int> {});
+    gameInfo.PushDeal(std::vector<std::pair<std::string, int>>
+                      {
+                          std::make_pair<std::string, int>("E", 2),
+                          std::make_pair<std::string, int>("G", 2),
+                      }, 1U);
+
+    auto playerInfos = gameInfo.PlayerInfos();
+
+    // Act
+    EXPECT_THROW(gameInfo.LoadFrom(id), std::exception);
+
+    // Assert
+    auto afterInfos = gameInfo.PlayerInfos();
+    ASSERT_EQ(playerInfos.size(), afterInfos.size());
+    for(size_t index = 0; index < playerInfos.size(); ++index)
+    {
+        EXPECT_EQ(playerInfos[index], afterInfos[index]);
+        EXPECT_EQ(1U, afterInfos[index]->ScoreHistory().size());
+    }
+
+    EXPECT_EQ(2, playerInfos[0]->CurrentScore());
+    EXPECT_EQ(0, playerInfos[1]->CurrentScore());
+    EXPECT_EQ(-2, playerInfos[3]->CurrentScore());
+    EXPECT_STREQ("G", gameInfo.Dealer()->Name().c_str());
+    EXPECT_EQ(Backend::GameInfo::PoppableEntry::Deal, gameInfo.LastPoppableEntry());
+
+    gameInfo.PopLastEntry();
+    EXPECT_EQ(0, playerInfos[0]->CurrentScore());
+    EXPECT_STREQ("F", gameInfo.Dealer()->Name().c_str());
+}
+
+TEST(BackendTest, GameInfoShallReplaceAllStateOnLoad) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
+{
+    // Arrange
+    auto repository = std::make_shared<MemoryRepository>();
+    std::u8string id(u8"some Id");
+
+    Backend::GameInfo saved(repository);
+    saved.SetPlayers({"A", "B", "C", "D"}, "B", std::set<unsigned int> {});
+    saved.PushDeal(std::vector<std::pair<std::string, int>>
+                   {
+                       std::make_pair<std::string, int>("A", 1),
+                       std::make_pair<std::string, int>("B", 1),
+                   }, 0U);
+    saved.SaveTo(id);
+
+    Backend::GameInfo gameInfo(repository);
+    gameInfo.SetPlayers({"A", "E", "F", "G", "H"}, "E", std::set<unsigned int> {});
+    gameInfo.PushDeal(std::vector<std::pair<std::string, int>>
+                      {
+                          std::make_pair<std::string, int>("A", 2),
+                          std::make_pair<std::string, int>("F", 2),
+                      }, 2U);
+    gameInfo.PushDeal(std::vector<std::pair<std::string, int>>
+                      {
+                          std::make_pair<std::string, int>("A", 2),
+                          std::make_pair<std::string, int>("G", 2),
+                      }, 0U);
+
+    auto playerA = gameInfo.PlayerInfos()[0];
+
+    // Act
+    gameInfo.LoadFrom(id);
+
+    // Assert
+    auto playerInfos = gameInfo.PlayerInfos();
+    ASSERT_EQ(4U, playerInfos.size());
+    EXPECT_STREQ("A", playerInfos[0]->Name().c_str());
+    EXPECT_STREQ("D", playerInfos[3]->Name().c_str());
+    EXPECT_EQ(playerA, playerInfos[0]);
+    EXPECT_THAT(playerInfos[0]->ScoreHistory(), ::testing::ElementsAre(1));
+    EXPECT_THAT(playerInfos[3]->ScoreHistory(), ::testing::ElementsAre(-1));
+    EXPECT_STREQ("C", gameInfo.Dealer()->Name().c_str());
+    EXPECT_EQ(saved.MultiplierPreview(), gameInfo.MultiplierPreview());
+    EXPECT_EQ(3U, gameInfo.RemainingGamesInRound());
+}
+
+TEST(BackendTest, GameInfoShallDetachPlayersMissingInLoadedGame) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
+{
+    // Arrange
+    auto repository = std::make_shared<MemoryRepository>();
+    std::u8string id(u8"some Id");
+
+    Backend::GameInfo saved(repository);
+    saved.SetPlayers({"A", "B", "C", "D"}, "B", std::set<unsigned int> {});
+    saved.PushDeal(std::vector<std::pair<std::string, int>>
+                   {
+                       std::make_pair<std::string, int>("A", 1),
+                       std::make_pair<std::string, int>("B", 1),
+                   }, 0U);
+    saved.SaveTo(id);
+
+    Backend::GameInfo gameInfo(repository);
+    gameInfo.SetPlayers({"A", "E", "F", "G", "H"}, "E", std::set<unsigned int> {});
+    gameInfo.PushDeal(std::vector<std::pair<std::string, int>>
+                      {
+                          std::make_pair<std::string, int>("A", 2),
+                          std::make_pair<std::string, int>("H", 2),
+                      }, 0U);
+
+    auto playerA = gameInfo.PlayerInfos()[0];
+    auto playerH = gameInfo.PlayerInfos()[4];
+    ASSERT_TRUE(playerH->ParticipatedInLastDeal());
+
+    // Act
+    gameInfo.LoadFrom(id);
+
+    // Assert
+    EXPECT_FALSE(playerA->IsDetached());
+    EXPECT_THAT(playerA->ScoreHistory(), ::testing::ElementsAre(1));
+
+    EXPECT_TRUE(playerH->IsDetached());
+    EXPECT_STREQ("H", playerH->Name().c_str());
+    EXPECT_FALSE(playerH->IsPresent());
+    EXPECT_FALSE(playerH->IsPlaying());
+    EXPECT_FALSE(playerH->HasPlayed());
+    EXPECT_FALSE(playerH->ParticipatedInLastDeal());
+    EXPECT_EQ(0, playerH->CurrentScore());
+    EXPECT_EQ(0U, playerH->CashCents());
+    EXPECT_TRUE(playerH->ScoreHistory().empty());
+    EXPECT_TRUE(playerH->DecimatedScoreHistory(0U, 10U, 4U).empty());
+    EXPECT_EQ(0U, playerH->Statistics().numberGames);
+    EXPECT_EQ(0U, playerH->StatisticsOfLastDeals(5U).numberGames);
+}
+
 TEST(BackendTest, GameInfoShallCorrectlyReportRemainingGamesInRound) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
 {
     // Arrange
@@ -1911,6 +2098,106 @@ TEST(BackendTest, GameInfoShallCorrectlyReportRemainingGamesInRoundAfterPoppingP
     EXPECT_EQ(2U, remaining7);
 }
 
+TEST(BackendTest, GameInfoShallKeepStandingsUpToDateThroughPushAndPop) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
+{
+    // Arrange
+    Backend::GameInfo gameInfo(std::make_shared<MemoryRepository>());
+    gameInfo.SetPlayers({"A", "B", "C", "D"}, "A", {});
+    auto playerInfos = gameInfo.PlayerInfos();
+
+    // Act
+    gameInfo.PushDeal(std::vector<std::pair<std::string, int>>
+                      {
+                          std::make_pair<std::string, int>("A", 3),
+                          std::make_pair<std::string, int>("B", 3),
+                      }, 0U);
+    gameInfo.SetPlayers({"A", "B", "C", "D", "E"}, "B", {2});
+    auto playerInfosWithE = gameInfo.PlayerInfos();
+    auto totalWithE = gameInfo.TotalCashCents();
+    auto absentWithE = gameInfo.AbsentPlayerCashCents();
+    auto cashOfEWithE = playerInfosWithE[4]->CashCents();
+    gameInfo.PopLastEntry();
+    auto totalWithoutE = gameInfo.TotalCashCents();
+    auto absentWithoutE = gameInfo.AbsentPlayerCashCents();
+    auto cashOfCWithoutE = playerInfos[2]->CashCents();
+    gameInfo.PopLastEntry();
+
+    // Assert
+    EXPECT_EQ(1U, absentWithE);
+    EXPECT_EQ(1U, cashOfEWithE);
+    EXPECT_EQ(3U + 3U + 1U + 3U * 1U, totalWithE);
+    EXPECT_EQ(1U, absentWithoutE);
+    EXPECT_EQ(3U, cashOfCWithoutE);
+    EXPECT_EQ(3U + 3U + 4U * 1U, totalWithoutE);
+
+    for(const auto & playerInfo : playerInfos)
+    {
+        EXPECT_EQ(0U, playerInfo->CashCents());
+    }
+
+    EXPECT_EQ(0U, gameInfo.AbsentPlayerCashCents());
+    EXPECT_EQ(0U, gameInfo.TotalCashCents());
+}
+
+TEST(BackendTest, GameInfoShallRejectInvalidDealWithoutChangingScores) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
+{
+    // Arrange
+    Backend::GameInfo gameInfo(std::make_shared<MemoryRepository>());
+    gameInfo.SetPlayers({"A", "B", "C", "D", "E"}, "E", {});
+    auto playerInfos = gameInfo.PlayerInfos();
+
+    // Act, Assert
+    EXPECT_THROW( //NOLINT(cppcoreguidelines-avoid-goto, hicpp-avoid-goto)
+    {
+        try
+        {
+            gameInfo.PushDeal(std::vector<std::pair<std::string, int>>
+                         {
+                             std::make_pair<std::string, int>("A", 1),
+                             std::make_pair<std::string, int>("Z", 1),
+                         }, 0U);
+        }
+        catch( const std::exception& e )
+        {
+            EXPECT_STREQ("found change for unknown player: \"Z\"", e.what());
+            throw;
+        }
+    }, std::exception);
+
+    EXPECT_THROW( //NOLINT(cppcoreguidelines-avoid-goto, hicpp-avoid-goto)
+    {
+        gameInfo.PushDeal(std::vector<std::pair<std::string, int>>
+                     {
+                         std::make_pair<std::string, int>("A", 1),
+                         std::make_pair<std::string, int>("B", 1),
+                         std::make_pair<std::string, int>("C", -1),
+                         std::make_pair<std::string, int>("E", -1),
+                     }, 0U);
+    }, std::exception);
+
+    EXPECT_EQ(Backend::GameInfo::PoppableEntry::None, gameInfo.LastPoppableEntry());
+
+    for(const auto & playerInfo : playerInfos)
+    {
+        EXPECT_EQ(0, playerInfo->CurrentScore());
+        EXPECT_FALSE(playerInfo->HasPlayed());
+    }
+
+    gameInfo.PushDeal(std::vector<std::pair<std::string, int>>
+                      {
+                          std::make_pair<std::string, int>("A", 1),
+                          std::make_pair<std::string, int>("B", 1),
+                      }, 0U);
+
+    EXPECT_EQ( 1, playerInfos[0]->CurrentScore());
+    EXPECT_EQ( 1, playerInfos[1]->CurrentScore());
+    EXPECT_EQ(-1, playerInfos[2]->CurrentScore());
+    EXPECT_EQ(-1, playerInfos[3]->CurrentScore());
+    EXPECT_EQ( 0, playerInfos[4]->CurrentScore());
+    EXPECT_STREQ("1", playerInfos[0]->InputInLastDeal().c_str());
+    EXPECT_STREQ("", playerInfos[2]->InputInLastDeal().c_str());
+}
+
 TEST(BackendTest, GameInfoShallHandleNoPlayersSet) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
 {
     // Arrange
@@ -1935,4 +2222,172 @@ TEST(BackendTest, GameInfoShallHandleNoPlayersSet) //NOLINT (cert-err58-cpp, cpp
     EXPECT_EQ(0U, remaingingGamesInRound);
 }
 
+TEST(BackendTest, GameInfoShallKeepCompletedRoundsWhenPushingAndPopping) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
+{
+    // Arrange
+    Backend::GameInfo gameInfo(std::make_shared<MemoryRepository>());
+    gameInfo.SetPlayers({"A", "B", "C", "D"}, "B", {});
+
+    // Act, Assert
+    for(int index = 0; index < 4; ++index) //NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    {
+        EXPECT_TRUE(gameInfo.CompletedRounds().empty());
+        gameInfo.PushDeal({ std::make_pair(std::string("A"), index + 1), std::make_pair(std::string("B"), index + 1) }, 0U);
+    }
+
+    EXPECT_EQ((std::vector<Backend::GameInfo::Round> { { 0U, 4U } }), gameInfo.CompletedRounds());
+
+    gameInfo.PushDeal({ std::make_pair(std::string("C"), 1), std::make_pair(std::string("D"), 1) }, 0U);
+    EXPECT_EQ(1U, gameInfo.CompletedRounds().size());
+
+    gameInfo.PopLastEntry();
+    EXPECT_EQ(1U, gameInfo.CompletedRounds().size());
+
+    gameInfo.PopLastEntry();
+    EXPECT_TRUE(gameInfo.CompletedRounds().empty());
+}
+
+TEST(BackendTest, GameInfoShallRestartRoundsWhenPlayersAreSet) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
+{
+    // Arrange
+    Backend::GameInfo gameInfo(std::make_shared<MemoryRepository>());
+    gameInfo.SetPlayers({"A", "B", "C", "D"}, "A", {});
+    gameInfo.PushDeal({ std::make_pair(std::string("A"), 1), std::make_pair(std::string("B"), 1) }, 0U);
+    gameInfo.PushDeal({ std::make_pair(std::string("A"), 1), std::make_pair(std::string("C"), 1) }, 0U);
+
+    // Act
+    gameInfo.SetPlayers({"A", "B", "C", "D", "E"}, "D", {});
+    for(int index = 0; index < 5; ++index) //NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    {
+        // the first two players in the order given win, the dealer sits out
+        std::vector<std::pair<std::string, int>> changes;
+        for(const auto & playerInfo : gameInfo.PlayerInfosView())
+        {
+            if(playerInfo.IsPlaying() && changes.size() < 2)
+            {
+                changes.emplace_back(playerInfo.Name(), 2);
+            }
+        }
+
+        gameInfo.PushDeal(changes, 0U);
+    }
+
+    // Assert
+    ASSERT_EQ((std::vector<Backend::GameInfo::Round> { { 2U, 7U } }), gameInfo.CompletedRounds());
+
+    const auto & round = gameInfo.CompletedRounds().front();
+    auto playerInfos = gameInfo.PlayerInfos();
+    ASSERT_STREQ("A", playerInfos[0]->Name().c_str());
+    ASSERT_STREQ("E", playerInfos[4]->Name().c_str());
+    EXPECT_EQ(8, playerInfos[0]->StatisticsInRange(round.firstDeal, round.endDeal).scoreDelta);
+    EXPECT_EQ(0, playerInfos[2]->StatisticsInRange(round.firstDeal, round.endDeal).scoreDelta);
+    EXPECT_EQ(-8, playerInfos[4]->StatisticsInRange(round.firstDeal, round.endDeal).scoreDelta);
+    EXPECT_EQ(0U, gameInfo.RoundCashCents(round, *playerInfos[0]));
+    EXPECT_EQ(gameInfo.RoundCashCents(round, *playerInfos[3]), gameInfo.RoundCashCents(round, *playerInfos[4]));
+    EXPECT_LT(gameInfo.RoundCashCents(round, *playerInfos[2]), gameInfo.RoundCashCents(round, *playerInfos[4]));
+
+    // rolling back through the players set continues the earlier round, which is not completed
+    for(int index = 0; index < 5; ++index) //NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    {
+        gameInfo.PopLastEntry();
+        EXPECT_TRUE(gameInfo.CompletedRounds().empty());
+    }
+
+    gameInfo.PopLastEntry();
+    EXPECT_EQ(2U, gameInfo.RemainingGamesInRound());
+
+    gameInfo.PushDeal({ std::make_pair(std::string("A"), 1), std::make_pair(std::string("D"), 1) }, 0U);
+    EXPECT_TRUE(gameInfo.CompletedRounds().empty());
+    gameInfo.PushDeal({ std::make_pair(std::string("B"), 1), std::make_pair(std::string("D"), 1) }, 0U);
+    EXPECT_EQ((std::vector<Backend::GameInfo::Round> { { 0U, 4U } }), gameInfo.CompletedRounds());
+}
+
+TEST(BackendTest, GameInfoShallNotifyObserverWithDeltas) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
+{
+    // Arrange
+    Backend::GameInfo gameInfo(std::make_shared<MemoryRepository>());
+    std::vector<Backend::GameDelta> deltas;
+    gameInfo.SetObserver([&deltas](const Backend::GameDelta& delta){ deltas.push_back(delta); });
+
+    // Act, Assert
+    gameInfo.SetPlayers({"A", "B", "C", "D", "E"}, "A", {});
+    ASSERT_EQ(1U, deltas.size());
+    EXPECT_EQ((Backend::GameDelta { true, {}, true, true, true, Backend::GameDelta::History::Unchanged }), deltas.back());
+
+    // the dealer A sits out and is not reported
+    gameInfo.PushDeal({ std::make_pair(std::string("B"), 2), std::make_pair(std::string("C"), 2) }, 0U);
+    ASSERT_EQ(2U, deltas.size());
+    EXPECT_EQ((Backend::GameDelta { false, { 1U, 2U, 3U, 4U }, true, true, false, Backend::GameDelta::History::Appended }), deltas.back());
+
+    gameInfo.TriggerMandatorySolo();
+    ASSERT_EQ(3U, deltas.size());
+    EXPECT_EQ((Backend::GameDelta { false, {}, false, false, true, Backend::GameDelta::History::Unchanged }), deltas.back());
+
+    gameInfo.PopLastEntry();
+    ASSERT_EQ(4U, deltas.size());
+    EXPECT_EQ((Backend::GameDelta { false, {}, false, false, true, Backend::GameDelta::History::Unchanged }), deltas.back());
+
+    gameInfo.PushDeal({ std::make_pair(std::string("A"), 1), std::make_pair(std::string("C"), 1) }, 1U);
+    ASSERT_EQ(5U, deltas.size());
+    EXPECT_EQ((Backend::GameDelta { false, { 0U, 2U, 3U, 4U }, true, true, true, Backend::GameDelta::History::Appended }), deltas.back());
+
+    gameInfo.PopLastEntry();
+    ASSERT_EQ(6U, deltas.size());
+    EXPECT_EQ((Backend::GameDelta { false, { 0U, 2U, 3U, 4U }, true, true, true, Backend::GameDelta::History::Removed }), deltas.back());
+
+    gameInfo.SaveTo(u8"game");
+    gameInfo.LoadFrom(u8"game");
+    ASSERT_EQ(7U, deltas.size());
+    EXPECT_EQ((Backend::GameDelta { true, {}, true, true, true, Backend::GameDelta::History::Replaced }), deltas.back());
+
+    gameInfo.SetObserver({});
+    gameInfo.PopLastEntry();
+    gameInfo.PopLastEntry();
+    EXPECT_EQ(7U, deltas.size());
+}
+
+/*!
+ * \brief The ThreeHandedRules struct is a house rule for deals of three players.
+ */
+struct ThreeHandedRules
+{
+    static constexpr unsigned int PlayersPerDeal = 3U;
+    static constexpr std::array<unsigned short, 2> MultiplierByBockLevel { 1U, 2U }; //NOLINT(google-runtime-int)
+    static constexpr unsigned int PointToCentNumerator = 1U;
+    static constexpr unsigned int PointToCentDenominator = 1U;
+};
+
+TEST(BackendTest, GameInfoShallApplyOtherHouseRules) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
+{
+    // Arrange
+    Backend::BasicGameInfo<ThreeHandedRules> gameInfo(std::make_shared<MemoryRepository>());
+    gameInfo.SetPlayers({"A", "B", "C"}, "A", {});
+
+    // Act
+    gameInfo.PushDeal({ std::make_pair(std::string("A"), 4) }, 0U);
+    gameInfo.PushDeal({ std::make_pair(std::string("A"), -1), std::make_pair(std::string("B"), -1) }, 0U);
+
+    // Assert
+    auto playerInfos = gameInfo.PlayerInfos();
+    ASSERT_EQ(3U, playerInfos.size());
+    ASSERT_STREQ("A", playerInfos[0]->Name().c_str());
+    ASSERT_STREQ("B", playerInfos[1]->Name().c_str());
+    ASSERT_STREQ("C", playerInfos[2]->Name().c_str());
+
+    // the single player against the other two plays solo
+    EXPECT_EQ(3, playerInfos[0]->CurrentScore());
+    EXPECT_EQ(1U, playerInfos[0]->SolosWon());
+    EXPECT_EQ(1U, playerInfos[0]->NumberGamesWon());
+    EXPECT_EQ(-3, playerInfos[1]->CurrentScore());
+    EXPECT_EQ(0U, playerInfos[1]->SolosLost());
+    EXPECT_EQ(0, playerInfos[2]->CurrentScore());
+    EXPECT_EQ(1U, playerInfos[2]->SolosWon());
+
+
+    // three changes already make a complete deal
+    gameInfo.PushDeal({ std::make_pair(std::string("A"), 2), std::make_pair(std::string("B"), -1), std::make_pair(std::string("C"), -1) }, 0U);
+    EXPECT_EQ(2U, playerInfos[0]->SolosWon());
+    EXPECT_EQ(-4, playerInfos[1]->CurrentScore());
+}
+
 #endif // TST_GAMEINFO_H
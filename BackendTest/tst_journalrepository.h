@@ -0,0 +1,256 @@
+/*
+ * This file is part of QtDoppelKopf.
+ *
+ * QtDoppelKopf is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtDoppelKopf is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtDoppelKopf.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../Backend/gameinfo.h"
+#include "../Backend/journalrepository.h"
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+
+#ifndef TST_JOURNALREPOSITORY_H
+#define TST_JOURNALREPOSITORY_H
+
+#if defined(_USE_LONG_TEST)
+static void RemoveJournalTestFiles(const std::filesystem::path & tempFile)
+{
+    for(const auto * suffix : { "", ".journal", ".tmp" })
+    {
+        auto path = std::filesystem::path(tempFile.u8string() + reinterpret_cast<const char8_t*>(suffix)); //NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        if(std::filesystem::exists(path) && !std::filesystem::is_directory(path))
+        {
+            std::filesystem::remove(path);
+        }
+    }
+}
+
+TEST(BackendTest, JournalRepositoryShallAppendAndRecoverGame) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
+{
+    // Arrange
+    auto tempFile = std::filesystem::temp_directory_path() / std::filesystem::path(u8"qtdoppelkopf.testing.journal.文字.temp.file");
+    auto journalFile = std::filesystem::path(tempFile.u8string() + u8".journal");
+    RemoveJournalTestFiles(tempFile);
+    auto id = tempFile.u8string();
+
+    Backend::GameInfo gameInfo(std::make_shared<Backend::JournalRepository>());
+    gameInfo.SetPlayers({"A", "B", "C", "D", "E"}, "A", std::set<unsigned int> {});
+    gameInfo.SaveTo(id);
+
+    auto snapshotSize = std::filesystem::file_size(tempFile);
+
+    // Act
+    gameInfo.PushDeal({ std::make_pair<std::string, int>("B", 2), std::make_pair<std::string, int>("C", 2) }, 1U);
+    gameInfo.SaveTo(id);
+    gameInfo.PushDeal({ std::make_pair<std::string, int>("C", -1), std::make_pair<std::string, int>("D", -1) }, 0U);
+    gameInfo.SaveTo(id);
+    gameInfo.PopLastEntry();
+    gameInfo.SaveTo(id);
+    gameInfo.TriggerMandatorySolo();
+    gameInfo.SaveTo(id);
+    gameInfo.PushDeal({ std::make_pair<std::string, int>("A", 3), std::make_pair<std::string, int>("D", 3) }, 0U);
+    gameInfo.SaveTo(id);
+
+    // Assert
+    EXPECT_EQ(snapshotSize, std::filesystem::file_size(tempFile));
+    ASSERT_TRUE(std::filesystem::exists(journalFile));
+
+    Backend::GameInfo recovered(std::make_shared<Backend::JournalRepository>());
+    recovered.LoadFrom(id);
+
+    auto expected = gameInfo.PlayerInfos();
+    auto actual = recovered.PlayerInfos();
+    ASSERT_EQ(expected.size(), actual.size());
+
+    for(size_t index = 0; index < expected.size(); ++index)
+    {
+        EXPECT_EQ(expected[index]->Name(), actual[index]->Name());
+        EXPECT_THAT(actual[index]->ScoreHistory(), ::testing::ElementsAreArray(expected[index]->ScoreHistory()));
+    }
+
+    EXPECT_EQ(gameInfo.MultiplierPreview(), recovered.MultiplierPreview());
+    EXPECT_EQ(Backend::GameInfo::MandatorySolo::Active, recovered.MandatorySolo());
+    EXPECT_EQ(Backend::GameInfo::PoppableEntry::Deal, recovered.LastPoppableEntry());
+
+    RemoveJournalTestFiles(tempFile);
+}
+
+TEST(BackendTest, JournalRepositoryShallResolveDealsByTheLastPlayersSet) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
+{
+    // Arrange
+    auto tempFile = std::filesystem::temp_directory_path() / std::filesystem::path(u8"qtdoppelkopf.testing.journal.文字.temp.file");
+    RemoveJournalTestFiles(tempFile);
+    auto id = tempFile.u8string();
+
+    Backend::GameInfo gameInfo(std::make_shared<Backend::JournalRepository>());
+    gameInfo.SetPlayers({"A", "B", "C", "D"}, "A", std::set<unsigned int> {});
+    gameInfo.PushDeal({ std::make_pair<std::string, int>("B", 2), std::make_pair<std::string, int>("C", 2) }, 0U);
+    gameInfo.SaveTo(id);
+
+    // Act
+    // the deals refer to the players by their positions, which differ between the players sets
+    gameInfo.SetPlayers({"E", "D", "C", "B"}, "E", std::set<unsigned int> {});
+    gameInfo.PushDeal({ std::make_pair<std::string, int>("D", 1), std::make_pair<std::string, int>("E", 1) }, 0U);
+    gameInfo.SaveTo(id);
+    gameInfo.PopLastEntry();
+    gameInfo.PopLastEntry();
+    gameInfo.SaveTo(id);
+    gameInfo.PushDeal({ std::make_pair<std::string, int>("A", 3), std::make_pair<std::string, int>("D", 3) }, 0U);
+    gameInfo.SaveTo(id);
+
+    // Assert
+    ASSERT_TRUE(std::filesystem::exists(std::filesystem::path(id + u8".journal")));
+
+    Backend::GameInfo recovered(std::make_shared<Backend::JournalRepository>());
+    recovered.LoadFrom(id);
+
+    auto actual = recovered.PlayerInfos();
+    ASSERT_EQ(4U, actual.size());
+    EXPECT_STREQ("A", actual[0]->Name().c_str());
+    EXPECT_THAT(actual[0]->ScoreHistory(), ::testing::ElementsAre(-2, 1));
+    EXPECT_STREQ("B", actual[1]->Name().c_str());
+    EXPECT_THAT(actual[1]->ScoreHistory(), ::testing::ElementsAre(2, -1));
+    EXPECT_STREQ("C", actual[2]->Name().c_str());
+    EXPECT_THAT(actual[2]->ScoreHistory(), ::testing::ElementsAre(2, -1));
+    EXPECT_STREQ("D", actual[3]->Name().c_str());
+    EXPECT_THAT(actual[3]->ScoreHistory(), ::testing::ElementsAre(-2, 1));
+
+    RemoveJournalTestFiles(tempFile);
+}
+
+TEST(BackendTest, JournalRepositoryShallCompactIntoSnapshot) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
+{
+    // Arrange
+    auto tempFile = std::filesystem::temp_directory_path() / std::filesystem::path(u8"qtdoppelkopf.testing.compaction.temp.file");
+    auto journalFile = std::filesystem::path(tempFile.u8string() + u8".journal");
+    RemoveJournalTestFiles(tempFile);
+    auto id = tempFile.u8string();
+
+    Backend::GameInfo gameInfo(std::make_shared<Backend::JournalRepository>(3U));
+    gameInfo.SetPlayers({"A", "B", "C", "D"}, "A", std::set<unsigned int> {});
+    gameInfo.SaveTo(id);
+
+    // Act, Assert
+    gameInfo.PushDeal({ std::make_pair<std::string, int>("B", 2), std::make_pair<std::string, int>("C", 2) }, 0U);
+    gameInfo.SaveTo(id);
+    gameInfo.PushDeal({ std::make_pair<std::string, int>("B", 2), std::make_pair<std::string, int>("C", 2) }, 0U);
+    gameInfo.SaveTo(id);
+    EXPECT_TRUE(std::filesystem::exists(journalFile));
+
+    gameInfo.PushDeal({ std::make_pair<std::string, int>("B", 2), std::make_pair<std::string, int>("C", 2) }, 0U);
+    gameInfo.SaveTo(id);
+    EXPECT_FALSE(std::filesystem::exists(journalFile));
+
+    // the snapshot alone is readable by the plain disk repository
+    Backend::GameInfo plain(std::make_shared<Backend::DiskRepository>());
+    plain.LoadFrom(id);
+    EXPECT_EQ(6, plain.PlayerInfos()[1]->CurrentScore());
+
+    RemoveJournalTestFiles(tempFile);
+}
+
+TEST(BackendTest, JournalRepositoryShallAppendOnlyTheChangedTail) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
+{
+    // Arrange
+    auto tempFile = std::filesystem::temp_directory_path() / std::filesystem::path(u8"qtdoppelkopf.testing.tail.temp.file");
+    auto journalFile = std::filesystem::path(tempFile.u8string() + u8".journal");
+    RemoveJournalTestFiles(tempFile);
+    auto id = tempFile.u8string();
+    auto repository = std::make_shared<Backend::JournalRepository>();
+
+    Backend::GameInfo gameInfo(repository);
+    gameInfo.SetPlayers({"A", "B", "C", "D"}, "A", std::set<unsigned int> {});
+    gameInfo.PushDeal({ std::make_pair<std::string, int>("B", 2), std::make_pair<std::string, int>("C", 2) }, 0U);
+    gameInfo.PushDeal({ std::make_pair<std::string, int>("A", 1), std::make_pair<std::string, int>("B", 1) }, 0U);
+    gameInfo.SaveTo(id);
+
+    // Act
+    gameInfo.PopLastEntry();
+    gameInfo.PushDeal({ std::make_pair<std::string, int>("A", -1), std::make_pair<std::string, int>("B", -1) }, 1U);
+    gameInfo.SaveTo(id);
+
+    // Assert
+    std::ifstream ifs(journalFile, std::ios::in | std::ios::binary);
+    std::vector<std::string> records;
+    for(std::string line; std::getline(ifs, line);)
+    {
+        records.push_back(line);
+    }
+
+    ASSERT_EQ(2U, records.size());
+    EXPECT_EQ("-", records[0]);
+    EXPECT_EQ('+', records[1][0]);
+
+    // another game saving under the same identifier does not share the lineage and replaces the file
+    Backend::GameInfo other(repository);
+    other.SetPlayers({"E", "F", "G", "H"}, "E", std::set<unsigned int> {});
+    other.PushDeal({ std::make_pair<std::string, int>("F", 4), std::make_pair<std::string, int>("G", 4) }, 0U);
+    other.SaveTo(id);
+
+    Backend::GameInfo recovered(std::make_shared<Backend::JournalRepository>());
+    recovered.LoadFrom(id);
+    ASSERT_EQ(4U, recovered.PlayerInfos().size());
+    EXPECT_EQ("E", recovered.PlayerInfos()[0]->Name());
+    EXPECT_EQ(4, recovered.PlayerInfos()[1]->CurrentScore());
+    EXPECT_EQ(1U, recovered.DealsRecorded());
+
+    RemoveJournalTestFiles(tempFile);
+}
+
+TEST(BackendTest, JournalRepositoryShallIgnoreTornRecord) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
+{
+    // Arrange
+    auto tempFile = std::filesystem::temp_directory_path() / std::filesystem::path(u8"qtdoppelkopf.testing.torn.temp.file");
+    auto journalFile = std::filesystem::path(tempFile.u8string() + u8".journal");
+    RemoveJournalTestFiles(tempFile);
+    auto id = tempFile.u8string();
+
+    {
+        Backend::GameInfo gameInfo(std::make_shared<Backend::JournalRepository>());
+        gameInfo.SetPlayers({"A", "B", "C", "D"}, "A", std::set<unsigned int> {});
+        gameInfo.SaveTo(id);
+        gameInfo.PushDeal({ std::make_pair<std::string, int>("B", 2), std::make_pair<std::string, int>("C", 2) }, 0U);
+        gameInfo.SaveTo(id);
+    }
+
+    {
+        std::ofstream ofs(journalFile, std::ios::out | std::ios::app | std::ios::binary);
+        ofs << R"foo(+{"kind":"deal","players":4,"numberOfEvents":0,"chan)foo";
+    }
+
+    // Act
+    auto repository = std::make_shared<Backend::JournalRepository>();
+    Backend::GameInfo recovered(repository);
+    recovered.LoadFrom(id);
+
+    // Assert
+    EXPECT_EQ(2, recovered.PlayerInfos()[1]->CurrentScore());
+    EXPECT_EQ(Backend::GameInfo::PoppableEntry::Deal, recovered.LastPoppableEntry());
+
+    recovered.PushDeal({ std::make_pair<std::string, int>("A", 1), std::make_pair<std::string, int>("D", 1) }, 0U);
+    recovered.SaveTo(id);
+
+    Backend::GameInfo again(std::make_shared<Backend::JournalRepository>());
+    again.LoadFrom(id);
+    EXPECT_EQ(-1, again.PlayerInfos()[0]->CurrentScore());
+    EXPECT_EQ(1, again.PlayerInfos()[1]->CurrentScore());
+
+    RemoveJournalTestFiles(tempFile);
+}
+#endif // _USE_LONG_TEST
+
+#endif // TST_JOURNALREPOSITORY_H
@@ -0,0 +1,145 @@
+/*
+ * This file is part of QtDoppelKopf.
+ *
+ * QtDoppelKopf is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtDoppelKopf is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtDoppelKopf.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef TST_LARGETABLE_H
+#define TST_LARGETABLE_H
+
+#include "../Backend/gameinfo.h"
+#include "../TestHelper/memoryrepository.h"
+#include <chrono>
+#include <gtest/gtest.h>
+#include <set>
+#include <string>
+#include <vector>
+
+/*!
+ * \brief Sets a table of the given size, at which the four players in front of the dealer play.
+ * \param gameInfo The game to set the players in.
+ * \param numberOfPlayers The number of players at the table.
+ */
+static void SetLargeTable(Backend::GameInfo & gameInfo, unsigned int numberOfPlayers) //NOLINT (google-runtime-references)
+{
+    std::vector<std::string> players;
+    std::set<unsigned int> sitOutScheme;
+
+    for(unsigned int index = 0; index < numberOfPlayers; ++index)
+    {
+        players.push_back("Player " + std::to_string(index));
+
+        if(index > 0 && index + 4 < numberOfPlayers)
+        {
+            sitOutScheme.insert(index);
+        }
+    }
+
+    gameInfo.SetPlayers(players, players.front(), sitOutScheme);
+}
+
+/*!
+ * \brief Gets changes in which the first two of the playing players win.
+ * \param gameInfo The game to take the playing players from.
+ * \param score The score of each winner.
+ * \return The changes.
+ */
+static std::vector<std::pair<std::string, int>> FirstPlayingWin(const Backend::GameInfo & gameInfo, int score)
+{
+    std::vector<std::pair<std::string, int>> changes;
+
+    for(const auto & playerInfo : gameInfo.PlayerInfosView())
+    {
+        if(playerInfo.IsPlaying() && changes.size() < 2)
+        {
+            changes.emplace_back(playerInfo.Name(), score);
+        }
+    }
+
+    return changes;
+}
+
+TEST(BackendTest, GameInfoShallRotateSitOutsAtLargeTables) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
+{
+    for(const unsigned int numberOfPlayers : { 8U, 32U, 128U })
+    {
+        // Arrange
+        Backend::GameInfo gameInfo(std::make_shared<MemoryRepository>());
+        SetLargeTable(gameInfo, numberOfPlayers);
+
+        // Act, Assert
+        for(unsigned int deal = 0; deal < numberOfPlayers; ++deal)
+        {
+            auto playerInfos = gameInfo.PlayerInfosView();
+            auto playing = std::ranges::count_if(playerInfos, [](const Backend::PlayerInfo& playerInfo){ return playerInfo.IsPlaying(); });
+            ASSERT_EQ(4, playing) << numberOfPlayers << " players, deal " << deal;
+            EXPECT_FALSE(gameInfo.Dealer()->IsPlaying());
+
+            gameInfo.PushDeal(FirstPlayingWin(gameInfo, 1), 0U);
+        }
+
+        EXPECT_EQ(0U, gameInfo.RemainingGamesInRound());
+        ASSERT_EQ(1U, gameInfo.CompletedRounds().size());
+        EXPECT_EQ(numberOfPlayers, gameInfo.CompletedRounds().front().endDeal);
+
+        unsigned int totalCashCents = 0;
+        for(const auto & playerInfo : gameInfo.PlayerInfosView())
+        {
+            EXPECT_EQ(4U, playerInfo.NumberGames()) << playerInfo.Name();
+            totalCashCents += playerInfo.CashCents();
+        }
+
+        // more players than members of the group leave nobody absent
+        EXPECT_EQ(totalCashCents, gameInfo.TotalCashCents());
+    }
+}
+
+#if defined(_USE_LONG_TEST)
+TEST(BackendTest, GameInfoBenchmarkPushingAndPoppingDealsAtLargeTables) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
+{
+    constexpr unsigned int numberOfDeals = 2000U;
+
+    for(const unsigned int numberOfPlayers : { 8U, 32U, 128U })
+    {
+        // Arrange
+        Backend::GameInfo gameInfo(std::make_shared<MemoryRepository>());
+        SetLargeTable(gameInfo, numberOfPlayers);
+
+        // Act
+        auto start = std::chrono::steady_clock::now();
+
+        // with events, so that the multipliers are pushed and popped as well
+        for(unsigned int deal = 0; deal < numberOfDeals; ++deal)
+        {
+            gameInfo.PushDeal(FirstPlayingWin(gameInfo, static_cast<int>(deal % 5U) + 1), deal % 3U);
+        }
+
+        while(gameInfo.LastPoppableEntry() == Backend::GameInfo::PoppableEntry::Deal)
+        {
+            gameInfo.PopLastEntry();
+        }
+
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+        // Assert
+        EXPECT_EQ(0U, gameInfo.DealsRecorded());
+
+        auto nanosecondsPerDeal = elapsed.count() / numberOfDeals;
+        ::testing::Test::RecordProperty("NanosecondsPerDealAt" + std::to_string(numberOfPlayers) + "Players", std::to_string(nanosecondsPerDeal));
+    }
+}
+#endif // _USE_LONG_TEST
+
+#endif // TST_LARGETABLE_H
@@ -27,9 +27,9 @@
 TEST(BackendTest, MemoryRepositoryShallCorrectlyStoreEntries) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
 {
     // Arrange
-    std::vector<std::shared_ptr<Backend::Entry>> entries;
+    std::vector<Backend::Entry> entries;
 
-    entries.push_back(std::make_shared<Backend::PlayersSet>(
+    entries.push_back(Backend::PlayersSet(
                           std::vector<std::string>
                           {
                               "A",
@@ -43,17 +43,17 @@ TEST(BackendTest, MemoryRepositoryShallCorrectlyStoreEntries) //NOLINT (cert-err
                           "C",
                           std::set<unsigned int> { 2, 4 },
                           "Z"));
-    entries.push_back(std::make_shared<Backend::Deal>(
-                          std::vector<std::pair<std::string, int>>
+    entries.push_back(Backend::Deal(
+                          Backend::ChangeSet<unsigned int>
                           {
-                              std::make_pair<std::string, int>("A", 1),
-                              std::make_pair<std::string, int>("B", 1),
-                              std::make_pair<std::string, int>("C", -1),
-                              std::make_pair<std::string, int>("D", -1)
+                              std::make_pair(0U, 1),
+                              std::make_pair(1U, 1),
+                              std::make_pair(2U, -1),
+                              std::make_pair(3U, -1)
                           },
                           Backend::NumberOfEvents(2),
                           Backend::Players(7)));
-    entries.push_back(std::make_shared<Backend::MandatorySoloTrigger>());
+    entries.push_back(Backend::MandatorySoloTrigger());
 
     MemoryRepository repo;
     std::u8string id = u8"someId";
@@ -165,35 +165,35 @@ TEST(BackendTest, MemoryRepositoryShallCorrectlyLoadEntries) //NOLINT (cert-err5
     // Assert
     ASSERT_EQ(3, result.size());
 
-    auto playersSet = std::static_pointer_cast<Backend::PlayersSet>(result[0]);
-    EXPECT_THAT(playersSet->Players(), ::testing::ElementsAre(std::string("A"), std::string("B"), std::string("C"), std::string("D"), std::string("E"), std::string("F"), std::string("G")));
-    EXPECT_STREQ("C", playersSet->Dealer().c_str());
-    EXPECT_THAT(playersSet->SitOutScheme(), ::testing::ElementsAre(2, 4));
-    EXPECT_STREQ("B", playersSet->PreviousDealer().c_str());
+    const auto & playersSet = result[0].Get<Backend::PlayersSet>();
+    EXPECT_THAT(playersSet.Players(), ::testing::ElementsAre(std::string("A"), std::string("B"), std::string("C"), std::string("D"), std::string("E"), std::string("F"), std::string("G")));
+    EXPECT_STREQ("C", playersSet.Dealer().c_str());
+    EXPECT_THAT(playersSet.SitOutScheme(), ::testing::ElementsAre(2, 4));
+    EXPECT_STREQ("B", playersSet.PreviousDealer().c_str());
 
-    auto deal = std::static_pointer_cast<Backend::Deal>(result[1]);
-    EXPECT_EQ(7, deal->Players().Value());
-    EXPECT_EQ(2, deal->NumberOfEvents().Value());
-    auto changes = deal->Changes();
-    EXPECT_STREQ("A", changes[0].first.c_str());
-    EXPECT_STREQ("B", changes[1].first.c_str());
-    EXPECT_STREQ("C", changes[2].first.c_str());
-    EXPECT_STREQ("D", changes[3].first.c_str());
+    const auto & deal = result[1].Get<Backend::Deal>();
+    EXPECT_EQ(7, deal.Players().Value());
+    EXPECT_EQ(2, deal.NumberOfEvents().Value());
+    auto changes = deal.Changes();
+    EXPECT_EQ(0U, changes[0].first);
+    EXPECT_EQ(1U, changes[1].first);
+    EXPECT_EQ(2U, changes[2].first);
+    EXPECT_EQ(3U, changes[3].first);
     EXPECT_EQ( 1, changes[0].second);
     EXPECT_EQ( 1, changes[1].second);
     EXPECT_EQ(-1, changes[2].second);
     EXPECT_EQ(-1, changes[3].second);
 
     auto mandatorySoloTrigger = result[2];
-    EXPECT_EQ(Backend::Entry::Kind::MandatorySoloTrigger, mandatorySoloTrigger->Kind());
+    EXPECT_EQ(Backend::Entry::Kind::MandatorySoloTrigger, mandatorySoloTrigger.Kind());
 }
 
 TEST(BackendTest, MemoryRepositoryRoundtripShallWorkCorrectly) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
 {
     // Arrange
-    std::vector<std::shared_ptr<Backend::Entry>> entries;
+    std::vector<Backend::Entry> entries;
 
-    entries.push_back(std::make_shared<Backend::PlayersSet>(
+    entries.push_back(Backend::PlayersSet(
                           std::vector<std::string>
                           {
                               "A",
@@ -207,17 +207,17 @@ TEST(BackendTest, MemoryRepositoryRoundtripShallWorkCorrectly) //NOLINT (cert-er
                           "C",
                           std::set<unsigned int> { 2, 4 },
                           "Z"));
-    entries.push_back(std::make_shared<Backend::Deal>(
-                          std::vector<std::pair<std::string, int>>
+    entries.push_back(Backend::Deal(
+                          Backend::ChangeSet<unsigned int>
                           {
-                              std::make_pair<std::string, int>("A", 1),
-                              std::make_pair<std::string, int>("B", 1),
-                              std::make_pair<std::string, int>("C", -1),
-                              std::make_pair<std::string, int>("D", -1)
+                              std::make_pair(0U, 1),
+                              std::make_pair(1U, 1),
+                              std::make_pair(2U, -1),
+                              std::make_pair(3U, -1)
                           },
                           Backend::NumberOfEvents(2),
                           Backend::Players(7)));
-    entries.push_back(std::make_shared<Backend::MandatorySoloTrigger>());
+    entries.push_back(Backend::MandatorySoloTrigger());
 
     MemoryRepository repo;
     std::u8string id = u8"someId";
@@ -229,27 +229,27 @@ TEST(BackendTest, MemoryRepositoryRoundtripShallWorkCorrectly) //NOLINT (cert-er
     // Assert
     ASSERT_EQ(3, entries.size());
 
-    auto playersSet = std::static_pointer_cast<Backend::PlayersSet>(result[0]);
-    EXPECT_THAT(playersSet->Players(), ::testing::ElementsAre(std::string("A"), std::string("B"), std::string("C"), std::string("D"), std::string("E"), std::string("F"), std::string("文字")));
-    EXPECT_STREQ("C", playersSet->Dealer().c_str());
-    EXPECT_THAT(playersSet->SitOutScheme(), ::testing::ElementsAre(2, 4));
-    EXPECT_STREQ("Z", playersSet->PreviousDealer().c_str());
+    const auto & playersSet = result[0].Get<Backend::PlayersSet>();
+    EXPECT_THAT(playersSet.Players(), ::testing::ElementsAre(std::string("A"), std::string("B"), std::string("C"), std::string("D"), std::string("E"), std::string("F"), std::string("文字")));
+    EXPECT_STREQ("C", playersSet.Dealer().c_str());
+    EXPECT_THAT(playersSet.SitOutScheme(), ::testing::ElementsAre(2, 4));
+    EXPECT_STREQ("Z", playersSet.PreviousDealer().c_str());
 
-    auto deal = std::static_pointer_cast<Backend::Deal>(result[1]);
-    EXPECT_EQ(7, deal->Players().Value());
-    EXPECT_EQ(2, deal->NumberOfEvents().Value());
-    auto changes = deal->Changes();
-    EXPECT_STREQ("A", changes[0].first.c_str());
-    EXPECT_STREQ("B", changes[1].first.c_str());
-    EXPECT_STREQ("C", changes[2].first.c_str());
-    EXPECT_STREQ("D", changes[3].first.c_str());
+    const auto & deal = result[1].Get<Backend::Deal>();
+    EXPECT_EQ(7, deal.Players().Value());
+    EXPECT_EQ(2, deal.NumberOfEvents().Value());
+    auto changes = deal.Changes();
+    EXPECT_EQ(0U, changes[0].first);
+    EXPECT_EQ(1U, changes[1].first);
+    EXPECT_EQ(2U, changes[2].first);
+    EXPECT_EQ(3U, changes[3].first);
     EXPECT_EQ( 1, changes[0].second);
     EXPECT_EQ( 1, changes[1].second);
     EXPECT_EQ(-1, changes[2].second);
     EXPECT_EQ(-1, changes[3].second);
 
     auto mandatorySoloTrigger = result[2];
-    EXPECT_EQ(Backend::Entry::Kind::MandatorySoloTrigger, mandatorySoloTrigger->Kind());
+    EXPECT_EQ(Backend::Entry::Kind::MandatorySoloTrigger, mandatorySoloTrigger.Kind());
 }
 
 TEST(BackendTest, MemoryRepositoryShallThrowIfNoContentFound) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
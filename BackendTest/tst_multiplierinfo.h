@@ -19,7 +19,9 @@
 #ifndef TST_MULTIPLIERINFO_H
 #define TST_MULTIPLIERINFO_H
 
+#include "../Backend/cashcalculation.h"
 #include "../Backend/multiplierinfo.h"
+#include <array>
 #include <gtest/gtest.h>
 
 TEST(BackendTest, MultiplierShallGiveCorrectDataAfterReset1) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
@@ -268,4 +270,133 @@ TEST(BackendTest, MultiplierShallGiveCorrectDataAfterResetWithMandatorySolo) //N
     EXPECT_EQ(false, mi.GetIsMandatorySolo(13));
 }
 
+TEST(BackendTest, MultiplierShallGiveSameDataAfterPopAsAfterReset) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
+{
+    // Arrange
+    Backend::MultiplierInfo incremental;
+    Backend::MultiplierInfo reference;
+    std::vector<Backend::EventInfo> events
+    {
+        { Backend::NumberOfEvents(0U), Backend::Players(4U), Backend::MandatorySolo(false) },
+        { Backend::NumberOfEvents(2U), Backend::Players(4U), Backend::MandatorySolo(false) },
+        { Backend::NumberOfEvents(2U), Backend::Players(4U), Backend::MandatorySolo(true) },
+        { Backend::NumberOfEvents(1U), Backend::Players(5U), Backend::MandatorySolo(false) },
+        { Backend::NumberOfEvents(3U), Backend::Players(5U), Backend::MandatorySolo(false) },
+        { Backend::NumberOfEvents(0U), Backend::Players(4U), Backend::MandatorySolo(true) },
+        { Backend::NumberOfEvents(1U), Backend::Players(4U), Backend::MandatorySolo(false) }
+    };
+
+    const auto expectSame = [&]()
+    {
+        for(unsigned int index = 0; index < 40U; ++index)
+        {
+            EXPECT_EQ(reference.GetMultiplier(index), incremental.GetMultiplier(index));
+            EXPECT_EQ(reference.GetIsMandatorySolo(index), incremental.GetIsMandatorySolo(index));
+        }
+
+        EXPECT_EQ(reference.GetPreview(), incremental.GetPreview());
+    };
+
+    for(const auto & event : events)
+    {
+        incremental.PushDeal(event);
+    }
+
+    // Act, Assert
+    while(!events.empty())
+    {
+        incremental.PopDeal();
+        events.pop_back();
+
+        reference.ResetTo(events);
+        expectSame();
+    }
+}
+
+TEST(BackendTest, MultiplierShallGiveSameDataAfterTriggerAndRevertOfMandatorySoloAsAfterReset) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
+{
+    // Arrange
+    Backend::MultiplierInfo incremental;
+    Backend::MultiplierInfo reference;
+    std::vector<Backend::EventInfo> events
+    {
+        { Backend::NumberOfEvents(1U), Backend::Players(4U), Backend::MandatorySolo(false) },
+        { Backend::NumberOfEvents(2U), Backend::Players(5U), Backend::MandatorySolo(false) },
+        { Backend::NumberOfEvents(2U), Backend::Players(5U), Backend::MandatorySolo(false) }
+    };
+
+    const auto expectSame = [&]()
+    {
+        for(unsigned int index = 0; index < 40U; ++index)
+        {
+            EXPECT_EQ(reference.GetMultiplier(index), incremental.GetMultiplier(index));
+            EXPECT_EQ(reference.GetIsMandatorySolo(index), incremental.GetIsMandatorySolo(index));
+        }
+
+        EXPECT_EQ(reference.GetPreview(), incremental.GetPreview());
+    };
+
+    for(const auto & event : events)
+    {
+        incremental.PushDeal(event);
+    }
+
+    // Act, Assert
+    incremental.TriggerMandatorySolo(Backend::Players(6U));
+    events.pop_back();
+    events.push_back({ Backend::NumberOfEvents(2U), Backend::Players(6U), Backend::MandatorySolo(true) });
+    reference.ResetTo(events);
+    expectSame();
+
+    incremental.PushDeal({ Backend::NumberOfEvents(1U), Backend::Players(6U), Backend::MandatorySolo(false) });
+    events.push_back({ Backend::NumberOfEvents(1U), Backend::Players(6U), Backend::MandatorySolo(false) });
+    reference.ResetTo(events);
+    expectSame();
+
+    incremental.PopDeal();
+    events.pop_back();
+    incremental.RevertMandatorySolo();
+    events.pop_back();
+    events.push_back({ Backend::NumberOfEvents(2U), Backend::Players(5U), Backend::MandatorySolo(false) });
+    reference.ResetTo(events);
+    expectSame();
+}
+
+/*!
+ * \brief The TripleOnlyRules struct is a house rule with a single level of bock, which triples the score.
+ */
+struct TripleOnlyRules
+{
+    static constexpr unsigned int PlayersPerDeal = 4U;
+    static constexpr std::array<unsigned short, 2> MultiplierByBockLevel { 1U, 3U }; //NOLINT(google-runtime-int)
+    static constexpr unsigned int PointToCentNumerator = 1U;
+    static constexpr unsigned int PointToCentDenominator = 1U;
+};
+
+static_assert(Backend::CalculateCashCents(7U) == 3U);
+static_assert(Backend::CalculateCashCents<TripleOnlyRules>(7U) == 7U);
+static_assert(Backend::MaximumBockLevel<Backend::HouseRules>() == 3U);
+static_assert(Backend::MaximumBockLevel<TripleOnlyRules>() == 1U);
+
+TEST(BackendTest, MultiplierShallApplyOtherHouseRules) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
+{
+    // Arrange
+    Backend::BasicMultiplierInfo<TripleOnlyRules> mi;
+
+    // Act
+    mi.PushDeal({ Backend::NumberOfEvents(2U), Backend::Players(4U), Backend::MandatorySolo(false) });
+
+    // Assert
+    // the second event is deferred, as the first one already reached the cap
+    EXPECT_EQ(1, mi.GetMultiplier(0));
+    for(unsigned int index = 1; index <= 8; ++index) //NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    {
+        EXPECT_EQ(3, mi.GetMultiplier(index)) << index;
+    }
+    EXPECT_EQ(1, mi.GetMultiplier(9)); //NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+    ASSERT_EQ(1U, mi.GetPreview().size());
+    EXPECT_EQ(8, mi.GetPreview()[0]);
+}
+
 #endif // TST_MULTIPLIERINFO_H
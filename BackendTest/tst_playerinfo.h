@@ -21,6 +21,7 @@
 
 #include "../Backend/gameinfo.h"
 #include "../Backend/playerinfo.h"
+#include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
 TEST(BackendTest, PlayerInfoAndGameInfoShallProvideCorrectScoresAndCashBalance) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
@@ -315,4 +316,131 @@ TEST(BackendTest, PlayerInfoAndGameInfoShallThrowOnPushingChangesThatCannotBeCom
     }, std::exception);
 }
 
+TEST(BackendTest, PlayerInfoShallRestoreStatisticsExactlyWhenPopping) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
+{
+    // Arrange
+    Backend::GameInfo gameInfo;
+    gameInfo.SetPlayers(std::vector<std::string>{"A", "B", "C", "D"}, "A", std::set<unsigned int> {});
+    auto playerInfos = gameInfo.PlayerInfos();
+
+    auto collect = [&]()
+    {
+        std::vector<std::vector<int>> statistics;
+        for(const auto & playerInfo : playerInfos)
+        {
+            statistics.push_back({
+                                     static_cast<int>(playerInfo->NumberGamesWon()),
+                                     static_cast<int>(playerInfo->NumberGamesLost()),
+                                     static_cast<int>(playerInfo->NumberGames()),
+                                     static_cast<int>(playerInfo->SolosWon()),
+                                     static_cast<int>(playerInfo->SolosLost()),
+                                     playerInfo->TotalSoloPoints(),
+                                     playerInfo->MaxSingleWin(),
+                                     playerInfo->MaxSingleLoss(),
+                                     playerInfo->UnmultipliedScore(),
+                                 });
+        }
+
+        return statistics;
+    };
+
+    std::vector<std::vector<std::vector<int>>> history { collect() };
+
+    // Act
+    gameInfo.PushDeal({ std::make_pair<std::string, int>("A", 3), std::make_pair<std::string, int>("B", 3) }, 1U);
+    history.push_back(collect());
+    gameInfo.PushDeal({ std::make_pair<std::string, int>("C", 9) }, 0U);
+    history.push_back(collect());
+    gameInfo.PushDeal({ std::make_pair<std::string, int>("D", -6) }, 0U);
+    history.push_back(collect());
+    gameInfo.PushDeal({ std::make_pair<std::string, int>("B", 1), std::make_pair<std::string, int>("D", 1) }, 0U);
+
+    // Assert
+    EXPECT_EQ(3U, playerInfos[1]->NumberGamesWon());
+    EXPECT_EQ(1U, playerInfos[2]->SolosWon());
+    EXPECT_EQ(1U, playerInfos[3]->SolosLost());
+    EXPECT_EQ(-12, playerInfos[3]->TotalSoloPoints());
+    EXPECT_EQ(18, playerInfos[2]->MaxSingleWin());
+    EXPECT_EQ(-12, playerInfos[3]->MaxSingleLoss());
+    EXPECT_EQ(1, playerInfos[0]->UnmultipliedScore());
+
+    while(gameInfo.LastPoppableEntry() == Backend::GameInfo::PoppableEntry::Deal)
+    {
+        gameInfo.PopLastEntry();
+        EXPECT_EQ(history.back(), collect());
+        history.pop_back();
+    }
+
+    EXPECT_TRUE(history.empty());
+}
+
+TEST(BackendTest, PlayerInfosViewShallReferToTheSamePlayerInfos) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
+{
+    // Arrange
+    Backend::GameInfo gameInfo;
+    gameInfo.SetPlayers(std::vector<std::string>{"A", "B", "C", "D", "E"}, "A", std::set<unsigned int> {});
+    auto playerInfos = gameInfo.PlayerInfos();
+
+    // Act
+    auto view = gameInfo.PlayerInfosView();
+    auto history = view[1].ScoreHistory();
+    const auto * name = &view[1].Name();
+
+    gameInfo.PushDeal({ std::make_pair<std::string, int>("B", 1), std::make_pair<std::string, int>("C", 1) }, 0U);
+
+    // Assert
+    ASSERT_EQ(playerInfos.size(), view.size());
+
+    for(size_t index = 0; index < playerInfos.size(); ++index)
+    {
+        EXPECT_EQ(playerInfos[index].get(), &view[index]);
+    }
+
+    EXPECT_TRUE(history.empty());
+    EXPECT_EQ(name, &playerInfos[1]->Name());
+    EXPECT_THAT(view[1].ScoreHistory(), ::testing::ElementsAre(1));
+}
+
+TEST(BackendTest, PlayerInfoShallProvideStatisticsOverRangesOfDeals) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
+{
+    // Arrange
+    Backend::GameInfo gameInfo;
+    gameInfo.SetPlayers(std::vector<std::string>{"A", "B", "C", "D"}, "A", std::set<unsigned int> {});
+    auto playerInfos = gameInfo.PlayerInfos();
+
+    // Act
+    gameInfo.PushDeal({ std::make_pair<std::string, int>("A", 2), std::make_pair<std::string, int>("B", 2) }, 0U);
+    gameInfo.PushDeal({ std::make_pair<std::string, int>("A", 9) }, 0U);
+    gameInfo.PushDeal({ std::make_pair<std::string, int>("A", -1), std::make_pair<std::string, int>("C", -1) }, 0U);
+    gameInfo.PushDeal({ std::make_pair<std::string, int>("B", 4), std::make_pair<std::string, int>("C", 4) }, 0U);
+
+    // Assert
+    ASSERT_EQ(4U, gameInfo.DealsRecorded());
+
+    const auto middle = playerInfos[0]->StatisticsInRange(1, 3);
+    EXPECT_EQ(2U, middle.numberGames);
+    EXPECT_EQ(1U, middle.numberGamesWon);
+    EXPECT_EQ(1U, middle.numberGamesLost);
+    EXPECT_EQ(1U, middle.solosWon);
+    EXPECT_EQ(0U, middle.solosLost);
+    EXPECT_EQ(9, middle.totalSoloPoints);
+    EXPECT_EQ(8, middle.unmultipliedScore);
+    EXPECT_EQ(9, middle.maxSingleWin);
+    EXPECT_EQ(-1, middle.maxSingleLoss);
+    EXPECT_EQ(8, middle.scoreDelta);
+
+    const auto last = playerInfos[0]->StatisticsOfLastDeals(2);
+    EXPECT_EQ(0, last.maxSingleWin);
+    EXPECT_EQ(-5, last.scoreDelta);
+    EXPECT_EQ(playerInfos[0]->StatisticsInRange(2, 4), last);
+
+    const auto all = playerInfos[0]->StatisticsOfLastDeals(100); //NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(playerInfos[0]->CurrentScore(), all.scoreDelta);
+    EXPECT_EQ(playerInfos[0]->MaxSingleWin(), all.maxSingleWin);
+    EXPECT_EQ(playerInfos[0]->NumberGames(), all.numberGames);
+
+    EXPECT_EQ(Backend::Statistics {}, playerInfos[0]->StatisticsInRange(2, 2));
+    EXPECT_THROW(static_cast<void>(playerInfos[0]->StatisticsInRange(3, 5)), std::exception); //NOLINT(cppcoreguidelines-avoid-goto, hicpp-avoid-goto)
+}
+
 #endif // TST_PLAYERINFO_H
@@ -0,0 +1,81 @@
+/*
+ * This file is part of QtDoppelKopf.
+ *
+ * QtDoppelKopf is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtDoppelKopf is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtDoppelKopf.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef TST_RANGEEXTREMUM_H
+#define TST_RANGEEXTREMUM_H
+
+#include "../Backend/rangeextremum.h"
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <vector>
+
+TEST(BackendTest, RangeExtremumShallMatchScanningAllRangesWhilePushingAndPopping) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
+{
+    // Arrange
+    Backend::RangeExtremum<int> maxima;
+    Backend::RangeExtremum<int, std::greater<>> minima;
+    std::vector<int> values;
+
+    auto verify = [&]()
+    {
+        ASSERT_EQ(values.size(), maxima.Size());
+
+        for(size_t begin = 0; begin < values.size(); ++begin)
+        {
+            for(size_t end = begin + 1; end <= values.size(); ++end)
+            {
+                const auto maximum = maxima.Query(values, begin, end);
+                const auto minimum = minima.Query(values, begin, end);
+
+                ASSERT_TRUE(maximum >= begin && maximum < end) << begin << ".." << end;
+                ASSERT_TRUE(minimum >= begin && minimum < end) << begin << ".." << end;
+                EXPECT_EQ(*std::max_element(values.begin() + begin, values.begin() + end), values[maximum]) << begin << ".." << end;
+                EXPECT_EQ(*std::min_element(values.begin() + begin, values.begin() + end), values[minimum]) << begin << ".." << end;
+            }
+        }
+    };
+
+    // Act, Assert
+    for(int index = 0; index < 37; ++index) //NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    {
+        const int value = (index * 7919) % 23 - 11; //NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+        values.push_back(value);
+        maxima.PushBack(values);
+        minima.PushBack(values);
+        verify();
+    }
+
+    values.back() = 100; //NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    maxima.UpdateBack(values);
+    minima.UpdateBack(values);
+    verify();
+
+    while(!values.empty())
+    {
+        values.pop_back();
+        maxima.PopBack(values);
+        minima.PopBack(values);
+        verify();
+    }
+
+    values.push_back(3);
+    maxima.PushBack(values);
+    EXPECT_EQ(0U, maxima.Query(values, 0, 1));
+}
+
+#endif // TST_RANGEEXTREMUM_H
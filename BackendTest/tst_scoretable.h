@@ -0,0 +1,292 @@
+/*
+ * This file is part of QtDoppelKopf.
+ *
+ * QtDoppelKopf is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtDoppelKopf is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtDoppelKopf.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef TST_SCORETABLE_H
+#define TST_SCORETABLE_H
+
+#include "../Backend/gameinfo.h"
+#include "../Backend/scoretable.h"
+#include "../TestHelper/memoryrepository.h"
+#include <algorithm>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <vector>
+
+/*!
+ * \brief Decimates a range by scanning, as the reference for the index of the extremes of the totals.
+ * \param totals The totals to decimate.
+ * \param begin The row of the first total of the range.
+ * \param end The row after the last total of the range.
+ * \param maximumPoints The maximal number of points.
+ * \return The points ordered by their rows.
+ */
+static std::vector<Backend::ScoreTable::Point> DecimateByScanning(const std::vector<std::int32_t>& totals, size_t begin, size_t end, size_t maximumPoints)
+{
+    std::vector<Backend::ScoreTable::Point> points;
+    maximumPoints = std::max(maximumPoints, size_t { 4 });
+
+    if(end - begin <= maximumPoints)
+    {
+        for(size_t row = begin; row < end; ++row)
+        {
+            points.push_back({ row, totals[row] });
+        }
+
+        return points;
+    }
+
+    size_t bucketSize = 2;
+    while(2 * ((end - 1) / bucketSize - begin / bucketSize + 1) > maximumPoints)
+    {
+        bucketSize *= 2;
+    }
+
+    for(size_t first = begin / bucketSize * bucketSize; first < end; first += bucketSize)
+    {
+        auto last = totals.begin() + static_cast<std::ptrdiff_t>(std::min(first + bucketSize, totals.size()));
+        auto minimum = static_cast<size_t>(std::min_element(totals.begin() + static_cast<std::ptrdiff_t>(first), last) - totals.begin());
+        auto maximum = static_cast<size_t>(std::max_element(totals.begin() + static_cast<std::ptrdiff_t>(first), last) - totals.begin());
+
+        for(const auto row : { std::min(minimum, maximum), std::max(minimum, maximum) })
+        {
+            if(points.empty() || points.back().row != row)
+            {
+                points.push_back({ row, totals[row] });
+            }
+        }
+    }
+
+    return points;
+}
+
+TEST(BackendTest, ScoreTableShallKeepRowsWhenAddingColumns) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
+{
+    // Arrange
+    Backend::ScoreTable table;
+    table.AddColumn();
+    table.AddColumn();
+
+    table.PushRow();
+    table.SetInLastRow(0, 2, 2, false, true);
+    table.SetInLastRow(1, -2, -2, false, false);
+
+    table.PushRow();
+    table.SetInLastRow(1, -3, -6, true, true);
+
+    // Act
+    table.AddColumn();
+    table.PushRow();
+    table.SetInLastRow(2, 1, 1, false, true);
+
+    // Assert
+    ASSERT_EQ(3U, table.Rows());
+    ASSERT_EQ(3U, table.Columns());
+
+    EXPECT_TRUE(table.HasPlayed(0, 0));
+    EXPECT_TRUE(table.HasInput(0, 0));
+    EXPECT_FALSE(table.HasInput(0, 1));
+    EXPECT_EQ(2, table.Total(2, 0));
+
+    EXPECT_FALSE(table.PlayedSolo(0, 1));
+    EXPECT_TRUE(table.PlayedSolo(1, 1));
+    EXPECT_EQ(-3, table.UnmultipliedScore(1, 1));
+    EXPECT_EQ(-6, table.MultipliedScore(1, 1));
+    EXPECT_EQ(-8, table.Total(2, 1));
+
+    EXPECT_FALSE(table.HasPlayed(0, 2));
+    EXPECT_FALSE(table.HasPlayed(1, 2));
+    EXPECT_EQ(0, table.Total(1, 2));
+    EXPECT_EQ(1, table.Total(2, 2));
+
+    table.PopRow();
+    EXPECT_EQ(2U, table.Rows());
+    EXPECT_EQ(-8, table.Total(1, 1));
+    EXPECT_EQ(0, table.Total(1, 2));
+
+    EXPECT_FALSE(Backend::ScoreTable::IsRepresentable(40000));
+    EXPECT_TRUE(Backend::ScoreTable::IsRepresentable(-40));
+}
+
+TEST(BackendTest, ScoreTableShallCountAcrossBlocksOfRows) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
+{
+    // Arrange
+    constexpr size_t rows = 70000U;
+    Backend::ScoreTable table;
+    table.AddColumn();
+
+    // Act
+    for(size_t row = 0; row < rows; ++row)
+    {
+        table.PushRow();
+        table.SetInLastRow(0, row % 2 == 0 ? 1 : -1, row % 2 == 0 ? 1 : -1, row % 7 == 0, false);
+    }
+
+    const auto all = table.StatisticsInRange(0, 0, rows);
+    const auto acrossBlock = table.StatisticsInRange(0, 30000U, 40000U);
+    const auto withinBlock = table.StatisticsInRange(0, 130U, 150U);
+
+    table.PopRow();
+    const auto popped = table.StatisticsInRange(0, 0, rows - 1);
+
+    // Assert
+    EXPECT_EQ(rows, all.numberGames);
+    EXPECT_EQ(rows / 2, all.numberGamesWon);
+    EXPECT_EQ(rows / 2, all.numberGamesLost);
+    EXPECT_EQ(0, all.scoreDelta);
+    EXPECT_EQ(1, all.maxSingleWin);
+    EXPECT_EQ(-1, all.maxSingleLoss);
+
+    EXPECT_EQ(10000U, acrossBlock.numberGames);
+    EXPECT_EQ(5000U, acrossBlock.numberGamesWon);
+    EXPECT_EQ(1429U, acrossBlock.solosWon + acrossBlock.solosLost);
+
+    EXPECT_EQ(20U, withinBlock.numberGames);
+    EXPECT_EQ(10U, withinBlock.numberGamesWon);
+    EXPECT_EQ(3U, withinBlock.solosWon + withinBlock.solosLost);
+
+    EXPECT_EQ(rows - 1, popped.numberGames);
+    EXPECT_EQ(rows / 2, popped.numberGamesWon);
+}
+
+TEST(BackendTest, ScoreTableShallKeepExtremesOfEachBucketOfTotals) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
+{
+    // Arrange
+    Backend::ScoreTable table;
+    table.AddColumn();
+
+    int previous = 0;
+    for(const int total : { 0, 5, -3, 2, 7, 1, -4, 6 }) //NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    {
+        table.PushRow();
+        table.SetInLastRow(0, total - previous, total - previous, false, false);
+        previous = total;
+    }
+
+    // Act
+    auto points = table.DecimatedTotals(0, 0, 8, 4); //NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+    // Assert
+    EXPECT_EQ((std::vector<Backend::ScoreTable::Point> { { 1, 5 }, { 2, -3 }, { 4, 7 }, { 6, -4 } }), points);
+    EXPECT_EQ(8U, table.DecimatedTotals(0, 0, 100, 8).size()); //NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_TRUE(table.DecimatedTotals(0, 5, 5, 8).empty()); //NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+}
+
+TEST(BackendTest, ScoreTableShallDecimateTotalsLikeScanningWhilePushingAndPopping) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
+{
+    // Arrange
+    Backend::ScoreTable table;
+    table.AddColumn();
+    std::vector<std::int32_t> totals;
+
+    auto verify = [&]()
+    {
+        ASSERT_EQ(totals.size(), table.Rows());
+
+        for(size_t begin = 0; begin < totals.size(); begin += 3)
+        {
+            for(size_t end = begin + 1; end <= totals.size(); end += 5)
+            {
+                for(const size_t maximumPoints : { 4U, 7U, 16U, 50U })
+                {
+                    auto points = table.DecimatedTotals(0, begin, end, maximumPoints);
+                    ASSERT_EQ(DecimateByScanning(totals, begin, end, maximumPoints), points) << begin << ".." << end << " in " << maximumPoints;
+                    ASSERT_LE(points.size(), maximumPoints);
+                }
+            }
+        }
+    };
+
+    // Act, Assert
+    for(int row = 0; row < 75; ++row) //NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    {
+        // the totals repeat, so that the earlier of equal extremes must be found
+        const int total = (row * 7919) % 41 - 20; //NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+        const int score = total - (totals.empty() ? 0 : totals.back());
+        totals.push_back(total);
+        table.PushRow();
+        table.SetInLastRow(0, score, score, false, false);
+        verify();
+    }
+
+    while(!totals.empty())
+    {
+        totals.pop_back();
+        table.PopRow();
+        verify();
+    }
+}
+
+TEST(BackendTest, GameInfoShallRestoreStatisticsWhenPoppingTheMaximalWin) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
+{
+    // Arrange
+    Backend::GameInfo gameInfo(std::make_shared<MemoryRepository>());
+    gameInfo.SetPlayers({"A", "B", "C", "D"}, "A", {});
+    gameInfo.PushDeal({ std::make_pair(std::string("A"), 2), std::make_pair(std::string("B"), 2) }, 0U);
+    gameInfo.PushDeal({ std::make_pair(std::string("A"), 3), std::make_pair(std::string("C"), 3) }, 0U);
+
+    // a player joining late has not played in the earlier deals
+    gameInfo.SetPlayers({"A", "B", "C", "D", "E"}, "C", {});
+    gameInfo.PushDeal({ std::make_pair(std::string("A"), 5), std::make_pair(std::string("E"), 5) }, 0U);
+
+    auto playerA = gameInfo.PlayerInfos()[0];
+    auto playerE = gameInfo.PlayerInfos()[4];
+    ASSERT_STREQ("A", playerA->Name().c_str());
+    ASSERT_STREQ("E", playerE->Name().c_str());
+    EXPECT_EQ(5, playerA->MaxSingleWin());
+    EXPECT_THAT(playerE->ScoreHistory(), ::testing::ElementsAre(0, 0, 5));
+
+    // Act
+    gameInfo.PopLastEntry();
+
+    // Assert
+    EXPECT_EQ(3, playerA->MaxSingleWin());
+    EXPECT_EQ(5, playerA->CurrentScore());
+    EXPECT_EQ(2U, playerA->NumberGamesWon());
+    EXPECT_EQ("3", playerA->InputInLastDeal());
+    EXPECT_EQ(0, playerE->MaxSingleWin());
+    EXPECT_THAT(playerE->ScoreHistory(), ::testing::ElementsAre(0, 0));
+}
+
+TEST(BackendTest, GameInfoShallRejectScoresNotFittingTheTable) //NOLINT (cert-err58-cpp, cppcoreguidelines-avoid-non-const-global-variables, cppcoreguidelines-owning-memory, fuchsia-statically-constructed-objects, misc-definitions-in-headers)
+{
+    // Arrange
+    Backend::GameInfo gameInfo(std::make_shared<MemoryRepository>());
+    gameInfo.SetPlayers({"A", "B", "C", "D"}, "A", {});
+
+    // Act, Assert
+    EXPECT_THROW( //NOLINT(cppcoreguidelines-avoid-goto, hicpp-avoid-goto)
+    {
+        try
+        {
+            gameInfo.PushDeal({ std::make_pair(std::string("A"), 40000), std::make_pair(std::string("B"), 40000) }, 0U); //NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+        }
+        catch( const std::exception& e )
+        {
+            EXPECT_STREQ("change in score out of range", e.what());
+            throw;
+        }
+    }, std::exception );
+
+    EXPECT_EQ(0U, gameInfo.DealsRecorded());
+    EXPECT_THAT(gameInfo.PlayerInfos()[0]->ScoreHistory(), ::testing::IsEmpty());
+
+    gameInfo.PushDeal({ std::make_pair(std::string("A"), 32767), std::make_pair(std::string("B"), 32767) }, 0U); //NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(-32767, gameInfo.PlayerInfos()[2]->CurrentScore());
+}
+
+#endif // TST_SCORETABLE_H
@@ -17,17 +17,26 @@
 #
 
 SOURCES += \
+    $$PWD/historyselectionmodel.cpp \
     $$PWD/mainwindow.cpp \
     $$PWD/playerselection_ui.cpp \
     $$PWD/qcustomplot.cpp \
-    $$PWD/scorelineedit.cpp
+    $$PWD/scoreinputdelegate.cpp \
+    $$PWD/scorelineedit.cpp \
+    $$PWD/standingstablemodel.cpp \
+    $$PWD/statisticstablemodel.cpp
 
 HEADERS += \
+    $$PWD/historyselectionmodel.h \
     $$PWD/mainwindow.h \
     $$PWD/mainwindow_ui.h \
     $$PWD/playerselection_ui.h \
     $$PWD/qcustomplot.h \
-    $$PWD/scorelineedit.h
+    $$PWD/renderedvalue.h \
+    $$PWD/scoreinputdelegate.h \
+    $$PWD/scorelineedit.h \
+    $$PWD/standingstablemodel.h \
+    $$PWD/statisticstablemodel.h
 
 
 FORMS +=
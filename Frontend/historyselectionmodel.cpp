@@ -0,0 +1,132 @@
+/*
+ * This file is part of QtDoppelKopf.
+ *
+ * QtDoppelKopf is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtDoppelKopf is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtDoppelKopf.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "historyselectionmodel.h"
+#include <algorithm>
+#include <utility>
+
+HistorySelectionModel::HistorySelectionModel(std::vector<QColor> colors, QObject *parent)
+    : QAbstractListModel(parent),
+      colors(std::move(colors))
+{
+}
+
+void HistorySelectionModel::Refresh(const Backend::GameInfo& gameInfo)
+{
+    std::vector<Row> newRows;
+
+    size_t position = 0;
+    for(const auto & playerInfo : gameInfo.PlayerInfosView())
+    {
+        if(playerInfo.IsPresent() || playerInfo.HasPlayed())
+        {
+            // a player shown before keeps the selection
+            auto previous = std::ranges::find(this->rows, position, &Row::position);
+            newRows.push_back(Row { position, QString::fromUtf8(playerInfo.Name()), previous == this->rows.end() || previous->selected });
+        }
+
+        ++position;
+    }
+
+    bool rowsChanged = newRows.size() != this->rows.size()
+            || !std::equal(newRows.begin(), newRows.end(), this->rows.begin(), [](const Row& newRow, const Row& row){ return newRow.position == row.position; });
+
+    if(rowsChanged)
+    {
+        this->beginResetModel();
+        this->rows = std::move(newRows);
+        this->endResetModel();
+        return;
+    }
+
+    for(size_t row = 0; row < this->rows.size(); ++row)
+    {
+        if(this->rows[row].name != newRows[row].name)
+        {
+            this->rows[row].name = newRows[row].name;
+            emit this->dataChanged(this->index(static_cast<int>(row)), this->index(static_cast<int>(row)), { Qt::DisplayRole });
+        }
+    }
+}
+
+bool HistorySelectionModel::IsSelected(size_t position) const
+{
+    return std::ranges::any_of(this->rows, [position](const Row& row){ return row.position == position && row.selected; });
+}
+
+int HistorySelectionModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : static_cast<int>(this->rows.size());
+}
+
+QVariant HistorySelectionModel::data(const QModelIndex &index, int role) const
+{
+    if(!index.isValid() || index.row() >= this->rowCount())
+    {
+        return {};
+    }
+
+    const auto & row = this->rows[static_cast<size_t>(index.row())];
+
+    switch(role)
+    {
+    case Qt::DisplayRole:
+        return row.name;
+
+    case Qt::DecorationRole:
+        // the color of the graph marks the player, as the square in front of the name used to
+        return row.position < this->colors.size() ? QVariant(this->colors[row.position]) : QVariant();
+
+    case Qt::CheckStateRole:
+        return static_cast<int>(row.selected ? Qt::Checked : Qt::Unchecked);
+
+    default:
+        return {};
+    }
+}
+
+bool HistorySelectionModel::setData(const QModelIndex &index, const QVariant &value, int role)
+{
+    if(!index.isValid() || index.row() >= this->rowCount() || role != Qt::CheckStateRole)
+    {
+        return false;
+    }
+
+    auto & row = this->rows[static_cast<size_t>(index.row())];
+    auto selected = static_cast<Qt::CheckState>(value.toInt()) == Qt::Checked;
+
+    if(row.selected != selected)
+    {
+        row.selected = selected;
+        emit this->dataChanged(index, index, { Qt::CheckStateRole });
+    }
+
+    return true;
+}
+
+Qt::ItemFlags HistorySelectionModel::flags(const QModelIndex &index) const
+{
+    auto flags = QAbstractListModel::flags(index);
+
+    if(index.isValid() && index.row() < this->rowCount())
+    {
+        flags |= Qt::ItemIsUserCheckable;
+    }
+
+    return flags;
+}
@@ -0,0 +1,96 @@
+/*
+ * This file is part of QtDoppelKopf.
+ *
+ * QtDoppelKopf is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtDoppelKopf is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtDoppelKopf.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef HISTORYSELECTIONMODEL_H
+#define HISTORYSELECTIONMODEL_H
+
+#include "../Backend/gameinfo.h"
+#include <QAbstractListModel>
+#include <QColor>
+#include <QString>
+#include <vector>
+
+/*!
+ * \brief The HistorySelectionModel class presents the shown players of a game as a list,
+ *        in which the graphs of their histories are selected by checking them.
+ *        The rows only exist for the players shown, so that no widgets are kept for absent positions.
+ *        A selection belongs to the position of a player in the game and survives refreshes.
+ */
+class HistorySelectionModel : public QAbstractListModel
+{
+    Q_OBJECT
+
+private:
+    /*!
+     * \brief The Row struct holds the values of a row, the position being the one of the player in the game.
+     */
+    struct Row
+    {
+        size_t position{};
+        QString name;
+        bool selected{};
+    };
+
+    std::vector<QColor> colors;
+    std::vector<Row> rows;
+
+public:
+    /*!
+     * \brief Initializes a new instance without rows.
+     * \param colors The colors of the graphs indexed by the positions of the players in the game.
+     * \param parent Is sent to the QAbstractListModel ctor.
+     */
+    explicit HistorySelectionModel(std::vector<QColor> colors, QObject *parent = nullptr);
+
+    /*!
+     * \brief Takes the players shown, who are present or have played, from the game.
+     *        If the positions of the shown players change, the model is reset, otherwise only the changed names are signalled.
+     *        Players newly shown are selected.
+     * \param gameInfo The game to take the players from.
+     */
+    void Refresh(const Backend::GameInfo& gameInfo);
+
+    /*!
+     * \brief Gets a value indicating whether the history of the player is selected.
+     * \param position The position of the player in the game.
+     * \return A value indicating whether the player is shown and selected.
+     */
+    [[nodiscard]] bool IsSelected(size_t position) const;
+
+    /*!
+     * \reimp
+     */
+    [[nodiscard]] int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+
+    /*!
+     * \reimp
+     */
+    [[nodiscard]] QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+
+    /*!
+     * \reimp
+     */
+    bool setData(const QModelIndex &index, const QVariant &value, int role = Qt::EditRole) override;
+
+    /*!
+     * \reimp
+     */
+    [[nodiscard]] Qt::ItemFlags flags(const QModelIndex &index) const override;
+};
+
+#endif // HISTORYSELECTIONMODEL_H
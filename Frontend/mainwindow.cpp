@@ -21,29 +21,44 @@
 #include "playerselection_ui.h"
 
 #include <QMessageBox>
+#include <QSortFilterProxyModel>
+#include <algorithm>
+#include <cmath>
 #include <utility>
 
 MainWindow::MainWindow(const unsigned int maxPlayers, std::shared_ptr<Backend::Repository> repository, bool showPlayerSelection, QWidget *parent)
     : QMainWindow(parent),
       MaxPlayers(maxPlayers),
-      ui(new Ui::MainWindow(MaxPlayers)),
-      gameInfo(Backend::GameInfo(std::move(repository), maxPlayers))
+      htmlColors(MainWindow::GenerateColors(maxPlayers)),
+      ui(new Ui::MainWindow()),
+      gameInfo(Backend::GameInfo(std::move(repository), maxPlayers)),
+      statisticsModel(new StatisticsTableModel(this)), //NOLINT(cppcoreguidelines-owning-memory)
+      statisticsProxyModel(new QSortFilterProxyModel(this)), //NOLINT(cppcoreguidelines-owning-memory)
+      standingsModel(new StandingsTableModel(this)), //NOLINT(cppcoreguidelines-owning-memory)
+      scoreInputDelegate(new ScoreInputDelegate(this)), //NOLINT(cppcoreguidelines-owning-memory)
+      historySelectionModel(new HistorySelectionModel(this->htmlColors, this)) //NOLINT(cppcoreguidelines-owning-memory)
 {
-    assert(maxPlayers <= 8);
-    this->htmlColors = std::vector<QColor>
-    {
-        QColor(0x7b, 0x1f, 0xa2), //NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-        QColor(0x00, 0x00, 0x00), //NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-        QColor(0xfb, 0x8c, 0x00), //NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-        QColor(0x00, 0x89, 0x7b), //NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-        QColor(0x39, 0x49, 0xab), //NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-        QColor(0xe5, 0x39, 0x35), //NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-        QColor(0x79, 0x55, 0x48), //NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-        QColor(0x21, 0x96, 0xf3)  //NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-    };
-
     ui->setupUi(this);
 
+    this->statisticsProxyModel->setSourceModel(this->statisticsModel);
+    this->ui->statisticsTable->setModel(this->statisticsProxyModel);
+
+    this->ui->standingsTable->setModel(this->standingsModel);
+    this->ui->standingsTable->setItemDelegateForColumn(StandingsTableModel::Input, this->scoreInputDelegate);
+    connect(this->standingsModel, &QAbstractItemModel::modelReset, this, &MainWindow::OpenScoreInputEditors);
+    connect(this->scoreInputDelegate, &ScoreInputDelegate::inputFocused, this, &MainWindow::OnScoreInputFocused);
+    connect(this->scoreInputDelegate, &ScoreInputDelegate::inputSubmitted, this, &MainWindow::OnScoreInputReturnKeyPressed);
+
+    this->ui->playerHistorySelection->setModel(this->historySelectionModel);
+    connect(this->historySelectionModel, &QAbstractItemModel::dataChanged, this, &MainWindow::OnHistoryPlayerSelected);
+
+    this->CreateHistoryLayers();
+    connect(this->ui->plotPlayerHistory, &QCustomPlot::beforeReplot, this, &MainWindow::OnHistoryBeforeReplot);
+    connect(this->ui->plotPlayerHistory->xAxis, qOverload<const QCPRange&>(&QCPAxis::rangeChanged), this, &MainWindow::OnHistoryRangeChanged);
+    connect(this->ui->wholeSessionButton, &QAbstractButton::toggled, this, &MainWindow::OnWholeSessionToggled);
+
+    this->gameInfo.SetObserver([this](const Backend::GameDelta& delta){ this->OnGameChanged(delta); });
+
     connect(this->ui->changePlayersButton, &QAbstractButton::pressed, this, &MainWindow::OnChangePlayerPressed);
     connect(this->ui->loadButton, &QAbstractButton::pressed, this, &MainWindow::OnLoadGamePressed);
     connect(this->ui->saveButton, &QAbstractButton::pressed, this, &MainWindow::OnSaveGamePressed);
@@ -52,12 +67,8 @@ MainWindow::MainWindow(const unsigned int maxPlayers, std::shared_ptr<Backend::R
     connect(this->ui->resetButton, &QAbstractButton::pressed, this, &MainWindow::OnResetPressed);
     connect(this->ui->aboutButton, &QAbstractButton::pressed, this, &MainWindow::OnAboutPressed);
 
-    for(unsigned int i = 0; i < MaxPlayers; ++i)
-    {
-        connect(this->ui->actuals[i], &ScoreLineEdit::mouseFocused, this, &MainWindow::OnScoreInputFocused);
-        connect(this->ui->actuals[i], &ScoreLineEdit::returnPressed, this, &MainWindow::OnScoreInputReturnKeyPressed);
-        connect(this->ui->playerHistorySelectionCheckboxes[i], &QCheckBox::stateChanged, this, &MainWindow::OnHistoryPlayerSelected);
-    }
+    // the user edits the number of events between the updates, so the rendered value follows each of them
+    connect(this->ui->spinBox, qOverload<int>(&QSpinBox::valueChanged), this, [this](int value){ this->renderedGame.numberOfEvents.Update(value); });
 
     if(showPlayerSelection)
     {
@@ -72,86 +83,15 @@ MainWindow::~MainWindow()
 
 void MainWindow::UpdateDisplay()
 {
-    auto playerInfos = this->gameInfo.PlayerInfos();
-    auto dealer = this->gameInfo.Dealer();
+    this->standingsModel->Refresh(this->gameInfo);
+    this->statisticsModel->Refresh(this->gameInfo);
+    this->historySelectionModel->Refresh(this->gameInfo);
 
-    // set visibility
-    for(unsigned int index = 0; index < this->MaxPlayers; ++index)
+    if(this->renderedGame.numberOfEvents.Update(0))
     {
-        bool visible = false;
-
-        if(index < playerInfos.size())
-        {
-            auto playerInfo = playerInfos[index];
-            visible = playerInfo->IsPresent() || playerInfo->HasPlayed();
-        }
-
-        ui->names[index]->setVisible(visible);
-        ui->lastGames[index]->setVisible(visible);
-        ui->actuals[index]->setVisible(visible);
-        ui->scores[index]->setVisible(visible);
-        ui->cashs[index]->setVisible(visible);
-
-        ui->statisticNames[index]->setVisible(visible);
-        ui->numberWons[index]->setVisible(visible);
-        ui->numberLosts[index]->setVisible(visible);
-        ui->numberPlayeds[index]->setVisible(visible);
-        ui->numberSoloWons[index]->setVisible(visible);
-        ui->numberSoloLosts[index]->setVisible(visible);
-        ui->pointsSolos[index]->setVisible(visible);
-        ui->maxSingleWins[index]->setVisible(visible);
-        ui->maxSingleLosss[index]->setVisible(visible);
-        ui->unmultipliedScores[index]->setVisible(visible);
-
-        ui->playerHistorySelectionCheckboxes[index]->setVisible(visible);
-        ui->playerHistorySelectionLabels[index]->setVisible(visible);
+        ui->spinBox->setValue(0);
     }
 
-    // set data
-    for(unsigned int index = 0; index < playerInfos.size(); ++index)
-    {
-        auto playerInfo = playerInfos[index];
-
-        QString name = QString::fromUtf8(playerInfo->Name());
-        ui->names[index]->setText(name);
-        if(dealer && playerInfo->Name() == dealer->Name())
-        {
-            ui->names[index]->setStyleSheet(this->DealerNamesStylesheet);
-        }
-        else
-        {
-            ui->names[index]->setStyleSheet(this->StandardNamesStylesheet);
-        }
-
-        ui->statisticNames[index]->setText(name);
-
-        ui->scores[index]->setText(QString().setNum(playerInfo->CurrentScore()));
-        ui->actuals[index]->setEnabled(playerInfo->IsPlaying());
-        ui->actuals[index]->clear();
-
-        ui->lastGames[index]->setText(playerInfo->ParticipatedInLastDeal() ? QString("%1").arg(playerInfo->ScoreInLastDeal()) : QString(""));
-
-        ui->cashs[index]->setText(QString("%1,%2").arg(playerInfo->CashCents()/CentsInEuro).arg(playerInfo->CashCents()%CentsInEuro, 2, DecimalBase, QLatin1Char('0')));
-
-        ui->numberWons[index]->setText(QString().setNum(playerInfo->NumberGamesWon()));
-        ui->numberLosts[index]->setText(QString().setNum(playerInfo->NumberGamesLost()));
-        ui->numberPlayeds[index]->setText(QString().setNum(playerInfo->NumberGames()));
-        ui->numberSoloWons[index]->setText(QString().setNum(playerInfo->SolosWon()));
-        ui->numberSoloLosts[index]->setText(QString().setNum(playerInfo->SolosLost()));
-        ui->pointsSolos[index]->setText(QString().setNum(playerInfo->TotalSoloPoints()));
-        ui->maxSingleWins[index]->setText(QString().setNum(playerInfo->MaxSingleWin()));
-        ui->maxSingleLosss[index]->setText(QString().setNum(playerInfo->MaxSingleLoss()));
-        ui->unmultipliedScores[index]->setText(QString().setNum(playerInfo->UnmultipliedScore()));
-
-        ui->playerHistorySelectionLabels[index]->setText(QString("<font color=\"#%1%2%3\">■</font> %4")
-                                                         .arg(this->htmlColors[index].red(),   2, HexadecimalBase, QLatin1Char('0'))
-                                                         .arg(this->htmlColors[index].green(), 2, HexadecimalBase, QLatin1Char('0'))
-                                                         .arg(this->htmlColors[index].blue(),  2, HexadecimalBase, QLatin1Char('0'))
-                                                         .arg(name.toUtf8()));
-    }
-
-    ui->spinBox->setValue(0);
-
     auto remaining = this->gameInfo.RemainingGamesInRound();
     QString remainingText;
     switch (remaining)
@@ -175,38 +115,41 @@ void MainWindow::UpdateDisplay()
         }
     }
 
-    ui->remainingGamesInRound->setText(remainingText);
+    SetTextIfChanged(this->renderedGame.remainingGamesInRound, ui->remainingGamesInRound, remainingText);
 
-    ui->totalCash->setText(QString("%1,%2 (inkl. %3,%4 pro Abwesender)")
-                           .arg(gameInfo.TotalCashCents()/CentsInEuro)
-                           .arg(gameInfo.TotalCashCents()%CentsInEuro, 2, DecimalBase, QLatin1Char('0'))
-                           .arg(gameInfo.AbsentPlayerCashCents()/CentsInEuro)
-                           .arg(gameInfo.AbsentPlayerCashCents()%CentsInEuro, 2, DecimalBase, QLatin1Char('0')));
+    SetTextIfChanged(this->renderedGame.totalCash, ui->totalCash, QString("%1 (inkl. %2 pro Abwesender)")
+                     .arg(StandingsTableModel::FormatCash(gameInfo.TotalCashCents()),
+                          StandingsTableModel::FormatCash(gameInfo.AbsentPlayerCashCents())));
 
-    ui->resetButton->setEnabled(this->gameInfo.LastPoppableEntry() != Backend::GameInfo::PoppableEntry::None);
+    if(this->renderedGame.resetEnabled.Update(this->gameInfo.LastPoppableEntry() != Backend::GameInfo::PoppableEntry::None))
+    {
+        ui->resetButton->setEnabled(this->gameInfo.LastPoppableEntry() != Backend::GameInfo::PoppableEntry::None);
+    }
+
+    QString resetLabel;
     switch(this->gameInfo.LastPoppableEntry())
     {
     case Backend::GameInfo::PoppableEntry::None:
     {
-        ui->resetButton->setText(this->ResetButtonLabelNone);
+        resetLabel = this->ResetButtonLabelNone;
         break;
     }
 
     case Backend::GameInfo::PoppableEntry::PlayersSet:
     {
-        ui->resetButton->setText(this->ResetButtonLabelPlayersSet);
+        resetLabel = this->ResetButtonLabelPlayersSet;
         break;
     }
 
     case Backend::GameInfo::PoppableEntry::Deal:
     {
-        ui->resetButton->setText(this->ResetButtonLabelDeal);
+        resetLabel = this->ResetButtonLabelDeal;
         break;
     }
 
     case Backend::GameInfo::PoppableEntry::MandatorySoloTrigger:
     {
-        ui->resetButton->setText(this->ResetButtonLabelMandatorySoloTrigger);
+        resetLabel = this->ResetButtonLabelMandatorySoloTrigger;
         break;
     }
 
@@ -214,41 +157,59 @@ void MainWindow::UpdateDisplay()
         throw std::exception("value of Backend::GameInfo::PoppableEntry not handled");
     }
 
-    ui->saveButton->setEnabled(this->gameInfo.HasPlayersSet());
-    ui->spinBox->setEnabled(this->gameInfo.HasPlayersSet());
-    ui->commitButton->setEnabled(this->gameInfo.HasPlayersSet());
+    if(this->renderedGame.resetLabel.Update(resetLabel))
+    {
+        ui->resetButton->setText(resetLabel);
+    }
+
+    if(this->renderedGame.playersSet.Update(this->gameInfo.HasPlayersSet()))
+    {
+        ui->saveButton->setEnabled(this->gameInfo.HasPlayersSet());
+        ui->spinBox->setEnabled(this->gameInfo.HasPlayersSet());
+        ui->commitButton->setEnabled(this->gameInfo.HasPlayersSet());
+    }
 
     this->DetermineAndSetMultiplierLabels();
-    ui->mandatorySoloButton->setEnabled(this->gameInfo.MandatorySolo() == Backend::GameInfo::MandatorySolo::Ready);
+
+    if(this->renderedGame.mandatorySoloReady.Update(this->gameInfo.MandatorySolo() == Backend::GameInfo::MandatorySolo::Ready))
+    {
+        ui->mandatorySoloButton->setEnabled(this->gameInfo.MandatorySolo() == Backend::GameInfo::MandatorySolo::Ready);
+    }
 
     this->RedrawPlayerHistory();
 }
 
+void MainWindow::SetTextIfChanged(RenderedValue<QString>& rendered, QLabel* label, const QString& text)
+{
+    if(rendered.Update(text))
+    {
+        label->setText(text);
+    }
+}
+
 void MainWindow::ShowPlayerSelection()
 {
     std::vector<std::pair<QString, bool>> currentPlayers;
     QString currentDealer;
     std::set<unsigned int> currentSitOutScheme;
 
-    if(!gameInfo.PlayerInfos().empty())
+    if(auto playerInfos = gameInfo.PlayerInfosView(); !playerInfos.empty())
     {
-        const std::vector<std::shared_ptr<Backend::PlayerInfo>> playerInfos = gameInfo.PlayerInfos();
-
         for(const auto & playerInfo : playerInfos)
         {
-            currentPlayers.emplace_back(QString::fromUtf8(playerInfo->Name()), playerInfo->IsPresent());
+            currentPlayers.emplace_back(QString::fromUtf8(playerInfo.Name()), playerInfo.IsPresent());
         }
 
-        std::string dealerName = gameInfo.Dealer()->Name();
-        auto dealerIt = std::find_if(playerInfos.cbegin(), playerInfos.cend(), [&](const std::shared_ptr<Backend::PlayerInfo>& left){ return left->Name() == dealerName; });
-        this->dealerIndex = dealerIt - playerInfos.cbegin();
+        auto dealer = gameInfo.Dealer();
+        auto dealerIt = std::ranges::find_if(playerInfos, [&](const Backend::PlayerInfo& playerInfo){ return &playerInfo == dealer.get(); });
+        this->dealerIndex = dealerIt - playerInfos.begin();
 
         currentSitOutScheme = gameInfo.SitOutScheme();
     }
     else
     {
         this->dealerIndex = 0;
-        currentPlayers = GetDefaultPlayers();
+        currentPlayers = GetDefaultPlayers(this->MaxPlayers);
     }
 
     currentDealer = currentPlayers[this->dealerIndex].first;
@@ -279,14 +240,34 @@ void MainWindow::ShowPlayerSelection()
 
     auto sitOutScheme = std::get<2>(result);
 
-    gameInfo.SetPlayers(players, dealer, sitOutScheme);
+    try
+    {
+        gameInfo.SetPlayers(players, dealer, sitOutScheme);
+    }
+    catch(std::exception & exception)
+    {
+        QString messageBoxTitle = QString::fromUtf8("Fehler");
+
+        QString messageBoxTextTemplate = QString::fromUtf8("Beim Setzen der Spieler aufgetretener Fehler: %1");
+        QString errorMesssage = QString::fromUtf8(exception.what());
+        QString messageBoxText = messageBoxTextTemplate.arg(errorMesssage);
+
+        auto errorBox = std::make_unique<QMessageBox>(
+                    QMessageBox::Icon::Critical,
+                    messageBoxTitle,
+                    messageBoxText);
+
+        errorBox->exec();
+
+        errorBox.reset();
+    }
 
     this->UpdateDisplay();
 }
 
-std::vector<std::pair<QString, bool>> MainWindow::GetDefaultPlayers()
+std::vector<std::pair<QString, bool>> MainWindow::GetDefaultPlayers(unsigned int numberOfPlayers)
 {
-    return std::vector<std::pair<QString, bool>>
+    std::vector<std::pair<QString, bool>> defaultPlayers
     {
 #ifdef MY_PLAYER_A
         std::pair<QString, bool>(QString::fromUtf8(MY_PLAYER_A), true),
@@ -329,66 +310,215 @@ std::vector<std::pair<QString, bool>> MainWindow::GetDefaultPlayers()
         std::pair<QString, bool>(QString::fromUtf8("Spieler H"), true),
 #endif
     };
+
+    // further players are named on, but only the configured ones are present at first
+    for(auto index = static_cast<unsigned int>(defaultPlayers.size()); index < numberOfPlayers; ++index)
+    {
+        defaultPlayers.emplace_back(QString::fromUtf8("Spieler %1").arg(index + 1), false);
+    }
+
+    return defaultPlayers;
+}
+
+std::vector<QColor> MainWindow::GenerateColors(unsigned int numberOfColors)
+{
+    std::vector<QColor> colors
+    {
+        QColor(0x7b, 0x1f, 0xa2), //NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+        QColor(0x00, 0x00, 0x00), //NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+        QColor(0xfb, 0x8c, 0x00), //NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+        QColor(0x00, 0x89, 0x7b), //NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+        QColor(0x39, 0x49, 0xab), //NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+        QColor(0xe5, 0x39, 0x35), //NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+        QColor(0x79, 0x55, 0x48), //NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+        QColor(0x21, 0x96, 0xf3)  //NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    };
+
+    // stepping the hue by the golden angle keeps neighbouring players apart for any number of them
+    const int goldenAngleDegrees = 137;
+    const int fullCircleDegrees = 360;
+    for(auto index = static_cast<unsigned int>(colors.size()); index < numberOfColors; ++index)
+    {
+        const int hue = static_cast<int>(index) * goldenAngleDegrees % fullCircleDegrees;
+        const int saturation = index % 2 == 0 ? 200 : 160; //NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+        const int value = index % 3 == 0 ? 150 : 200; //NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+        colors.push_back(QColor::fromHsv(hue, saturation, value));
+    }
+
+    return colors;
+}
+
+void MainWindow::OnGameChanged(const Backend::GameDelta& delta)
+{
+    auto update = HistoryUpdate::None;
+
+    if(delta.playersChanged || delta.history == Backend::GameDelta::History::Replaced)
+    {
+        update = HistoryUpdate::Rebuild;
+    }
+    else if(delta.history != Backend::GameDelta::History::Unchanged)
+    {
+        update = HistoryUpdate::Refresh;
+    }
+
+    // several changes before the next redraw are followed by the most thorough update
+    this->pendingHistoryUpdate = std::max(this->pendingHistoryUpdate, update);
+}
+
+void MainWindow::CreateHistoryLayers()
+{
+    auto * plot = ui->plotPlayerHistory;
+
+    // the graphs and the axes are buffered separately, so that one is not redrawn into the buffer of the other
+    plot->addLayer(HistoryLayerName, plot->layer(QString::fromUtf8("main")), QCustomPlot::limAbove);
+    plot->layer(HistoryLayerName)->setMode(QCPLayer::lmBuffered);
+    plot->layer(QString::fromUtf8("axes"))->setMode(QCPLayer::lmBuffered);
+}
+
+void MainWindow::EnsureHistoryGraphs(size_t numberOfPlayers)
+{
+    auto * plot = ui->plotPlayerHistory;
+
+    while(this->historyGraphs.size() < numberOfPlayers)
+    {
+        const auto position = this->historyGraphs.size();
+
+        auto * qcpGraph = plot->addGraph();
+        qcpGraph->setLayer(HistoryLayerName);
+
+        auto pen = QPen(this->htmlColors[position]);
+        pen.setWidth(3);
+        qcpGraph->setPen(pen);
+        qcpGraph->setVisible(this->historySelectionModel->IsSelected(position));
+
+        this->historyGraphs.push_back(qcpGraph);
+    }
 }
 
 void MainWindow::RedrawPlayerHistory()
 {
-    ui->plotPlayerHistory->clearGraphs();
+    auto update = std::exchange(this->pendingHistoryUpdate, HistoryUpdate::None);
 
     if(!gameInfo.HasPlayersSet())
     {
-        ui->plotPlayerHistory->replot();
+        for(unsigned int i = 0; i < this->historyGraphs.size(); ++i)
+        {
+            this->historyGraphs[i]->data()->clear();
+            this->historyGraphs[i]->setVisible(false);
+        }
+
+        this->ScheduleHistoryReplot();
         return;
     }
 
-    auto players = this->gameInfo.PlayerInfos();
-    auto map = this->GetHistoricData();
+    // the totals are read from the score table, so that only the shown graphs may have to change
+    if(update == HistoryUpdate::Rebuild)
+    {
+        this->UpdateHistoryGraphVisibility();
+    }
+
+    this->UpdateHistoryView();
+    this->ScheduleHistoryReplot();
+}
 
-    for(unsigned int i = 0; i < players.size(); ++i)
+void MainWindow::UpdateHistoryView()
+{
+    auto * xAxis = ui->plotPlayerHistory->xAxis;
+    auto deals = static_cast<double>(this->gameInfo.HasPlayersSet() ? this->gameInfo.DealsRecorded() : 0U);
+
+    if(this->historyShowsWholeSession)
     {
-        if(ui->playerHistorySelectionCheckboxes[i]->isChecked())
-        {
-            auto name = QString::fromUtf8(players[i]->Name());
-            auto data = map[name];
+        xAxis->setRange(this->ClampToHistory(xAxis->range()));
+    }
+    else
+    {
+        auto x = std::max(deals, 50.0); //NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+        xAxis->setRange(x - 50.0, x); //NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    }
 
-            QVector<double> dataX(data.first.begin(), data.first.end());
-            QVector<double> dataY(data.second.begin(), data.second.end());
+    this->RefreshHistoryGraphData();
+}
+
+QCPRange MainWindow::ClampToHistory(QCPRange range) const
+{
+    auto deals = static_cast<double>(this->gameInfo.HasPlayersSet() ? this->gameInfo.DealsRecorded() : 0U);
+    auto upperBound = std::max(deals, 1.0);
+    auto size = std::min(range.size(), upperBound);
 
-            dataX.insert(dataX.cbegin(), 0.0);
-            dataY.insert(dataY.cbegin(), 0.0);
+    range.lower = std::clamp(range.lower, 0.0, upperBound - size);
+    range.upper = range.lower + size;
 
-            auto * qcpGraph = ui->plotPlayerHistory->addGraph();
-            qcpGraph->addData(dataX, dataY, true);
+    return range;
+}
+
+void MainWindow::RefreshHistoryGraphData()
+{
+    // only the visible deals are handed to the plot, decimated to two points per pixel,
+    // while the view of the last deals is always given completely
+    auto range = ui->plotPlayerHistory->xAxis->range();
+    auto begin = static_cast<size_t>(std::max(0.0, std::floor(range.lower) - 1.0));
+    auto end = static_cast<size_t>(std::max(0.0, std::ceil(range.upper) + 2.0));
+    auto maximumPoints = std::max(2 * static_cast<size_t>(std::max(ui->plotPlayerHistory->axisRect()->width(), 0)), MinimumHistoryPoints);
+
+    auto players = this->gameInfo.PlayerInfosView();
+    this->EnsureHistoryGraphs(players.size());
+
+    for(unsigned int i = 0; i < this->historyGraphs.size(); ++i)
+    {
+        QVector<double> dataX;
+        QVector<double> dataY;
 
-            auto pen = QPen(this->htmlColors[i]);
-            pen.setWidth(3);
-            qcpGraph->setPen(pen);
+        if(i < players.size())
+        {
+            // the history starts from zero before the first deal, so that deal n is shown at n + 1
+            auto points = players[i].DecimatedScoreHistory(begin > 0 ? begin - 1 : 0, end > 0 ? end - 1 : 0, maximumPoints - 1);
+            dataX.reserve(static_cast<qsizetype>(points.size() + 1));
+            dataY.reserve(static_cast<qsizetype>(points.size() + 1));
+
+            if(begin == 0)
+            {
+                dataX.push_back(0.0);
+                dataY.push_back(0.0);
+            }
+
+            for(const auto & point : points)
+            {
+                dataX.push_back(static_cast<double>(point.row + 1));
+                dataY.push_back(static_cast<double>(point.total));
+            }
         }
-    }
 
-    auto x = static_cast<unsigned int>(map.begin()->second.first.size());
-    x = std::max(x, 50U); //NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-    ui->plotPlayerHistory->xAxis->setRange(x - 50U, x); //NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-    ui->plotPlayerHistory->yAxis->rescale();
+        this->historyGraphs[i]->setData(dataX, dataY, true);
+    }
 
-    ui->plotPlayerHistory->replot();
+    this->historyValueRangeDirty = true;
 }
 
-std::map<QString, std::pair<std::vector<int>, std::vector<int>>> MainWindow::GetHistoricData()
+void MainWindow::ScheduleHistoryReplot()
 {
-    std::map<QString, std::pair<std::vector<int>, std::vector<int>>> map;
+    // the plot queues at most one replot, so that any number of changes until then cost a single repaint
+    ui->plotPlayerHistory->replot(QCustomPlot::rpQueuedReplot);
+}
 
-    auto players = this->gameInfo.PlayerInfos();
+void MainWindow::OnHistoryBeforeReplot()
+{
+    if(std::exchange(this->historyValueRangeDirty, false))
+    {
+        ui->plotPlayerHistory->yAxis->rescale(true);
+    }
+}
 
-    std::vector<int> x(players[0]->ScoreHistory().size());
-    std::iota(x.begin(), x.end(), 1);
+void MainWindow::UpdateHistoryGraphVisibility()
+{
+    auto numberOfPlayers = this->gameInfo.PlayerInfosView().size();
+    this->EnsureHistoryGraphs(numberOfPlayers);
 
-    for (auto & player : players)
+    for(unsigned int i = 0; i < this->historyGraphs.size(); ++i)
     {
-        map[QString::fromUtf8(player->Name())] = std::make_pair(x, player->ScoreHistory());
+        this->historyGraphs[i]->setVisible(i < numberOfPlayers && this->historySelectionModel->IsSelected(i));
     }
 
-    return map;
+    this->historyValueRangeDirty = true;
 }
 
 void MainWindow::ShowAboutDialog()
@@ -414,30 +544,32 @@ void MainWindow::DetermineAndSetMultiplierLabels()
 {
     auto preview = this->gameInfo.MultiplierPreview();
 
+    QString currentGameMultiplier;
     if(this->gameInfo.MandatorySolo() == Backend::GameInfo::MandatorySolo::Active)
     {
-        ui->currentGameMultiplier->setText(QString("Pflichtsolorunde"));
+        currentGameMultiplier = QString("Pflichtsolorunde");
     }
     else if(preview[2] > 0)
     {
-        ui->currentGameMultiplier->setText(QString("Dreifachbock"));
+        currentGameMultiplier = QString("Dreifachbock");
     }
     else if(preview[1] > 0)
     {
-        ui->currentGameMultiplier->setText(QString("Doppelbock"));
+        currentGameMultiplier = QString("Doppelbock");
     }
     else if(preview[0] > 0)
     {
-        ui->currentGameMultiplier->setText(QString("Einfachbock"));
+        currentGameMultiplier = QString("Einfachbock");
     }
     else
     {
-        ui->currentGameMultiplier->setText(QString("Kein Bock"));
+        currentGameMultiplier = QString("Kein Bock");
     }
 
-    ui->tripleMultiplier->setText(QString::number(preview[2]));
-    ui->doubleMultiplier->setText(QString::number(preview[1]));
-    ui->singleMultiplier->setText(QString::number(preview[0]));
+    SetTextIfChanged(this->renderedGame.currentGameMultiplier, ui->currentGameMultiplier, currentGameMultiplier);
+    SetTextIfChanged(this->renderedGame.tripleMultiplier, ui->tripleMultiplier, QString::number(preview[2]));
+    SetTextIfChanged(this->renderedGame.doubleMultiplier, ui->doubleMultiplier, QString::number(preview[1]));
+    SetTextIfChanged(this->renderedGame.singleMultiplier, ui->singleMultiplier, QString::number(preview[0]));
 }
 
 QString MainWindow::GetFolderForFileDialog()
@@ -448,35 +580,16 @@ QString MainWindow::GetFolderForFileDialog()
 
 void MainWindow::CommitDeal()
 {
-    std::vector<std::pair<std::string, int>> changes;
-
-    for (unsigned int index = 0; index < this->MaxPlayers; ++index)
-    {
-        auto & actual = ui->actuals[index];
-
-        if(actual->isEnabled() && !actual->text().isEmpty())
-        {
-            bool intConversionOK = true;
-            int value = actual->text().toInt(&intConversionOK);
-            if(!intConversionOK)
-            {
-                return;
-            }
-
-            auto nameBytes = ui->names[index]->text().toUtf8();
-            std::string name(nameBytes.constData(), nameBytes.length());
-            changes.emplace_back(name, value);
-        }
-    }
-
-    if(changes.empty())
+    // nothing is committed, if an input is not a number or there is no input at all
+    auto changes = this->standingsModel->Changes();
+    if(!changes.has_value() || changes->empty())
     {
         return;
     }
 
     auto numberOfEvents = static_cast<unsigned int>(ui->spinBox->value());
 
-    this->gameInfo.PushDeal(changes, numberOfEvents);
+    this->gameInfo.PushDeal(*changes, numberOfEvents);
 
     this->UpdateDisplay();
 }
@@ -576,13 +689,12 @@ void MainWindow::OnCommitPressed()
 
 void MainWindow::OnResetPressed()
 {
-    auto playerInfos = this->gameInfo.PlayerInfos();
+    auto playerInfos = this->gameInfo.PlayerInfosView();
 
     std::vector<std::string> resetActuals;
-    std::transform(playerInfos.begin(),
-                   playerInfos.end(),
-                   std::back_inserter(resetActuals),
-                   [](const std::shared_ptr<Backend::PlayerInfo>& info){ return info->InputInLastDeal(); });
+    std::ranges::transform(playerInfos,
+                           std::back_inserter(resetActuals),
+                           [](const Backend::PlayerInfo& info){ return info.InputInLastDeal(); });
 
     auto numberOfEvents = this->gameInfo.LastNumberOfEvents();
 
@@ -593,50 +705,68 @@ void MainWindow::OnResetPressed()
 
     if(wasDeal)
     {
-        for (unsigned int index = 0; index < resetActuals.size(); ++index)
-        {
-            this->ui->actuals[index]->setText(QString::fromUtf8(resetActuals[index]));
-        }
-
+        this->standingsModel->SetInputs(resetActuals);
         this->ui->spinBox->setValue(static_cast<int>(numberOfEvents));
     }
 }
 
 void MainWindow::OnHistoryPlayerSelected()
 {
-    this->RedrawPlayerHistory();
+    // the data of the graphs is unaffected by the selection
+    this->UpdateHistoryGraphVisibility();
+
+    this->ScheduleHistoryReplot();
 }
 
-void MainWindow::OnAboutPressed()
+void MainWindow::OnHistoryRangeChanged(const QCPRange& newRange)
 {
-    this->ShowAboutDialog();
+    // the follow view sets its range itself, the whole session is panned and zoomed by the user
+    if(!this->historyShowsWholeSession)
+    {
+        return;
+    }
+
+    if(auto clamped = this->ClampToHistory(newRange); clamped != newRange)
+    {
+        ui->plotPlayerHistory->xAxis->setRange(clamped);
+        return;
+    }
+
+    this->RefreshHistoryGraphData();
+    this->ScheduleHistoryReplot();
 }
 
-void MainWindow::OnScoreInputFocused(ScoreLineEdit * scoreLineEdit, bool hasFocus)
+void MainWindow::OnWholeSessionToggled(bool checked)
 {
-    if(hasFocus)
+    this->historyShowsWholeSession = checked;
+
+    auto * plot = ui->plotPlayerHistory;
+    plot->setInteractions(checked ? QCP::Interactions(QCP::iRangeDrag | QCP::iRangeZoom) : QCP::Interactions());
+
+    if(checked)
     {
-        QSet<QString> set;
+        auto deals = static_cast<double>(this->gameInfo.HasPlayersSet() ? this->gameInfo.DealsRecorded() : 0U);
+        plot->xAxis->setRange(0.0, std::max(deals, 1.0));
+    }
 
-        for(unsigned int i = 0; i < MaxPlayers; ++i)
-        {
-            if(!this->ui->actuals[i]->isEnabled())
-            {
-                continue;
-            }
+    this->UpdateHistoryView();
+    this->ScheduleHistoryReplot();
+}
 
-            auto text = this->ui->actuals[i]->text();
-            if(text.isEmpty())
-            {
-                continue;
-            }
+void MainWindow::OnAboutPressed()
+{
+    this->ShowAboutDialog();
+}
 
-            set.insert(text);
-        }
+void MainWindow::OnScoreInputFocused(ScoreLineEdit * scoreLineEdit, const QModelIndex & index, bool hasFocus)
+{
+    if(hasFocus)
+    {
+        auto input = this->standingsModel->CommonInput();
 
-        if(set.count() == 1)
+        if(!input.isEmpty())
         {
-            scoreLineEdit->setText(*(set.begin()));
+            this->standingsModel->setData(index, input);
             QTimer::singleShot(0, scoreLineEdit, &QLineEdit::selectAll);
         }
     }
@@ -646,3 +776,11 @@ void MainWindow::OnScoreInputReturnKeyPressed()
 {
     this->CommitDeal();
 }
+
+void MainWindow::OpenScoreInputEditors()
+{
+    for(int row = 0; row < this->standingsModel->rowCount(); ++row)
+    {
+        this->ui->standingsTable->openPersistentEditor(this->standingsModel->index(row, StandingsTableModel::Input));
+    }
+}
@@ -21,12 +21,20 @@
 
 #include "../Backend/gameinfo.h"
 #include "../Backend/playerinfo.h"
+#include "historyselectionmodel.h"
 #include "playerselection_ui.h"
-#include "scorelineedit.h"
+#include "renderedvalue.h"
+#include "scoreinputdelegate.h"
+#include "standingstablemodel.h"
+#include "statisticstablemodel.h"
 #include <QMainWindow>
 #include <QMessageBox>
 
 class FrontendTest;
+class QCPGraph;
+class QLabel;
+class QSortFilterProxyModel;
+class QCPRange;
 
 QT_BEGIN_NAMESPACE
 namespace Ui { class MainWindow; }
@@ -36,19 +44,19 @@ class MainWindow : public QMainWindow //NOLINT (cppcoreguidelines-special-member
 {
     Q_OBJECT
 
+    // the labels of the multipliers show a preview for each of the three levels of bock
+    static_assert(Backend::MaximumBockLevel<Backend::HouseRules>() == 3U, "the window shows exactly three levels of bock");
+
     friend FrontendTest;
 
 private:
-    const int DecimalBase = 10;
-    const int HexadecimalBase = 16;
-    const unsigned int CentsInEuro = 100;
-    const QString StandardNamesStylesheet = QString::fromUtf8("QLabel { }");
-    const QString DealerNamesStylesheet = QString::fromUtf8("QLabel { border: 3px solid orange ; border-radius : 6px }");
     const QString FileFilter = QString::fromUtf8("Spiele (*.qdk)");
     const QString ResetButtonLabelNone = QString::fromUtf8("Zurücksetzen");
     const QString ResetButtonLabelPlayersSet  = QString::fromUtf8("Spielerwahl zurücksetzen");
     const QString ResetButtonLabelDeal = QString::fromUtf8("Spiel zurücksetzen");
     const QString ResetButtonLabelMandatorySoloTrigger = QString::fromUtf8("Pflichtsolo zurücksetzen");
+    const QString HistoryLayerName = QString::fromUtf8("history");
+    const size_t MinimumHistoryPoints = 64U;
     const unsigned int MaxPlayers;
     std::vector<QColor> htmlColors;
     Ui::MainWindow *ui;
@@ -57,6 +65,78 @@ private:
     Backend::GameInfo gameInfo;
     unsigned int dealerIndex{};
 
+    /*!
+     * \brief The RenderedGame struct holds the values last rendered for the game as a whole.
+     */
+    struct RenderedGame
+    {
+        RenderedValue<QString> remainingGamesInRound;
+        RenderedValue<int> numberOfEvents;
+        RenderedValue<QString> totalCash;
+        RenderedValue<bool> resetEnabled;
+        RenderedValue<QString> resetLabel;
+        RenderedValue<bool> playersSet;
+        RenderedValue<bool> mandatorySoloReady;
+        RenderedValue<QString> currentGameMultiplier;
+        RenderedValue<QString> tripleMultiplier;
+        RenderedValue<QString> doubleMultiplier;
+        RenderedValue<QString> singleMultiplier;
+    };
+
+    /*!
+     * \brief renderedGame allows UpdateDisplay to touch only the widgets,
+     *        whose text, visibility or enabled state actually changed.
+     */
+    RenderedGame renderedGame;
+
+    /*!
+     * \brief statisticsModel presents the statistics in a table, which is sorted by statisticsProxyModel.
+     *        Both are owned by the window.
+     */
+    StatisticsTableModel *statisticsModel;
+    QSortFilterProxyModel *statisticsProxyModel;
+
+    /*!
+     * \brief standingsModel presents the standings in a table, whose inputs are edited by scoreInputDelegate.
+     *        Both are owned by the window.
+     */
+    StandingsTableModel *standingsModel;
+    ScoreInputDelegate *scoreInputDelegate;
+
+    /*!
+     * \brief historySelectionModel presents the shown players, whose histories are selected by checking them.
+     *        It is owned by the window.
+     */
+    HistorySelectionModel *historySelectionModel;
+
+    /*!
+     * \brief The HistoryUpdate enum lists how the history plot has to follow the game:
+     *        Not at all,
+     *        by refreshing the points of the visible deals,
+     *        by also updating which graphs are shown.
+     */
+    enum class HistoryUpdate
+    {
+        None,
+        Refresh,
+        Rebuild
+    };
+
+    /*!
+     * \brief historyGraphs holds one persistent graph per position of a player, created once a player takes the position,
+     *        which only gets the points of the visible deals decimated from the totals in the score table.
+     */
+    std::vector<QCPGraph*> historyGraphs;
+
+    bool historyShowsWholeSession{};
+    HistoryUpdate pendingHistoryUpdate = HistoryUpdate::Rebuild;
+
+    /*!
+     * \brief historyValueRangeDirty indicates that the value axis must be fitted to the visible graphs
+     *        before the next replot, which happens once for any number of changes.
+     */
+    bool historyValueRangeDirty{};
+
     /*!
      * \brief presetFilename allows to set a filename and
      *        thus circumvent the file dialog, e.g. for testing.
@@ -72,10 +152,20 @@ public:
 
 private:
     void UpdateDisplay();
+    static void SetTextIfChanged(RenderedValue<QString>& rendered, QLabel* label, const QString& text); //NOLINT (google-runtime-references)
     void ShowPlayerSelection();
-    static std::vector<std::pair<QString, bool>> GetDefaultPlayers();
-    std::map<QString, std::pair<std::vector<int>,std::vector<int>>> GetHistoricData();
+    static std::vector<std::pair<QString, bool>> GetDefaultPlayers(unsigned int numberOfPlayers);
+    static std::vector<QColor> GenerateColors(unsigned int numberOfColors);
+    void OnGameChanged(const Backend::GameDelta& delta);
+    void CreateHistoryLayers();
+    void EnsureHistoryGraphs(size_t numberOfPlayers);
     void RedrawPlayerHistory();
+    void UpdateHistoryView();
+    [[nodiscard]] QCPRange ClampToHistory(QCPRange range) const;
+    void RefreshHistoryGraphData();
+    void OnHistoryRangeChanged(const QCPRange& newRange);
+    void UpdateHistoryGraphVisibility();
+    void ScheduleHistoryReplot();
     void ShowAboutDialog();
     void DetermineAndSetMultiplierLabels();
     static QString GetFolderForFileDialog();
@@ -89,9 +179,12 @@ private slots:
     void OnCommitPressed();
     void OnResetPressed();
     void OnHistoryPlayerSelected();
+    void OnHistoryBeforeReplot();
+    void OnWholeSessionToggled(bool checked);
     void OnAboutPressed();
-    void OnScoreInputFocused(ScoreLineEdit * scoreLineEdit, bool hasFocus);
+    void OnScoreInputFocused(ScoreLineEdit * scoreLineEdit, const QModelIndex & index, bool hasFocus);
     void OnScoreInputReturnKeyPressed();
+    void OpenScoreInputEditors();
 
 private:
     /*!
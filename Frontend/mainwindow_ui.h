@@ -20,18 +20,21 @@
 #define UI_MAINWINDOW_H
 
 #include "qcustomplot.h"
-#include "scorelineedit.h"
 #include <QtCore/QVariant>
 #include <QtWidgets/QApplication>
 #include <QtWidgets/QGridLayout>
 #include <QtWidgets/QGroupBox>
+#include <QtWidgets/QHeaderView>
 #include <QtWidgets/QHBoxLayout>
 #include <QtWidgets/QLabel>
 #include <QtWidgets/QLineEdit>
+#include <QtWidgets/QListView>
 #include <QtWidgets/QMainWindow>
 #include <QtWidgets/QPushButton>
+#include <QtWidgets/QScrollArea>
 #include <QtWidgets/QSpacerItem>
 #include <QtWidgets/QSpinBox>
+#include <QtWidgets/QTableView>
 #include <QtWidgets/QVBoxLayout>
 #include <QtWidgets/QWidget>
 
@@ -46,20 +49,18 @@ class Ui_MainWindow
     friend FrontendTest;
 
 protected:
-    explicit Ui_MainWindow(const unsigned int maxPlayers) //NOLINT(cppcoreguidelines-pro-type-member-init)
-        : maxNumberOfPlayers(maxPlayers)
-    {
-    }
+    Ui_MainWindow() = default;
 
 private:
     const int experimentalWidthOfResetButton = 145;
-    const unsigned int maxNumberOfPlayers;
-    const QString ScoreStylesheet = QString::fromUtf8("QLabel { font-weight: bold ; font-size: 12pt }");
+    const int experimentalMaximumHeightOfPlayerHistorySelection = 120;
+    const int playerHistorySelectionSpacing = 4;
     const QString MultiplierStylesheet = QString::fromUtf8("QLabel { font-weight: bold ; font-size: 12pt }");
 
     QWidget *centralwidget{};
     QHBoxLayout *centralLayout{};
 
+    QScrollArea *leftScrollArea{};
     QWidget *leftwidget{};
     QVBoxLayout *leftVerticalLayout{};
 
@@ -76,14 +77,7 @@ private:
     QSpacerItem *topMenuSpacer{};
 
     QGridLayout *namesLayout{};
-    QLabel *namenLabel{};
-    std::vector<QLabel*> names;
-
-    QLabel *letztesLabel{};
-    std::vector<QLabel*> lastGames;
-
-    QLabel *aktuellesLabel{};
-    std::vector<ScoreLineEdit*> actuals;
+    QTableView *standingsTable{};
 
     QWidget *controlWidget{};
     QHBoxLayout *horizontalLayout{};
@@ -96,40 +90,12 @@ private:
     QSpacerItem *controlSpacer2{};
     QPushButton *resetButton{};
 
-    QLabel *spielstandLabel{};
-    std::vector<QLabel*> scores;
-
-    QSpacerItem *verticalSpacer{};
-
-    QLabel *zuZahlenLabel{};
-    std::vector<QLabel*> cashs;
-
     QLabel *kassenstandLabel{};
     QLabel *totalCash{};
 
     QGroupBox *statisticsBox{};
-    QGridLayout *statisticsGridLayout{};
-
-    QLabel *gewonnenLabel{};
-    QLabel *verlorenLabel{};
-    QLabel *anzahlSpieleLabel{};
-    QLabel *soloGewonnenLabel{};
-    QLabel *soloVerlorenLabel{};
-    QLabel *soloPunkteLabel{};
-    QLabel *groessterGewinnLabel{};
-    QLabel *groessterVerlustLabel{};
-    QLabel *ohneBockLabel{};
-
-    std::vector<QLabel*> statisticNames;
-    std::vector<QLabel*> numberWons;
-    std::vector<QLabel*> numberLosts;
-    std::vector<QLabel*> numberPlayeds;
-    std::vector<QLabel*> numberSoloWons;
-    std::vector<QLabel*> numberSoloLosts;
-    std::vector<QLabel*> pointsSolos;
-    std::vector<QLabel*> maxSingleWins;
-    std::vector<QLabel*> maxSingleLosss;
-    std::vector<QLabel*> unmultipliedScores;
+    QVBoxLayout *statisticsLayout{};
+    QTableView *statisticsTable{};
 
     QLabel *currentGameMultiplier{};
     QWidget *multiplierPreviewWidget{};
@@ -141,18 +107,14 @@ private:
     QLabel *doubleMultiplier{};
     QLabel *singleMultiplier{};
 
-    QWidget *playerHistorySelectionWidget{};
-    QGridLayout *playerHistoryGridLayout{};
-    std::vector<QHBoxLayout*> playerHistorySelectionLayouts;
-    std::vector<QCheckBox*> playerHistorySelectionCheckboxes;
-    std::vector<QLabel*> playerHistorySelectionLabels;
+    QListView *playerHistorySelection{};
+    QPushButton *wholeSessionButton{};
     QCustomPlot *plotPlayerHistory{};
 
 public:
     void setupUi(QMainWindow *MainWindow)
     {
-        const int leftLabelsMaxWidth = 80;
-        const int leftMainMaxWidth = 75;
+        const int fullRowSpan = 2;
 
         if (MainWindow->objectName().isEmpty())
         {
@@ -189,12 +151,19 @@ public:
         centralLayout = new QHBoxLayout(centralwidget); //NOLINT(cppcoreguidelines-owning-memory
         centralLayout->setObjectName(QString::fromUtf8("centralLayout"));
 
-        leftwidget = new QWidget(centralwidget); //NOLINT(cppcoreguidelines-owning-memory
+        // the standings and the statistics grow with the table, hence scroll
+        leftScrollArea = new QScrollArea(centralwidget); //NOLINT(cppcoreguidelines-owning-memory
+        leftScrollArea->setObjectName(QString::fromUtf8("leftScrollArea"));
+        leftScrollArea->setWidgetResizable(true);
+        leftScrollArea->setFrameShape(QFrame::NoFrame);
+        centralLayout->addWidget(leftScrollArea);
+
+        leftwidget = new QWidget(); //NOLINT(cppcoreguidelines-owning-memory
         leftwidget->setObjectName(QString::fromUtf8("leftwidget"));
-        centralLayout->addWidget(leftwidget);
 
         leftVerticalLayout = new QVBoxLayout(leftwidget); //NOLINT(cppcoreguidelines-owning-memory
         leftVerticalLayout->setObjectName(QString::fromUtf8("leftVerticalLayout"));
+        leftScrollArea->setWidget(leftwidget);
 
         namesLayout = new QGridLayout(); //NOLINT(cppcoreguidelines-owning-memory
         namesLayout->setObjectName(QString::fromUtf8("namesLayout"));
@@ -247,50 +216,20 @@ public:
         sizePolicyMinMin.setHeightForWidth(loadButton->sizePolicy().hasHeightForWidth());
         loadButton->setSizePolicy(sizePolicyMinMin);
 
-        namesLayout->addWidget(topMenu, 0, 0, 1, 9);
+        namesLayout->addWidget(topMenu, 0, 0, 1, fullRowSpan);
 
         // ---- NAMES AND SCORE ENTRY SECTION ----
 
-        namenLabel = new QLabel(centralwidget); //NOLINT(cppcoreguidelines-owning-memory
-        namenLabel->setObjectName(QString::fromUtf8("namenLabel"));
-        namenLabel->setSizePolicy(sizePolicyPreFix);
-        sizePolicyPreFix.setHeightForWidth(namenLabel->sizePolicy().hasHeightForWidth());
-
-        namesLayout->addWidget(namenLabel, 1, 0, 1, 1);
-
-        letztesLabel = new QLabel(centralwidget); //NOLINT(cppcoreguidelines-owning-memory
-        letztesLabel->setObjectName(QString::fromUtf8("letztesLabel"));
-        sizePolicyPreFix.setHeightForWidth(letztesLabel->sizePolicy().hasHeightForWidth());
-        letztesLabel->setSizePolicy(sizePolicyPreFix);
+        // one row per shown player given by a model, the inputs of the current deal being persistent editors
+        standingsTable = new QTableView(centralwidget); //NOLINT(cppcoreguidelines-owning-memory
+        standingsTable->setObjectName(QString::fromUtf8("standingsTable"));
+        standingsTable->setSelectionMode(QAbstractItemView::NoSelection);
+        standingsTable->setEditTriggers(QAbstractItemView::NoEditTriggers);
+        standingsTable->setTabKeyNavigation(false);
+        standingsTable->verticalHeader()->setVisible(false);
+        standingsTable->horizontalHeader()->setSectionResizeMode(QHeaderView::Stretch);
 
-        namesLayout->addWidget(letztesLabel, 2, 0, 1, 1);
-
-        aktuellesLabel = new QLabel(centralwidget); //NOLINT(cppcoreguidelines-owning-memory
-        aktuellesLabel->setObjectName(QString::fromUtf8("aktuellesLabel"));
-        aktuellesLabel->setMaximumWidth(leftLabelsMaxWidth);
-
-        namesLayout->addWidget(aktuellesLabel, 3, 0, 1, 1);
-
-        for(unsigned int i=0U; i < maxNumberOfPlayers; ++i)
-        {
-            QLabel * name = new QLabel(centralwidget); //NOLINT(cppcoreguidelines-owning-memory
-            name->setAlignment(Qt::AlignCenter);
-            name->setObjectName(QString::fromUtf8("names%1").arg(i));
-            namesLayout->addWidget(name, 1, static_cast<int>(i+1), 1, 1);
-            names.push_back(name);
-
-            QLabel * lastGame = new QLabel(centralwidget); //NOLINT(cppcoreguidelines-owning-memory
-            lastGame->setAlignment(Qt::AlignCenter);
-            lastGame->setObjectName(QString::fromUtf8("lastGames%1").arg(i));
-            namesLayout->addWidget(lastGame, 2, static_cast<int>(i+1), 1, 1);
-            lastGames.push_back(lastGame);
-
-            ScoreLineEdit * actual = new ScoreLineEdit(centralwidget); //NOLINT(cppcoreguidelines-owning-memory
-            actual->setObjectName(QString::fromUtf8("actuals%1").arg(i));
-            actual->setMaximumWidth(leftMainMaxWidth);
-            namesLayout->addWidget(actual, 3, static_cast<int>(i+1), 1, 1);
-            actuals.push_back(actual);
-        }
+        namesLayout->addWidget(standingsTable, 1, 0, 1, fullRowSpan);
 
         // ---- CONTROLS BELOW NAMES ----
 
@@ -343,52 +282,19 @@ public:
 
         horizontalLayout->addWidget(resetButton);
 
-        namesLayout->addWidget(controlWidget, 4, 0, 1, 9);
-
-        // ---- CURRENT SCORE AND CASH SECTION ----
-
-        spielstandLabel = new QLabel(centralwidget); //NOLINT(cppcoreguidelines-owning-memory
-        spielstandLabel->setObjectName(QString::fromUtf8("spielstandLabel"));
-        spielstandLabel->setStyleSheet(ScoreStylesheet);
-
-        namesLayout->addWidget(spielstandLabel, 5, 0, 1, 1);
-
-        verticalSpacer = new QSpacerItem(20, 20, QSizePolicy::Minimum, QSizePolicy::Fixed); //NOLINT(cppcoreguidelines-owning-memory
+        namesLayout->addWidget(controlWidget, 2, 0, 1, fullRowSpan);
 
-        namesLayout->addItem(verticalSpacer, 6, 0, 1, 1);
-
-        zuZahlenLabel = new QLabel(centralwidget); //NOLINT(cppcoreguidelines-owning-memory
-        zuZahlenLabel->setObjectName(QString::fromUtf8("zuZahlenLabel"));
-        sizePolicyPreFix.setHeightForWidth(zuZahlenLabel->sizePolicy().hasHeightForWidth());
-        zuZahlenLabel->setSizePolicy(sizePolicyPreFix);
-
-        namesLayout->addWidget(zuZahlenLabel, 7, 0, 1, 1);
-
-        for(unsigned int i=0U; i < maxNumberOfPlayers; ++i)
-        {
-            QLabel * score = new QLabel(centralwidget); //NOLINT(cppcoreguidelines-owning-memory
-            score->setAlignment(Qt::AlignCenter);
-            score->setObjectName(QString::fromUtf8("scores%1").arg(i));
-            score->setStyleSheet(ScoreStylesheet);
-            namesLayout->addWidget(score, 5, static_cast<int>(i+1), 1, 1);
-            scores.push_back(score);
-
-            QLabel * cash = new QLabel(centralwidget); //NOLINT(cppcoreguidelines-owning-memory
-            cash->setAlignment(Qt::AlignCenter);
-            cash->setObjectName(QString::fromUtf8("cashs%1").arg(i));
-            namesLayout->addWidget(cash, 7, static_cast<int>(i+1), 1, 1);
-            cashs.push_back(cash);
-        }
+        // ---- CASH SECTION ----
 
         totalCash = new QLabel(centralwidget); //NOLINT(cppcoreguidelines-owning-memory
         totalCash->setObjectName(QString::fromUtf8("totalCash"));
 
-        namesLayout->addWidget(totalCash, 8, 3, 1, 6);
+        namesLayout->addWidget(totalCash, 3, 1, 1, 1);
 
         kassenstandLabel = new QLabel(centralwidget); //NOLINT(cppcoreguidelines-owning-memory
         kassenstandLabel->setObjectName(QString::fromUtf8("kassenstandLabel"));
 
-        namesLayout->addWidget(kassenstandLabel, 8, 0, 1, 3);
+        namesLayout->addWidget(kassenstandLabel, 3, 0, 1, 1);
 
         leftVerticalLayout->addLayout(namesLayout);
 
@@ -396,115 +302,20 @@ public:
 
         statisticsBox = new QGroupBox(centralwidget); //NOLINT(cppcoreguidelines-owning-memory
         statisticsBox->setObjectName(QString::fromUtf8("statisticsBox"));
-        statisticsGridLayout = new QGridLayout(statisticsBox); //NOLINT(cppcoreguidelines-owning-memory
-        statisticsGridLayout->setObjectName(QString::fromUtf8("statisticsGridLayout"));
-
-        gewonnenLabel = new QLabel(statisticsBox); //NOLINT(cppcoreguidelines-owning-memory
-        gewonnenLabel->setObjectName(QString::fromUtf8("gewonnenLabel"));
-
-        statisticsGridLayout->addWidget(gewonnenLabel, 0, 1, 1, 1);
-
-        verlorenLabel = new QLabel(statisticsBox); //NOLINT(cppcoreguidelines-owning-memory
-        verlorenLabel->setObjectName(QString::fromUtf8("verlorenLabel"));
-
-        statisticsGridLayout->addWidget(verlorenLabel, 0, 2, 1, 1);
-
-        anzahlSpieleLabel = new QLabel(statisticsBox); //NOLINT(cppcoreguidelines-owning-memory
-        anzahlSpieleLabel->setObjectName(QString::fromUtf8("anzahlSpieleLabel"));
-
-        statisticsGridLayout->addWidget(anzahlSpieleLabel, 0, 3, 1, 1);
-
-        soloGewonnenLabel = new QLabel(statisticsBox); //NOLINT(cppcoreguidelines-owning-memory
-        soloGewonnenLabel->setObjectName(QString::fromUtf8("soloGewonnenLabel"));
-
-        statisticsGridLayout->addWidget(soloGewonnenLabel, 0, 4, 1, 1);
-
-        soloVerlorenLabel = new QLabel(statisticsBox); //NOLINT(cppcoreguidelines-owning-memory
-        soloVerlorenLabel->setObjectName(QString::fromUtf8("soloVerlorenLabel"));
-
-        statisticsGridLayout->addWidget(soloVerlorenLabel, 0, 5, 1, 1);
-
-        soloPunkteLabel = new QLabel(statisticsBox); //NOLINT(cppcoreguidelines-owning-memory
-        soloPunkteLabel->setObjectName(QString::fromUtf8("soloPunkteLabel"));
-
-        statisticsGridLayout->addWidget(soloPunkteLabel, 0, 6, 1, 1);
-
-        groessterGewinnLabel = new QLabel(statisticsBox); //NOLINT(cppcoreguidelines-owning-memory
-        groessterGewinnLabel->setObjectName(QString::fromUtf8("groessterGewinnLabel"));
-
-        statisticsGridLayout->addWidget(groessterGewinnLabel, 0, 7, 1, 1);
-
-        groessterVerlustLabel = new QLabel(statisticsBox); //NOLINT(cppcoreguidelines-owning-memory
-        groessterVerlustLabel->setObjectName(QString::fromUtf8("groessterVerlustLabel"));
-
-        statisticsGridLayout->addWidget(groessterVerlustLabel, 0, 8, 1, 1);
-
-        ohneBockLabel = new QLabel(statisticsBox); //NOLINT(cppcoreguidelines-owning-memory
-        ohneBockLabel->setObjectName(QString::fromUtf8("ohneBockLabel"));
-
-        statisticsGridLayout->addWidget(ohneBockLabel, 0, 9, 1, 1);
-
-        for(unsigned int i=0U; i < maxNumberOfPlayers; ++i)
-        {
-            QLabel * statisticName = new QLabel(statisticsBox); //NOLINT(cppcoreguidelines-owning-memory
-            statisticName->setObjectName(QString::fromUtf8("statisticNames%1").arg(i));
-            statisticsGridLayout->addWidget(statisticName, static_cast<int>(i+1), 0, 1, 1);
-            statisticNames.push_back(statisticName);
-
-            QLabel * numberWon = new QLabel(statisticsBox); //NOLINT(cppcoreguidelines-owning-memory
-            numberWon->setAlignment(Qt::AlignCenter);
-            numberWon->setObjectName(QString::fromUtf8("numberWons%1").arg(i));
-            statisticsGridLayout->addWidget(numberWon, static_cast<int>(i+1), 1, 1, 1);
-            numberWons.push_back(numberWon);
-
-            QLabel * numberLost = new QLabel(statisticsBox); //NOLINT(cppcoreguidelines-owning-memory
-            numberLost->setAlignment(Qt::AlignCenter);
-            numberLost->setObjectName(QString::fromUtf8("numberLosts%1").arg(i));
-            statisticsGridLayout->addWidget(numberLost, static_cast<int>(i+1), 2, 1, 1);
-            numberLosts.push_back(numberLost);
-
-            QLabel * numberPlayed = new QLabel(statisticsBox); //NOLINT(cppcoreguidelines-owning-memory
-            numberPlayed->setAlignment(Qt::AlignCenter);
-            numberPlayed->setObjectName(QString::fromUtf8("numberPlayeds%1").arg(i));
-            statisticsGridLayout->addWidget(numberPlayed, static_cast<int>(i+1), 3, 1, 1);
-            numberPlayeds.push_back(numberPlayed);
-
-            QLabel * numberSoloWon = new QLabel(statisticsBox); //NOLINT(cppcoreguidelines-owning-memory
-            numberSoloWon->setAlignment(Qt::AlignCenter);
-            numberSoloWon->setObjectName(QString::fromUtf8("numberSoloWons%1").arg(i));
-            statisticsGridLayout->addWidget(numberSoloWon, static_cast<int>(i+1), 4, 1, 1);
-            numberSoloWons.push_back(numberSoloWon);
-
-            QLabel * numberSoloLost = new QLabel(statisticsBox); //NOLINT(cppcoreguidelines-owning-memory
-            numberSoloLost->setAlignment(Qt::AlignCenter);
-            numberSoloLost->setObjectName(QString::fromUtf8("numberSoloLosts%1").arg(i));
-            statisticsGridLayout->addWidget(numberSoloLost, static_cast<int>(i+1), 5, 1, 1);
-            numberSoloLosts.push_back(numberSoloLost);
-
-            QLabel * pointsSolo = new QLabel(statisticsBox); //NOLINT(cppcoreguidelines-owning-memory
-            pointsSolo->setAlignment(Qt::AlignCenter);
-            pointsSolo->setObjectName(QString::fromUtf8("pointsSolos%1").arg(i));
-            statisticsGridLayout->addWidget(pointsSolo, static_cast<int>(i+1), 6, 1, 1);
-            pointsSolos.push_back(pointsSolo);
-
-            QLabel * maxSingleWin = new QLabel(statisticsBox); //NOLINT(cppcoreguidelines-owning-memory
-            maxSingleWin->setAlignment(Qt::AlignCenter);
-            maxSingleWin->setObjectName(QString::fromUtf8("maxSingleWins%1").arg(i));
-            statisticsGridLayout->addWidget(maxSingleWin, static_cast<int>(i+1), 7, 1, 1);
-            maxSingleWins.push_back(maxSingleWin);
-
-            QLabel * maxSingleLoss = new QLabel(statisticsBox); //NOLINT(cppcoreguidelines-owning-memory
-            maxSingleLoss->setAlignment(Qt::AlignCenter);
-            maxSingleLoss->setObjectName(QString::fromUtf8("maxSingleLosss%1").arg(i));
-            statisticsGridLayout->addWidget(maxSingleLoss, static_cast<int>(i+1), 8, 1, 1);
-            maxSingleLosss.push_back(maxSingleLoss);
-
-            QLabel * unmultipliedScore = new QLabel(statisticsBox); //NOLINT(cppcoreguidelines-owning-memory
-            unmultipliedScore->setAlignment(Qt::AlignCenter);
-            unmultipliedScore->setObjectName(QString::fromUtf8("unmultipliedScores%1").arg(i));
-            statisticsGridLayout->addWidget(unmultipliedScore, static_cast<int>(i+1), 9, 1, 1);
-            unmultipliedScores.push_back(unmultipliedScore);
-        }
+        statisticsLayout = new QVBoxLayout(statisticsBox); //NOLINT(cppcoreguidelines-owning-memory
+        statisticsLayout->setObjectName(QString::fromUtf8("statisticsLayout"));
+
+        // the rows are given by a model, so that only the visible ones are rendered,
+        // and they keep the order of the seats until sorted by a column
+        statisticsTable = new QTableView(statisticsBox); //NOLINT(cppcoreguidelines-owning-memory
+        statisticsTable->setObjectName(QString::fromUtf8("statisticsTable"));
+        statisticsTable->horizontalHeader()->setSortIndicator(-1, Qt::AscendingOrder);
+        statisticsTable->setSortingEnabled(true);
+        statisticsTable->setSelectionMode(QAbstractItemView::NoSelection);
+        statisticsTable->setEditTriggers(QAbstractItemView::NoEditTriggers);
+        statisticsTable->verticalHeader()->setVisible(false);
+        statisticsTable->horizontalHeader()->setSectionResizeMode(QHeaderView::ResizeToContents);
+        statisticsLayout->addWidget(statisticsTable);
 
         leftVerticalLayout->addWidget(statisticsBox);
 
@@ -550,41 +361,21 @@ public:
 
         rightVerticalLayout->addWidget(multiplierPreviewWidget);
 
-        playerHistorySelectionWidget = new QWidget(rightwidget); //NOLINT(cppcoreguidelines-owning-memory
-        playerHistorySelectionWidget->setObjectName(QString::fromUtf8("playerHistorySelectionWidget"));
-        playerHistoryGridLayout = new QGridLayout(playerHistorySelectionWidget); //NOLINT(cppcoreguidelines-owning-memory
-
-        unsigned int breaker = (maxNumberOfPlayers - maxNumberOfPlayers / 2);
-        if(breaker < 2)
-        {
-            breaker = 2;
-        }
-
-        for(unsigned int i=0U; i < maxNumberOfPlayers; ++i)
-        {
-            int row = i < breaker ? 0 : 1;
-
-            QHBoxLayout * layout = new QHBoxLayout(/*playerHistoryGridLayout later*/); //NOLINT(cppcoreguidelines-owning-memory
-            layout->setObjectName(QString::fromUtf8("playerHistorySelectionLayout%1").arg(i));
-            playerHistorySelectionLayouts.push_back(layout);
-
-            QCheckBox * checkBox = new QCheckBox(playerHistorySelectionWidget); //NOLINT(cppcoreguidelines-owning-memory
-            checkBox->setObjectName(QString::fromUtf8("playerHistorySelectionCheckbox%1").arg(i));
-            checkBox->setChecked(true);
-            layout->addWidget(checkBox);
-            playerHistorySelectionCheckboxes.push_back(checkBox);
-
-            QLabel * label = new QLabel(QString::fromUtf8("<b>!HTML</b>!Player")); //NOLINT(cppcoreguidelines-owning-memory
-            label->setObjectName(QString::fromUtf8("playerHistorySelectionLabel%1").arg(i));
-            layout->addWidget(label);
-            playerHistorySelectionLabels.push_back(label);
-
-            layout->addStretch(4);
-
-            playerHistoryGridLayout->addLayout(layout, row, static_cast<int>(i%breaker), 1, 1);
-        }
-
-        rightVerticalLayout->addWidget(playerHistorySelectionWidget);
+        // the players to show the history of are given by a model, which only holds the players shown
+        playerHistorySelection = new QListView(rightwidget); //NOLINT(cppcoreguidelines-owning-memory
+        playerHistorySelection->setObjectName(QString::fromUtf8("playerHistorySelection"));
+        playerHistorySelection->setFlow(QListView::LeftToRight);
+        playerHistorySelection->setWrapping(true);
+        playerHistorySelection->setResizeMode(QListView::Adjust);
+        playerHistorySelection->setSpacing(playerHistorySelectionSpacing);
+        playerHistorySelection->setFrameShape(QFrame::NoFrame);
+        playerHistorySelection->setMaximumHeight(experimentalMaximumHeightOfPlayerHistorySelection);
+        rightVerticalLayout->addWidget(playerHistorySelection);
+
+        wholeSessionButton = new QPushButton(rightwidget); //NOLINT(cppcoreguidelines-owning-memory
+        wholeSessionButton->setObjectName(QString::fromUtf8("wholeSessionButton"));
+        wholeSessionButton->setCheckable(true);
+        rightVerticalLayout->addWidget(wholeSessionButton);
 
         plotPlayerHistory = new QCustomPlot(rightwidget); //NOLINT(cppcoreguidelines-owning-memory
         plotPlayerHistory->setObjectName(QString::fromUtf8("plotPlayerHistory"));
@@ -593,26 +384,16 @@ public:
 
         MainWindow->setCentralWidget(centralwidget);
 
-        for(unsigned int i=0U; i < maxNumberOfPlayers - 1; ++i)
-        {
-            QWidget::setTabOrder(actuals[i], actuals[i+1]);
-        }
-
-        QWidget::setTabOrder(actuals[maxNumberOfPlayers - 1], spinBox);
+        QWidget::setTabOrder(standingsTable, spinBox);
         QWidget::setTabOrder(spinBox, commitButton);
         QWidget::setTabOrder(commitButton, resetButton);
         QWidget::setTabOrder(resetButton, changePlayersButton);
         QWidget::setTabOrder(changePlayersButton, loadButton);
         QWidget::setTabOrder(loadButton, saveButton);
         QWidget::setTabOrder(saveButton, mandatorySoloButton);
-        QWidget::setTabOrder(saveButton, playerHistorySelectionCheckboxes[0]);
-
-        for(unsigned int i=0U; i < maxNumberOfPlayers - 1; ++i)
-        {
-            QWidget::setTabOrder(playerHistorySelectionCheckboxes[i], playerHistorySelectionCheckboxes[i+1]);
-        }
-
-        QWidget::setTabOrder(playerHistorySelectionCheckboxes[maxNumberOfPlayers - 1], aboutButton);
+        QWidget::setTabOrder(saveButton, playerHistorySelection);
+        QWidget::setTabOrder(playerHistorySelection, wholeSessionButton);
+        QWidget::setTabOrder(wholeSessionButton, aboutButton);
 
         retranslateUi(MainWindow);
 
@@ -621,24 +402,6 @@ public:
 
     void retranslateUi(QMainWindow *MainWindow)
     {
-        for(unsigned int i=0U; i < maxNumberOfPlayers; ++i)
-        {
-            names[i]->setText(QCoreApplication::translate("MainWindow", "!Name", nullptr));
-            lastGames[i]->setText(QCoreApplication::translate("MainWindow", "!LastGame", nullptr));
-            scores[i]->setText(QCoreApplication::translate("MainWindow", "!Score", nullptr));
-            cashs[i]->setText(QCoreApplication::translate("MainWindow", "!Cash", nullptr));
-            statisticNames[i]->setText(QCoreApplication::translate("MainWindow", "!SName", nullptr));
-            numberWons[i]->setText(QCoreApplication::translate("MainWindow", "!NumberWon", nullptr));
-            numberLosts[i]->setText(QCoreApplication::translate("MainWindow", "!NumberLost", nullptr));
-            numberPlayeds[i]->setText(QCoreApplication::translate("MainWindow", "!NumberPlayed", nullptr));
-            numberSoloWons[i]->setText(QCoreApplication::translate("MainWindow", "!NumberSoloWon", nullptr));
-            numberSoloLosts[i]->setText(QCoreApplication::translate("MainWindow", "!NumberSoloLost", nullptr));
-            pointsSolos[i]->setText(QCoreApplication::translate("MainWindow", "!PointsSolo", nullptr));
-            maxSingleWins[i]->setText(QCoreApplication::translate("MainWindow", "!MaxSingleWin", nullptr));
-            maxSingleLosss[i]->setText(QCoreApplication::translate("MainWindow", "!MaxSingleLoss", nullptr));
-            unmultipliedScores[i]->setText(QCoreApplication::translate("MainWindow", "!unmultipliedScore", nullptr));
-        }
-
         MainWindow->setWindowTitle(QCoreApplication::translate("MainWindow", "QtDoppelKopf", nullptr));
 
         changePlayersButton->setText(QCoreApplication::translate("MainWindow", "Spieler ändern ...", nullptr));
@@ -646,34 +409,18 @@ public:
         saveButton->setText(QCoreApplication::translate("MainWindow", "Speichern ...", nullptr));
         mandatorySoloButton->setText(QCoreApplication::translate("MainWindow", "Pflichtsolorunde", nullptr));
         aboutButton->setText(QCoreApplication::translate("MainWindow", "Über QtDK", nullptr));
-
-        namenLabel->setText(QCoreApplication::translate("MainWindow", "Namen", nullptr));
-        letztesLabel->setText(QCoreApplication::translate("MainWindow", "Letztes Spiel", nullptr));
-        aktuellesLabel->setText(QCoreApplication::translate("MainWindow", "Aktuelles Spiel", nullptr));
+        wholeSessionButton->setText(QCoreApplication::translate("MainWindow", "Ganzer Abend", nullptr));
 
         bockereignisseLabel->setText(QCoreApplication::translate("MainWindow", "Bockereignisse", nullptr));
         remainingGamesInRound->setText(QCoreApplication::translate("MainWindow", "Neue Runde", nullptr));
         commitButton->setText(QCoreApplication::translate("MainWindow", "Übernehmen", nullptr));
         resetButton->setText(QCoreApplication::translate("MainWindow", "Zurücksetzen", nullptr));
 
-        spielstandLabel->setText(QCoreApplication::translate("MainWindow", "Spielstand", nullptr));
-        zuZahlenLabel->setText(QCoreApplication::translate("MainWindow", "Zu Zahlen", nullptr));
-
         kassenstandLabel->setText(QCoreApplication::translate("MainWindow", "Aktueller Kassenstand", nullptr));
         totalCash->setText(QCoreApplication::translate("MainWindow", "!totalCash", nullptr));
 
         statisticsBox->setTitle(QCoreApplication::translate("MainWindow", "Statistiken", nullptr));
 
-        gewonnenLabel->setText(QCoreApplication::translate("MainWindow", "Gewonnen", nullptr));
-        verlorenLabel->setText(QCoreApplication::translate("MainWindow", "Verloren", nullptr));
-        anzahlSpieleLabel->setText(QCoreApplication::translate("MainWindow", "# Spiele", nullptr));
-        soloGewonnenLabel->setText(QCoreApplication::translate("MainWindow", "# +Solo", nullptr));
-        soloVerlorenLabel->setText(QCoreApplication::translate("MainWindow", "# -Solo", nullptr));
-        soloPunkteLabel->setText(QCoreApplication::translate("MainWindow", "Solo Punkte", nullptr));
-        groessterGewinnLabel->setText(QCoreApplication::translate("MainWindow", "Höchstes +", nullptr));
-        groessterVerlustLabel->setText(QCoreApplication::translate("MainWindow", "Höchstes -", nullptr));
-        ohneBockLabel->setText(QCoreApplication::translate("MainWindow", "Ohne Bock", nullptr));
-
         currentGameMultiplier->setText(QCoreApplication::translate("MainWindow", "Kein Bock", nullptr));
         dreifachbockLabel->setText(QCoreApplication::translate("MainWindow", "Dreifachbock Spiele", nullptr));
         doppelbockLabel->setText(QCoreApplication::translate("MainWindow", "Doppelbock Spiele", nullptr));
@@ -689,10 +436,7 @@ namespace Ui {
     class MainWindow: public Ui_MainWindow
     {
     public:
-        explicit MainWindow(const unsigned int maxPlayers)
-            : Ui_MainWindow(maxPlayers)
-        {
-        }
+        MainWindow() = default;
     };
 } // namespace Ui
 
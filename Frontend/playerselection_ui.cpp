@@ -75,15 +75,25 @@ void Ui::PlayerSelection::SetupUi()
 
     verticalDialogLayout->addLayout(topLayout);
 
-    playerNamesGridLayout = new QGridLayout(); //NOLINT(cppcoreguidelines-owning-memory)
+    // large tables do not fit the dialog, hence the names and the sit out positions scroll
+    playerNamesScrollArea = new QScrollArea(this); //NOLINT(cppcoreguidelines-owning-memory)
+    playerNamesScrollArea->setObjectName(QString::fromUtf8("playernamesscrollarea"));
+    playerNamesScrollArea->setWidgetResizable(true);
+    playerNamesScrollArea->setFrameShape(QFrame::NoFrame);
+
+    playerNamesWidget = new QWidget(); //NOLINT(cppcoreguidelines-owning-memory)
+    playerNamesWidget->setObjectName(QString::fromUtf8("playernameswidget"));
+
+    playerNamesGridLayout = new QGridLayout(playerNamesWidget); //NOLINT(cppcoreguidelines-owning-memory)
     playerNamesGridLayout->setObjectName(QString::fromUtf8("playernamesgridlayout"));
+    playerNamesScrollArea->setWidget(playerNamesWidget);
 
     for(unsigned int index = 0; index < maxNumberOfPlayers; ++index)
     {
-        dealerButtons.push_back(new QRadioButton(this)); //NOLINT(cppcoreguidelines-owning-memory)
+        dealerButtons.push_back(new QRadioButton(playerNamesWidget)); //NOLINT(cppcoreguidelines-owning-memory)
         dealerButtons[index]->setObjectName(QString::fromUtf8("dealerbuttons%1").arg(index));
         playerNamesGridLayout->addWidget(dealerButtons[index], static_cast<int>(index), 0, 1, 1);
-        dialogNames.push_back(new QLineEdit(this)); //NOLINT(cppcoreguidelines-owning-memory)
+        dialogNames.push_back(new QLineEdit(playerNamesWidget)); //NOLINT(cppcoreguidelines-owning-memory)
         dialogNames[index]->setObjectName(QString::fromUtf8("dialognames%1").arg(index));
         playerNamesGridLayout->addWidget(dialogNames[index], static_cast<int>(index), 1, 1, 1);
 
@@ -94,7 +104,7 @@ void Ui::PlayerSelection::SetupUi()
         dialogNames[index]->setEnabled(needed);
     }
 
-    verticalDialogLayout->addLayout(playerNamesGridLayout);
+    verticalDialogLayout->addWidget(playerNamesScrollArea);
 
     dialogSpacer = new QSpacerItem(40, 20, QSizePolicy::Minimum, QSizePolicy::Expanding); //NOLINT(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
     verticalDialogLayout->addItem(dialogSpacer);
@@ -106,10 +116,24 @@ void Ui::PlayerSelection::SetupUi()
     dialogAussitzenLabel->setObjectName(QString::fromUtf8("dialogaussitzenlabel"));
     bottomLayout->addWidget(dialogAussitzenLabel);
 
+    sittingOutsScrollArea = new QScrollArea(this); //NOLINT(cppcoreguidelines-owning-memory)
+    sittingOutsScrollArea->setObjectName(QString::fromUtf8("sittingoutsscrollarea"));
+    sittingOutsScrollArea->setWidgetResizable(true);
+    sittingOutsScrollArea->setFrameShape(QFrame::NoFrame);
+
+    sittingOutsWidget = new QWidget(); //NOLINT(cppcoreguidelines-owning-memory)
+    sittingOutsWidget->setObjectName(QString::fromUtf8("sittingoutswidget"));
+
+    sittingOutsLayout = new QVBoxLayout(sittingOutsWidget); //NOLINT(cppcoreguidelines-owning-memory)
+    sittingOutsLayout->setObjectName(QString::fromUtf8("sittingoutslayout"));
+    sittingOutsScrollArea->setWidget(sittingOutsWidget);
+
     for(unsigned int index = 0; index < (maxNumberOfPlayers - 4); ++index)
     {
-        dialogSittingOuts.push_back(new QSpinBox(this)); //NOLINT(cppcoreguidelines-owning-memory)
+        dialogSittingOuts.push_back(new QSpinBox(sittingOutsWidget)); //NOLINT(cppcoreguidelines-owning-memory)
         dialogSittingOuts[index]->setObjectName(QString::fromUtf8("dialogsittingouts%1").arg(index));
+        // is one-indexed to the user, only the first shows the dealer at 1
+        dialogSittingOuts[index]->setRange(index == 0 ? 1 : 2, static_cast<int>(maxNumberOfPlayers));
         dialogSittingOuts[index]->setValue(2 * static_cast<int>(index) + 1); // is one-indexed to the user
 
         if(index == 0)
@@ -120,9 +144,11 @@ void Ui::PlayerSelection::SetupUi()
         bool isVisible = (dialogNumberOfPresentPlayers->value() - (4 + static_cast<int>(index))) > 0;
         dialogSittingOuts[index]->setVisible(isVisible);
 
-        bottomLayout->addWidget(dialogSittingOuts[index]);
+        sittingOutsLayout->addWidget(dialogSittingOuts[index]);
     }
 
+    bottomLayout->addWidget(sittingOutsScrollArea);
+
     dialogAcceptButton = new QPushButton(QString::fromUtf8("OK"), this); //NOLINT(cppcoreguidelines-owning-memory)
     dialogAcceptButton->setObjectName(QString::fromUtf8("dialogacceptbutton"));
     bottomLayout->addWidget(dialogAcceptButton);
@@ -219,7 +245,7 @@ void Ui::PlayerSelection::OnOKButtonClicked()
         {
             auto value = static_cast<unsigned int>(dialogSittingOuts[index]->value() - 1); // is one-indexed to user
 
-            if(value + 1 >= players.size() || sitOutScheme.count(value) > 0)
+            if(value == 0 || value + 1 >= players.size() || sitOutScheme.count(value) > 0)
             {
                 return;
             }
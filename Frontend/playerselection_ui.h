@@ -30,6 +30,7 @@
 #include <QtWidgets/QMainWindow>
 #include <QtWidgets/QPushButton>
 #include <QtWidgets/QRadioButton>
+#include <QtWidgets/QScrollArea>
 #include <QtWidgets/QSpacerItem>
 #include <QtWidgets/QSpinBox>
 #include <QtWidgets/QVBoxLayout>
@@ -64,6 +65,8 @@ namespace Ui
 
         QVBoxLayout * verticalDialogLayout{};
         QHBoxLayout * topLayout{};
+        QScrollArea * playerNamesScrollArea{};
+        QWidget * playerNamesWidget{};
         QGridLayout * playerNamesGridLayout{};
         QSpinBox * dialogNumberOfPresentPlayers{};
         QLabel * dialogAnzahlSpielerLabel{};
@@ -71,6 +74,9 @@ namespace Ui
         std::vector<QRadioButton*> dealerButtons;
         QSpacerItem * dialogSpacer{};
         QVBoxLayout * bottomLayout{};
+        QScrollArea * sittingOutsScrollArea{};
+        QWidget * sittingOutsWidget{};
+        QVBoxLayout * sittingOutsLayout{};
         QLabel * dialogAussitzenLabel{};
         QPushButton * dialogAcceptButton{};
         std::vector<QSpinBox*> dialogSittingOuts; // is one-indexed to the user
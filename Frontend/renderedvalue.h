@@ -0,0 +1,54 @@
+/*
+ * This file is part of QtDoppelKopf.
+ *
+ * QtDoppelKopf is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtDoppelKopf is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtDoppelKopf.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef RENDEREDVALUE_H
+#define RENDEREDVALUE_H
+
+#include <optional>
+
+/*!
+ * \brief The RenderedValue class remembers the value last rendered into a widget,
+ *        so that the widget is only touched if the value to render differs.
+ * \tparam T The type of the value, which must be equality comparable.
+ */
+template<typename T>
+class RenderedValue
+{
+private:
+    std::optional<T> rendered;
+
+public:
+    /*!
+     * \brief Records the value to render.
+     * \param value The value to render.
+     * \return A value indicating whether the value differs from the last rendered one, or nothing was rendered yet,
+     *         so that the widget must be updated.
+     */
+    bool Update(const T& value)
+    {
+        if(this->rendered == value)
+        {
+            return false;
+        }
+
+        this->rendered = value;
+        return true;
+    }
+};
+
+#endif // RENDEREDVALUE_H
@@ -0,0 +1,85 @@
+/*
+ * This file is part of QtDoppelKopf.
+ *
+ * QtDoppelKopf is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtDoppelKopf is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtDoppelKopf.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "scoreinputdelegate.h"
+#include <QKeyEvent>
+#include <QPersistentModelIndex>
+
+ScoreInputDelegate::ScoreInputDelegate(QObject *parent)
+    : QStyledItemDelegate(parent)
+{
+}
+
+QWidget *ScoreInputDelegate::createEditor(QWidget *parent, const QStyleOptionViewItem &/*option*/, const QModelIndex &index) const
+{
+    auto * editor = new ScoreLineEdit(parent); //NOLINT(cppcoreguidelines-owning-memory)
+    editor->setAlignment(Qt::AlignCenter);
+
+    // the signals of a delegate are not const, while creating the editor is
+    auto * self = const_cast<ScoreInputDelegate*>(this); //NOLINT(cppcoreguidelines-pro-type-const-cast)
+    QPersistentModelIndex persistentIndex(index);
+
+    connect(editor, &QLineEdit::textChanged, self, [self, editor](){ emit self->commitData(editor); });
+    connect(editor, &QLineEdit::returnPressed, self, &ScoreInputDelegate::inputSubmitted);
+    connect(editor, &ScoreLineEdit::mouseFocused, self, [self, persistentIndex](ScoreLineEdit * object, bool hasFocus){ emit self->inputFocused(object, persistentIndex, hasFocus); });
+
+    return editor;
+}
+
+void ScoreInputDelegate::setEditorData(QWidget *editor, const QModelIndex &index) const
+{
+    auto * lineEdit = qobject_cast<ScoreLineEdit*>(editor);
+    if(lineEdit == nullptr)
+    {
+        return;
+    }
+
+    // setting an unchanged text would move the cursor
+    auto text = index.data(Qt::EditRole).toString();
+    if(lineEdit->text() != text)
+    {
+        lineEdit->setText(text);
+    }
+
+    lineEdit->setEnabled(index.flags().testFlag(Qt::ItemIsEditable));
+}
+
+void ScoreInputDelegate::setModelData(QWidget *editor, QAbstractItemModel *model, const QModelIndex &index) const
+{
+    auto * lineEdit = qobject_cast<ScoreLineEdit*>(editor);
+    if(lineEdit == nullptr)
+    {
+        return;
+    }
+
+    model->setData(index, lineEdit->text(), Qt::EditRole);
+}
+
+bool ScoreInputDelegate::eventFilter(QObject *object, QEvent *event)
+{
+    if(event->type() == QEvent::KeyPress)
+    {
+        auto key = static_cast<QKeyEvent*>(event)->key(); //NOLINT(cppcoreguidelines-pro-type-static-cast-downcast)
+        if(key == Qt::Key_Tab || key == Qt::Key_Backtab)
+        {
+            return false;
+        }
+    }
+
+    return QStyledItemDelegate::eventFilter(object, event);
+}
@@ -0,0 +1,80 @@
+/*
+ * This file is part of QtDoppelKopf.
+ *
+ * QtDoppelKopf is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtDoppelKopf is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtDoppelKopf.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SCOREINPUTDELEGATE_H
+#define SCOREINPUTDELEGATE_H
+
+#include "scorelineedit.h"
+#include <QModelIndex>
+#include <QStyledItemDelegate>
+
+/*!
+ * \brief The ScoreInputDelegate class edits the inputs of the current deal with a ScoreLineEdit,
+ *        which is meant to be opened as a persistent editor.
+ *        Every change of the text is committed to the model at once,
+ *        so that the model always holds what is shown.
+ */
+class ScoreInputDelegate : public QStyledItemDelegate
+{
+    Q_OBJECT
+
+public:
+    /*!
+     * \brief Initializes a new instance.
+     * \param parent Is sent to the QStyledItemDelegate ctor.
+     */
+    explicit ScoreInputDelegate(QObject *parent = nullptr);
+
+    /*!
+     * \reimp
+     */
+    [[nodiscard]] QWidget *createEditor(QWidget *parent, const QStyleOptionViewItem &option, const QModelIndex &index) const override;
+
+    /*!
+     * \reimp
+     */
+    void setEditorData(QWidget *editor, const QModelIndex &index) const override;
+
+    /*!
+     * \reimp
+     */
+    void setModelData(QWidget *editor, QAbstractItemModel *model, const QModelIndex &index) const override;
+
+Q_SIGNALS:
+    /*!
+     * \brief Emitted when the focus status of an editor changes due to mouse action.
+     * \param editor The affected editor.
+     * \param index The index edited by the editor.
+     * \param hasFocus Value indicating whether the editor has focus after the action.
+     */
+    void inputFocused(ScoreLineEdit * editor, const QModelIndex & index, bool hasFocus);
+
+    /*!
+     * \brief Emitted when the return key is pressed in an editor.
+     */
+    void inputSubmitted();
+
+protected:
+    /*!
+     * \reimp
+     *        Tab and backtab are left to the focus chain, which leads through the persistent editors.
+     */
+    bool eventFilter(QObject *object, QEvent *event) override;
+};
+
+#endif // SCOREINPUTDELEGATE_H
@@ -0,0 +1,285 @@
+/*
+ * This file is part of QtDoppelKopf.
+ *
+ * QtDoppelKopf is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtDoppelKopf is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtDoppelKopf.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "standingstablemodel.h"
+#include <QColor>
+#include <QFont>
+#include <QSet>
+#include <algorithm>
+#include <array>
+
+StandingsTableModel::StandingsTableModel(QObject *parent)
+    : QAbstractTableModel(parent)
+{
+}
+
+void StandingsTableModel::Refresh(const Backend::GameInfo& gameInfo)
+{
+    std::vector<Row> newRows;
+    auto dealer = gameInfo.Dealer();
+
+    size_t position = 0;
+    for(const auto & playerInfo : gameInfo.PlayerInfosView())
+    {
+        if(playerInfo.IsPresent() || playerInfo.HasPlayed())
+        {
+            newRows.push_back(StandingsTableModel::CreateRow(position, playerInfo, &playerInfo == dealer.get()));
+        }
+
+        ++position;
+    }
+
+    bool rowsChanged = newRows.size() != this->rows.size()
+            || !std::equal(newRows.begin(), newRows.end(), this->rows.begin(), [](const Row& newRow, const Row& row){ return newRow.name == row.name && newRow.position == row.position; });
+
+    if(rowsChanged)
+    {
+        this->beginResetModel();
+        this->rows = std::move(newRows);
+        this->endResetModel();
+        return;
+    }
+
+    // per row, the span from the first to the last changed column is signalled
+    for(size_t row = 0; row < this->rows.size(); ++row)
+    {
+        auto & current = this->rows[row];
+        const auto & next = newRows[row];
+
+        const std::array<bool, NumberOfColumns> changed
+        {
+            current.dealer != next.dealer,
+            current.lastGame != next.lastGame,
+            current.input != next.input || current.playing != next.playing,
+            current.score != next.score,
+            current.cash != next.cash
+        };
+
+        auto first = std::ranges::find(changed, true);
+        if(first == changed.end())
+        {
+            continue;
+        }
+
+        auto last = std::ranges::find(changed.rbegin(), changed.rend(), true);
+
+        current = next;
+        emit this->dataChanged(this->index(static_cast<int>(row), static_cast<int>(first - changed.begin())),
+                               this->index(static_cast<int>(row), static_cast<int>(changed.rend() - last) - 1));
+    }
+}
+
+void StandingsTableModel::SetInputs(const std::vector<std::string>& inputs)
+{
+    for(size_t row = 0; row < this->rows.size(); ++row)
+    {
+        auto position = this->rows[row].position;
+        if(position < inputs.size())
+        {
+            this->setData(this->index(static_cast<int>(row), Input), QString::fromUtf8(inputs[position]));
+        }
+    }
+}
+
+QString StandingsTableModel::CommonInput() const
+{
+    QSet<QString> set;
+
+    for(const auto & row : this->rows)
+    {
+        if(row.playing && !row.input.isEmpty())
+        {
+            set.insert(row.input);
+        }
+    }
+
+    return set.count() == 1 ? *(set.begin()) : QString();
+}
+
+std::optional<std::vector<std::pair<std::string, int>>> StandingsTableModel::Changes() const
+{
+    std::vector<std::pair<std::string, int>> changes;
+
+    for(const auto & row : this->rows)
+    {
+        if(!row.playing || row.input.isEmpty())
+        {
+            continue;
+        }
+
+        bool intConversionOK = true;
+        int value = row.input.toInt(&intConversionOK);
+        if(!intConversionOK)
+        {
+            return std::nullopt;
+        }
+
+        auto nameBytes = row.name.toUtf8();
+        changes.emplace_back(std::string(nameBytes.constData(), static_cast<size_t>(nameBytes.length())), value);
+    }
+
+    return changes;
+}
+
+QString StandingsTableModel::FormatCash(unsigned int cents)
+{
+    return QString("%1,%2").arg(cents/CentsInEuro).arg(cents%CentsInEuro, 2, DecimalBase, QLatin1Char('0'));
+}
+
+int StandingsTableModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : static_cast<int>(this->rows.size());
+}
+
+int StandingsTableModel::columnCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : NumberOfColumns;
+}
+
+QVariant StandingsTableModel::data(const QModelIndex &index, int role) const
+{
+    if(!index.isValid() || index.row() >= this->rowCount() || index.column() >= NumberOfColumns)
+    {
+        return {};
+    }
+
+    const auto & row = this->rows[static_cast<size_t>(index.row())];
+
+    switch(role)
+    {
+    case Qt::TextAlignmentRole:
+        return static_cast<int>(Qt::AlignCenter);
+
+    case IsDealerRole:
+        return index.column() == Name ? QVariant(row.dealer) : QVariant();
+
+    case Qt::BackgroundRole:
+        // the dealer is marked in the orange, which the name labels used to be framed with
+        return index.column() == Name && row.dealer ? QVariant(QColor(0xff, 0xa5, 0x00)) : QVariant(); //NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+    case Qt::FontRole:
+    {
+        if(index.column() != Score)
+        {
+            return {};
+        }
+
+        QFont font;
+        font.setBold(true);
+        font.setPointSize(ScorePointSize);
+        return font;
+    }
+
+    case Qt::DisplayRole:
+    case Qt::EditRole:
+        break;
+
+    default:
+        return {};
+    }
+
+    switch(index.column())
+    {
+    case Name:
+        return row.name;
+    case LastGame:
+        return row.lastGame;
+    case Input:
+        return row.input;
+    case Score:
+        return row.score;
+    case Cash:
+        return row.cash;
+    default:
+        return {};
+    }
+}
+
+bool StandingsTableModel::setData(const QModelIndex &index, const QVariant &value, int role)
+{
+    if(!index.isValid() || index.row() >= this->rowCount() || index.column() != Input || role != Qt::EditRole)
+    {
+        return false;
+    }
+
+    auto & row = this->rows[static_cast<size_t>(index.row())];
+    if(!row.playing)
+    {
+        return false;
+    }
+
+    auto input = value.toString();
+    if(row.input != input)
+    {
+        row.input = input;
+        emit this->dataChanged(index, index, { Qt::DisplayRole, Qt::EditRole });
+    }
+
+    return true;
+}
+
+Qt::ItemFlags StandingsTableModel::flags(const QModelIndex &index) const
+{
+    auto flags = QAbstractTableModel::flags(index);
+
+    if(index.isValid() && index.row() < this->rowCount() && index.column() == Input && this->rows[static_cast<size_t>(index.row())].playing)
+    {
+        flags |= Qt::ItemIsEditable;
+    }
+
+    return flags;
+}
+
+QVariant StandingsTableModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if(orientation != Qt::Horizontal || role != Qt::DisplayRole)
+    {
+        return QAbstractTableModel::headerData(section, orientation, role);
+    }
+
+    switch(section)
+    {
+    case Name:
+        return QString::fromUtf8("Namen");
+    case LastGame:
+        return QString::fromUtf8("Letztes Spiel");
+    case Input:
+        return QString::fromUtf8("Aktuelles Spiel");
+    case Score:
+        return QString::fromUtf8("Spielstand");
+    case Cash:
+        return QString::fromUtf8("Zu Zahlen");
+    default:
+        return {};
+    }
+}
+
+StandingsTableModel::Row StandingsTableModel::CreateRow(size_t position, const Backend::PlayerInfo& playerInfo, bool dealer)
+{
+    return Row
+    {
+        position,
+        QString::fromUtf8(playerInfo.Name()),
+        dealer,
+        playerInfo.IsPlaying(),
+        playerInfo.ParticipatedInLastDeal() ? QString::number(playerInfo.ScoreInLastDeal()) : QString(),
+        QString(),
+        QString::number(playerInfo.CurrentScore()),
+        StandingsTableModel::FormatCash(playerInfo.CashCents())
+    };
+}
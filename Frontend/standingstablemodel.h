@@ -0,0 +1,157 @@
+/*
+ * This file is part of QtDoppelKopf.
+ *
+ * QtDoppelKopf is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtDoppelKopf is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtDoppelKopf.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef STANDINGSTABLEMODEL_H
+#define STANDINGSTABLEMODEL_H
+
+#include "../Backend/gameinfo.h"
+#include <QAbstractTableModel>
+#include <QString>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+/*!
+ * \brief The StandingsTableModel class presents the standings of the shown players of a game as a table,
+ *        with one row per player and the input of the current deal as the only editable column.
+ *        The rows are cached, so that a refresh only signals the cells whose values changed.
+ */
+class StandingsTableModel : public QAbstractTableModel
+{
+    Q_OBJECT
+
+public:
+    /*!
+     * \brief The Column enum lists the columns of the table.
+     */
+    enum Column
+    {
+        Name,
+        LastGame,
+        Input,
+        Score,
+        Cash,
+        NumberOfColumns
+    };
+
+    /*!
+     * \brief The Role enum lists the roles beyond those of Qt, which are given for the name column.
+     */
+    enum Role
+    {
+        IsDealerRole = Qt::UserRole
+    };
+
+private:
+    static constexpr int DecimalBase = 10;
+    static constexpr unsigned int CentsInEuro = 100U;
+    static constexpr int ScorePointSize = 12;
+
+    /*!
+     * \brief The Row struct holds the values of a row, the position being the one of the player in the game.
+     */
+    struct Row
+    {
+        size_t position{};
+        QString name;
+        bool dealer{};
+        bool playing{};
+        QString lastGame;
+        QString input;
+        QString score;
+        QString cash;
+    };
+
+    std::vector<Row> rows;
+
+public:
+    /*!
+     * \brief Initializes a new instance without rows.
+     * \param parent Is sent to the QAbstractTableModel ctor.
+     */
+    explicit StandingsTableModel(QObject *parent = nullptr);
+
+    /*!
+     * \brief Takes the standings of the players shown, who are present or have played, from the game
+     *        and clears the inputs.
+     *        If the shown players change, the model is reset, otherwise only the changed cells are signalled.
+     * \param gameInfo The game to take the standings from.
+     */
+    void Refresh(const Backend::GameInfo& gameInfo);
+
+    /*!
+     * \brief Sets the inputs of the playing players.
+     * \param inputs The inputs indexed by the positions of the players in the game.
+     */
+    void SetInputs(const std::vector<std::string>& inputs);
+
+    /*!
+     * \brief Gets the input, which all playing players with a non-empty input have in common.
+     * \return The common input or an empty string, if there is none or more than one.
+     */
+    [[nodiscard]] QString CommonInput() const;
+
+    /*!
+     * \brief Gets the changes of the playing players with a non-empty input.
+     * \return The names and changes or nothing, if an input is not a number.
+     */
+    [[nodiscard]] std::optional<std::vector<std::pair<std::string, int>>> Changes() const;
+
+    /*!
+     * \brief Formats an amount of money.
+     * \param cents The amount in cents.
+     * \return The amount in euros with two decimal places.
+     */
+    static QString FormatCash(unsigned int cents);
+
+    /*!
+     * \reimp
+     */
+    [[nodiscard]] int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+
+    /*!
+     * \reimp
+     */
+    [[nodiscard]] int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+
+    /*!
+     * \reimp
+     */
+    [[nodiscard]] QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+
+    /*!
+     * \reimp
+     */
+    bool setData(const QModelIndex &index, const QVariant &value, int role = Qt::EditRole) override;
+
+    /*!
+     * \reimp
+     */
+    [[nodiscard]] Qt::ItemFlags flags(const QModelIndex &index) const override;
+
+    /*!
+     * \reimp
+     */
+    [[nodiscard]] QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+
+private:
+    static Row CreateRow(size_t position, const Backend::PlayerInfo& playerInfo, bool dealer);
+};
+
+#endif // STANDINGSTABLEMODEL_H
@@ -0,0 +1,164 @@
+/*
+ * This file is part of QtDoppelKopf.
+ *
+ * QtDoppelKopf is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtDoppelKopf is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtDoppelKopf.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "statisticstablemodel.h"
+#include <algorithm>
+#include <utility>
+
+StatisticsTableModel::StatisticsTableModel(QObject *parent)
+    : QAbstractTableModel(parent)
+{
+}
+
+void StatisticsTableModel::Refresh(const Backend::GameInfo& gameInfo)
+{
+    std::vector<Row> newRows;
+
+    for(const auto & playerInfo : gameInfo.PlayerInfosView())
+    {
+        if(playerInfo.IsPresent() || playerInfo.HasPlayed())
+        {
+            newRows.push_back(StatisticsTableModel::CreateRow(playerInfo));
+        }
+    }
+
+    bool rowsChanged = newRows.size() != this->rows.size()
+            || !std::equal(newRows.begin(), newRows.end(), this->rows.begin(), [](const Row& newRow, const Row& row){ return newRow.name == row.name; });
+
+    if(rowsChanged)
+    {
+        this->beginResetModel();
+        this->rows = std::move(newRows);
+        this->endResetModel();
+        return;
+    }
+
+    // per row, the span from the first to the last changed statistic is signalled
+    for(size_t row = 0; row < this->rows.size(); ++row)
+    {
+        auto & statistics = this->rows[row].statistics;
+        const auto & newStatistics = newRows[row].statistics;
+
+        int firstChanged = -1;
+        int lastChanged = -1;
+        for(size_t statistic = 0; statistic < statistics.size(); ++statistic)
+        {
+            if(statistics[statistic] != newStatistics[statistic])
+            {
+                lastChanged = static_cast<int>(statistic) + 1;
+                firstChanged = firstChanged < 0 ? lastChanged : firstChanged;
+            }
+        }
+
+        if(firstChanged < 0)
+        {
+            continue;
+        }
+
+        statistics = newStatistics;
+        emit this->dataChanged(this->index(static_cast<int>(row), firstChanged), this->index(static_cast<int>(row), lastChanged), { Qt::DisplayRole });
+    }
+}
+
+int StatisticsTableModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : static_cast<int>(this->rows.size());
+}
+
+int StatisticsTableModel::columnCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : NumberOfColumns;
+}
+
+QVariant StatisticsTableModel::data(const QModelIndex &index, int role) const
+{
+    if(!index.isValid() || index.row() >= this->rowCount() || index.column() >= NumberOfColumns)
+    {
+        return {};
+    }
+
+    if(role == Qt::TextAlignmentRole)
+    {
+        return index.column() == Name ? static_cast<int>(Qt::AlignLeft | Qt::AlignVCenter) : static_cast<int>(Qt::AlignCenter);
+    }
+
+    if(role != Qt::DisplayRole)
+    {
+        return {};
+    }
+
+    const auto & row = this->rows[static_cast<size_t>(index.row())];
+
+    // the statistics are given as numbers, so that sorting is numerical
+    return index.column() == Name ? QVariant(row.name) : QVariant(row.statistics[static_cast<size_t>(index.column()) - 1]);
+}
+
+QVariant StatisticsTableModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if(orientation != Qt::Horizontal || role != Qt::DisplayRole)
+    {
+        return QAbstractTableModel::headerData(section, orientation, role);
+    }
+
+    switch(section)
+    {
+    case Name:
+        return QString::fromUtf8("Name");
+    case Won:
+        return QString::fromUtf8("Gewonnen");
+    case Lost:
+        return QString::fromUtf8("Verloren");
+    case Played:
+        return QString::fromUtf8("# Spiele");
+    case SoloWon:
+        return QString::fromUtf8("# +Solo");
+    case SoloLost:
+        return QString::fromUtf8("# -Solo");
+    case SoloPoints:
+        return QString::fromUtf8("Solo Punkte");
+    case MaxSingleWin:
+        return QString::fromUtf8("Höchstes +");
+    case MaxSingleLoss:
+        return QString::fromUtf8("Höchstes -");
+    case UnmultipliedScore:
+        return QString::fromUtf8("Ohne Bock");
+    default:
+        return {};
+    }
+}
+
+StatisticsTableModel::Row StatisticsTableModel::CreateRow(const Backend::PlayerInfo& playerInfo)
+{
+    const auto statistics = playerInfo.Statistics();
+
+    return Row
+    {
+        QString::fromUtf8(playerInfo.Name()),
+        {
+            static_cast<int>(statistics.numberGamesWon),
+            static_cast<int>(statistics.numberGamesLost),
+            static_cast<int>(statistics.numberGames),
+            static_cast<int>(statistics.solosWon),
+            static_cast<int>(statistics.solosLost),
+            statistics.totalSoloPoints,
+            statistics.maxSingleWin,
+            statistics.maxSingleLoss,
+            statistics.unmultipliedScore
+        }
+    };
+}
@@ -0,0 +1,106 @@
+/*
+ * This file is part of QtDoppelKopf.
+ *
+ * QtDoppelKopf is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtDoppelKopf is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtDoppelKopf.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef STATISTICSTABLEMODEL_H
+#define STATISTICSTABLEMODEL_H
+
+#include "../Backend/gameinfo.h"
+#include <QAbstractTableModel>
+#include <QString>
+#include <array>
+#include <vector>
+
+/*!
+ * \brief The StatisticsTableModel class presents the statistics of the shown players of a game as a table,
+ *        with one row per player and one column per statistic.
+ *        The rows are cached, so that a refresh only signals the cells whose values changed.
+ */
+class StatisticsTableModel : public QAbstractTableModel
+{
+    Q_OBJECT
+
+public:
+    /*!
+     * \brief The Column enum lists the columns of the table.
+     */
+    enum Column
+    {
+        Name,
+        Won,
+        Lost,
+        Played,
+        SoloWon,
+        SoloLost,
+        SoloPoints,
+        MaxSingleWin,
+        MaxSingleLoss,
+        UnmultipliedScore,
+        NumberOfColumns
+    };
+
+private:
+    /*!
+     * \brief The Row struct holds the values of a row, the statistics being indexed by their column less one.
+     */
+    struct Row
+    {
+        QString name;
+        std::array<int, NumberOfColumns - 1> statistics{};
+    };
+
+    std::vector<Row> rows;
+
+public:
+    /*!
+     * \brief Initializes a new instance without rows.
+     * \param parent Is sent to the QAbstractTableModel ctor.
+     */
+    explicit StatisticsTableModel(QObject *parent = nullptr);
+
+    /*!
+     * \brief Takes the statistics of the players shown, who are present or have played, from the game.
+     *        If the shown players change, the model is reset, otherwise only the changed cells are signalled.
+     * \param gameInfo The game to take the statistics from.
+     */
+    void Refresh(const Backend::GameInfo& gameInfo);
+
+    /*!
+     * \reimp
+     */
+    [[nodiscard]] int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+
+    /*!
+     * \reimp
+     */
+    [[nodiscard]] int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+
+    /*!
+     * \reimp
+     */
+    [[nodiscard]] QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+
+    /*!
+     * \reimp
+     */
+    [[nodiscard]] QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+
+private:
+    static Row CreateRow(const Backend::PlayerInfo& playerInfo);
+};
+
+#endif // STATISTICSTABLEMODEL_H
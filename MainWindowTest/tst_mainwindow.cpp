@@ -22,6 +22,7 @@
 #error "you need to make a choice between using or skipping long tests, -D_USE_LONG_TEST -D_SKIP_LONG_TEST"
 #endif
 
+#include <QSortFilterProxyModel>
 #include <QTest>
 #include <QtTest>
 
@@ -39,8 +40,10 @@ private:
     const int ShortInterval = 10;
     const unsigned int MaxPlayers = 8U;
     const unsigned int DefaultPlayers = 8U;
-    const QString ExpectedStandardNamesStyleSheet = QString::fromUtf8("QLabel { }");
-    const QString ExpectedDealerNamesStyleSheet = QString::fromUtf8("QLabel { border: 3px solid orange ; border-radius : 6px }");
+
+    static QString StandingsText(const MainWindow& mw, unsigned int row, StandingsTableModel::Column column);
+    static ScoreLineEdit * Input(const MainWindow& mw, unsigned int row);
+    static bool IsDealer(const MainWindow& mw, unsigned int row);
 
 public:
     FrontendTest();
@@ -57,6 +60,7 @@ private slots:
     void AllLevelsOfMultipliersShallCorrectlyBeDisplayed() const;
     void StatisticsShallCorrectlyBeDisplayed() const;
     void ScoreHistoryPlotShallWorkCorrectly() const;
+    void ScoreHistoryPlotShallShowWholeSessionDecimated() const;
     void AboutButtonShallTriggerDialogAndOKShallClose();
     void MandatorySoloButtonShallBeEnabledAndTrigger() const;
     void EveryOptionOfResetButtonShallBeDisplayed();
@@ -64,12 +68,28 @@ private slots:
     void LoadGameShallWorkWithPresetValueAndDisplayGame();
     void FocusOnActualShallTriggerAutofill() const;
     void ReturnKeyShallCommitGame() const;
+    void CommittingDealsInLongSessionShallBeBenchmarked() const;
 #endif // _USE_LONG_TEST
 };
 
 FrontendTest::FrontendTest()
 = default;
 
+QString FrontendTest::StandingsText(const MainWindow& mw, unsigned int row, StandingsTableModel::Column column)
+{
+    return mw.standingsModel->index(static_cast<int>(row), column).data().toString();
+}
+
+ScoreLineEdit * FrontendTest::Input(const MainWindow& mw, unsigned int row)
+{
+    return qobject_cast<ScoreLineEdit*>(mw.ui->standingsTable->indexWidget(mw.standingsModel->index(static_cast<int>(row), StandingsTableModel::Input)));
+}
+
+bool FrontendTest::IsDealer(const MainWindow& mw, unsigned int row)
+{
+    return mw.standingsModel->index(static_cast<int>(row), StandingsTableModel::Name).data(StandingsTableModel::IsDealerRole).toBool();
+}
+
 void FrontendTest::ConstructionShallWorkCompletely() const//NOLINT(google-readability-function-size, hicpp-function-size, readability-function-size)
 {
     try
@@ -91,28 +111,11 @@ void FrontendTest::ConstructionShallWorkCompletely() const//NOLINT(google-readab
         QVERIFY2(mw.ui->topMenuSpacer, qPrintable(QString::fromUtf8("not created top menu spacer")));
 
         QVERIFY2(mw.ui->namesLayout, qPrintable(QString::fromUtf8("not created names layout")));
-        QVERIFY2(mw.ui->namenLabel, qPrintable(QString::fromUtf8("not created namen label")));
-        QVERIFY2(!mw.ui->names.empty(), qPrintable(QString::fromUtf8("there must be name labels")));
-        for(auto & name : mw.ui->names)
-        {
-            QVERIFY2(name, qPrintable(QString::fromUtf8("name label not created")));
-        }
-
-        QVERIFY2(mw.ui->letztesLabel, qPrintable(QString::fromUtf8("not created letztes label")));
-        QVERIFY2(!mw.ui->lastGames.empty(), qPrintable(QString::fromUtf8("there must be last games labels")));
-        QVERIFY2(mw.ui->lastGames.size() == mw.ui->names.size(), qPrintable(QString::fromUtf8("sizes do not match: lastGames, names")));
-        for(auto & lastGame : mw.ui->lastGames)
-        {
-            QVERIFY2(lastGame, qPrintable(QString::fromUtf8("last game label not created")));
-        }
-
-        QVERIFY2(mw.ui->aktuellesLabel, qPrintable(QString::fromUtf8("not created aktuelles label")));
-        QVERIFY2(!mw.ui->actuals.empty(), qPrintable(QString::fromUtf8("there must be actuals inputs")));
-        QVERIFY2(mw.ui->actuals.size() == mw.ui->names.size(), qPrintable(QString::fromUtf8("sizes do not match: actuals, names")));
-        for(auto & actual : mw.ui->actuals)
-        {
-            QVERIFY2(actual, qPrintable(QString::fromUtf8("actual input not created")));
-        }
+        QVERIFY2(mw.ui->standingsTable, qPrintable(QString::fromUtf8("not created standings table")));
+        QVERIFY2(mw.ui->standingsTable->model() == mw.standingsModel, qPrintable(QString::fromUtf8("standings table without model")));
+        QVERIFY2(mw.ui->standingsTable->itemDelegateForColumn(StandingsTableModel::Input) == mw.scoreInputDelegate, qPrintable(QString::fromUtf8("standings table without input delegate")));
+        QVERIFY2(mw.standingsModel->columnCount() == StandingsTableModel::NumberOfColumns, qPrintable(QString::fromUtf8("incorrect number of standings columns")));
+        QVERIFY2(mw.standingsModel->rowCount() == 0, qPrintable(QString::fromUtf8("standings rows without players")));
 
         QVERIFY2(mw.ui->controlWidget, qPrintable(QString::fromUtf8("not created control widget")));
         QVERIFY2(mw.ui->horizontalLayout, qPrintable(QString::fromUtf8("not created horizontal layout")));
@@ -125,107 +128,16 @@ void FrontendTest::ConstructionShallWorkCompletely() const//NOLINT(google-readab
         QVERIFY2(mw.ui->controlSpacer2, qPrintable(QString::fromUtf8("not created control spacer 2")));
         QVERIFY2(mw.ui->resetButton, qPrintable(QString::fromUtf8("not created reset button")));
 
-        QVERIFY2(mw.ui->spielstandLabel, qPrintable(QString::fromUtf8("not created spielstand label")));
-        QVERIFY2(!mw.ui->scores.empty(), qPrintable(QString::fromUtf8("there must be scores labels")));
-        QVERIFY2(mw.ui->scores.size() == mw.ui->names.size(), qPrintable(QString::fromUtf8("sizes do not match: scores, names")));
-        for(auto & score : mw.ui->scores)
-        {
-            QVERIFY2(score, qPrintable(QString::fromUtf8("score label not created")));
-        }
-
-        QVERIFY2(mw.ui->zuZahlenLabel, qPrintable(QString::fromUtf8("not created zu zahlen label")));
-        QVERIFY2(!mw.ui->cashs.empty(), qPrintable(QString::fromUtf8("there must be scores labels")));
-        QVERIFY2(mw.ui->cashs.size() == mw.ui->names.size(), qPrintable(QString::fromUtf8("sizes do not match: cashs, names")));
-        for(auto & cash : mw.ui->cashs)
-        {
-            QVERIFY2(cash, qPrintable(QString::fromUtf8("cash label not created")));
-        }
-
         QVERIFY2(mw.ui->kassenstandLabel, qPrintable(QString::fromUtf8("not created kassenstand label")));
         QVERIFY2(mw.ui->totalCash, qPrintable(QString::fromUtf8("not created total cash label")));
 
         QVERIFY2(mw.ui->statisticsBox, qPrintable(QString::fromUtf8("not created statistics box")));
-        QVERIFY2(mw.ui->statisticsGridLayout, qPrintable(QString::fromUtf8("not created grid layout")));
-
-        QVERIFY2(mw.ui->gewonnenLabel, qPrintable(QString::fromUtf8("not created gewonnen label")));
-        QVERIFY2(mw.ui->verlorenLabel, qPrintable(QString::fromUtf8("not created verloren label")));
-        QVERIFY2(mw.ui->anzahlSpieleLabel, qPrintable(QString::fromUtf8("not created anzahl spiele label")));
-        QVERIFY2(mw.ui->soloGewonnenLabel, qPrintable(QString::fromUtf8("not created solo gewonnen label")));
-        QVERIFY2(mw.ui->soloVerlorenLabel, qPrintable(QString::fromUtf8("not created solo verloren label")));
-        QVERIFY2(mw.ui->soloPunkteLabel, qPrintable(QString::fromUtf8("not created punkte label")));
-        QVERIFY2(mw.ui->groessterGewinnLabel, qPrintable(QString::fromUtf8("not created groesster gewinn label")));
-        QVERIFY2(mw.ui->groessterVerlustLabel, qPrintable(QString::fromUtf8("not created groesster verlust label")));
-        QVERIFY2(mw.ui->ohneBockLabel, qPrintable(QString::fromUtf8("not created ohne bock label")));
-
-        QVERIFY2(!mw.ui->statisticNames.empty(), qPrintable(QString::fromUtf8("there must be statisticNames labels")));
-        QVERIFY2(mw.ui->statisticNames.size() == mw.ui->names.size(), qPrintable(QString::fromUtf8("sizes do not match: statisticNames, names")));
-        for(auto & statisticName : mw.ui->statisticNames)
-        {
-            QVERIFY2(statisticName, qPrintable(QString::fromUtf8("statistic name label not created")));
-        }
-
-        QVERIFY2(!mw.ui->numberWons.empty(), qPrintable(QString::fromUtf8("there must be numberWons labels")));
-        QVERIFY2(mw.ui->numberWons.size() == mw.ui->names.size(), qPrintable(QString::fromUtf8("sizes do not match: numberWons, names")));
-        for(auto & numberWon : mw.ui->numberWons)
-        {
-            QVERIFY2(numberWon, qPrintable(QString::fromUtf8("number won label not created")));
-        }
-
-        QVERIFY2(!mw.ui->numberLosts.empty(), qPrintable(QString::fromUtf8("there must be numberLosts labels")));
-        QVERIFY2(mw.ui->numberLosts.size() == mw.ui->names.size(), qPrintable(QString::fromUtf8("sizes do not match: numberLosts, names")));
-        for(auto & numberLost : mw.ui->numberLosts)
-        {
-            QVERIFY2(numberLost, qPrintable(QString::fromUtf8("number lost label not created")));
-        }
-
-        QVERIFY2(!mw.ui->numberPlayeds.empty(), qPrintable(QString::fromUtf8("there must be numberPlayeds labels")));
-        QVERIFY2(mw.ui->numberPlayeds.size() == mw.ui->names.size(), qPrintable(QString::fromUtf8("sizes do not match: numberPlayeds, names")));
-        for(auto & numberPlayed : mw.ui->numberPlayeds)
-        {
-            QVERIFY2(numberPlayed, qPrintable(QString::fromUtf8("number playeds label not created")));
-        }
-
-        QVERIFY2(!mw.ui->numberSoloWons.empty(), qPrintable(QString::fromUtf8("there must be numberSoloWons labels")));
-        QVERIFY2(mw.ui->numberSoloWons.size() == mw.ui->names.size(), qPrintable(QString::fromUtf8("sizes do not match: numberSoloWons, names")));
-        for(auto & numberSoloWon : mw.ui->numberSoloWons)
-        {
-            QVERIFY2(numberSoloWon, qPrintable(QString::fromUtf8("solo wons label not created")));
-        }
-
-        QVERIFY2(!mw.ui->numberSoloLosts.empty(), qPrintable(QString::fromUtf8("there must be numberSoloLosts labels")));
-        QVERIFY2(mw.ui->numberSoloLosts.size() == mw.ui->names.size(), qPrintable(QString::fromUtf8("sizes do not match: numberSoloLosts, names")));
-        for(auto & numberSoloLost : mw.ui->numberSoloLosts)
-        {
-            QVERIFY2(numberSoloLost, qPrintable(QString::fromUtf8("solo losts label not created")));
-        }
-
-        QVERIFY2(!mw.ui->pointsSolos.empty(), qPrintable(QString::fromUtf8("there must be pointsSolos labels")));
-        QVERIFY2(mw.ui->pointsSolos.size() == mw.ui->names.size(), qPrintable(QString::fromUtf8("sizes do not match: pointsSolos, names")));
-        for(auto & pointsSolo : mw.ui->pointsSolos)
-        {
-            QVERIFY2(pointsSolo, qPrintable(QString::fromUtf8("points solos label not created")));
-        }
-
-        QVERIFY2(!mw.ui->maxSingleWins.empty(), qPrintable(QString::fromUtf8("there must be maxSingleWins labels")));
-        QVERIFY2(mw.ui->maxSingleWins.size() == mw.ui->names.size(), qPrintable(QString::fromUtf8("sizes do not match: maxSingleWins, names")));
-        for(auto & maxSingleWin : mw.ui->maxSingleWins)
-        {
-            QVERIFY2(maxSingleWin, qPrintable(QString::fromUtf8("max single wins label not created")));
-        }
-
-        QVERIFY2(!mw.ui->maxSingleLosss.empty(), qPrintable(QString::fromUtf8("there must be maxSingleLosss labels")));
-        QVERIFY2(mw.ui->maxSingleLosss.size() == mw.ui->names.size(), qPrintable(QString::fromUtf8("sizes do not match: maxSingleLosss, names")));
-        for(auto & maxSingleLoss : mw.ui->maxSingleLosss)
-        {
-            QVERIFY2(maxSingleLoss, qPrintable(QString::fromUtf8("max single losss label not created")));
-        }
-
-        QVERIFY2(!mw.ui->unmultipliedScores.empty(), qPrintable(QString::fromUtf8("there must be unmultipliedScores labels")));
-        QVERIFY2(mw.ui->unmultipliedScores.size() == mw.ui->names.size(), qPrintable(QString::fromUtf8("sizes do not match: unmultipliedScores, names")));
-        for(auto & unmultipliedScore : mw.ui->unmultipliedScores)
-        {
-            QVERIFY2(unmultipliedScore, qPrintable(QString::fromUtf8("unmultiplied scores label not created")));
-        }
+        QVERIFY2(mw.ui->statisticsLayout, qPrintable(QString::fromUtf8("not created statistics layout")));
+        QVERIFY2(mw.ui->statisticsTable, qPrintable(QString::fromUtf8("not created statistics table")));
+        QVERIFY2(mw.ui->statisticsTable->model() == mw.statisticsProxyModel, qPrintable(QString::fromUtf8("statistics table without model")));
+        QVERIFY2(mw.ui->statisticsTable->isSortingEnabled(), qPrintable(QString::fromUtf8("statistics table not sortable")));
+        QVERIFY2(mw.statisticsModel->columnCount() == StatisticsTableModel::NumberOfColumns, qPrintable(QString::fromUtf8("incorrect number of statistics columns")));
+        QVERIFY2(mw.statisticsModel->rowCount() == 0, qPrintable(QString::fromUtf8("statistics rows without players")));
 
         QVERIFY2(mw.ui->currentGameMultiplier, qPrintable(QString::fromUtf8("current game multiplier not created")));
         QVERIFY2(mw.ui->multiplierPreviewWidget, qPrintable(QString::fromUtf8("multiplier preview widget not created")));
@@ -237,34 +149,13 @@ void FrontendTest::ConstructionShallWorkCompletely() const//NOLINT(google-readab
         QVERIFY2(mw.ui->doubleMultiplier, qPrintable(QString::fromUtf8("double multiplier not created")));
         QVERIFY2(mw.ui->singleMultiplier, qPrintable(QString::fromUtf8("single multiplier not created")));
 
-        QVERIFY2(mw.ui->playerHistorySelectionWidget, qPrintable(QString::fromUtf8("not created player history selection widget")));
-        QVERIFY2(mw.ui->playerHistoryGridLayout, qPrintable(QString::fromUtf8("not created player history grid layout")));
-
-        QVERIFY2(!mw.ui->playerHistorySelectionLayouts.empty(), qPrintable(QString::fromUtf8("there must be playerHistorySelectionLayouts labels")));
-        QVERIFY2(mw.ui->playerHistorySelectionLayouts.size() == mw.ui->names.size(), qPrintable(QString::fromUtf8("sizes do not match: playerHistorySelectionLayouts, names")));
-        for(auto & playerHistorySelectionLayout : mw.ui->playerHistorySelectionLayouts)
-        {
-            QVERIFY2(playerHistorySelectionLayout, qPrintable(QString::fromUtf8("player history selection layout not created")));
-        }
-
-        QVERIFY2(!mw.ui->playerHistorySelectionCheckboxes.empty(), qPrintable(QString::fromUtf8("there must be playerHistorySelectionCheckboxes labels")));
-        QVERIFY2(mw.ui->playerHistorySelectionCheckboxes.size() == mw.ui->names.size(), qPrintable(QString::fromUtf8("sizes do not match: playerHistorySelectionCheckboxes, names")));
-        for(auto & playerHistorySelectionCheckboxe : mw.ui->playerHistorySelectionCheckboxes)
-        {
-            QVERIFY2(playerHistorySelectionCheckboxe, qPrintable(QString::fromUtf8("player history selection checkbox not created")));
-        }
-
-        QVERIFY2(!mw.ui->playerHistorySelectionLabels.empty(), qPrintable(QString::fromUtf8("there must be playerHistorySelectionLabels labels")));
-        QVERIFY2(mw.ui->playerHistorySelectionLabels.size() == mw.ui->names.size(), qPrintable(QString::fromUtf8("sizes do not match: playerHistorySelectionLabels, names")));
-        for(auto & playerHistorySelectionLabel : mw.ui->playerHistorySelectionLabels)
-        {
-            QVERIFY2(playerHistorySelectionLabel, qPrintable(QString::fromUtf8("player history selection label not created")));
-        }
+        QVERIFY2(mw.ui->playerHistorySelection, qPrintable(QString::fromUtf8("not created player history selection")));
+        QVERIFY2(mw.ui->playerHistorySelection->model() == mw.historySelectionModel, qPrintable(QString::fromUtf8("player history selection without model")));
+        QVERIFY2(mw.historySelectionModel->rowCount() == 0, qPrintable(QString::fromUtf8("player history selection rows without players")));
 
+        QVERIFY2(mw.ui->wholeSessionButton, qPrintable(QString::fromUtf8("not created whole session button")));
         QVERIFY2(mw.ui->plotPlayerHistory, qPrintable(QString::fromUtf8("not created player history plot")));
-
-        QVERIFY2(mw.StandardNamesStylesheet.compare(ExpectedStandardNamesStyleSheet) == 0, qPrintable(QString::fromUtf8("unexpected content of standard names style sheet")));
-        QVERIFY2(mw.DealerNamesStylesheet.compare(ExpectedDealerNamesStyleSheet) == 0, qPrintable(QString::fromUtf8("unexpected content of dealer names style sheet")));
+        QVERIFY2(mw.ui->plotPlayerHistory->graphCount() == 0, qPrintable(QString::fromUtf8("player history graphs without players")));
     }
     catch (std::exception & ex)
     {
@@ -302,14 +193,7 @@ void FrontendTest::CancellingInitialPlayerSelectionLeadsToDisabledUI()
     QVERIFY2(mw.ui->mandatorySoloButton->isEnabled() == false, qPrintable(QString::fromUtf8("incorrect state mandatorySoloButton")));
     QVERIFY2(mw.ui->aboutButton->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state aboutButton")));
 
-    QVERIFY2(mw.ui->actuals[0]->isVisible() == false, qPrintable(QString::fromUtf8("incorrect state actuals 0")));
-    QVERIFY2(mw.ui->actuals[1]->isVisible() == false, qPrintable(QString::fromUtf8("incorrect state actuals 1")));
-    QVERIFY2(mw.ui->actuals[2]->isVisible() == false, qPrintable(QString::fromUtf8("incorrect state actuals 2")));
-    QVERIFY2(mw.ui->actuals[3]->isVisible() == false, qPrintable(QString::fromUtf8("incorrect state actuals 3")));
-    QVERIFY2(mw.ui->actuals[4]->isVisible() == false, qPrintable(QString::fromUtf8("incorrect state actuals 4")));
-    QVERIFY2(mw.ui->actuals[5]->isVisible() == false, qPrintable(QString::fromUtf8("incorrect state actuals 5")));
-    QVERIFY2(mw.ui->actuals[6]->isVisible() == false, qPrintable(QString::fromUtf8("incorrect state actuals 6")));
-    QVERIFY2(mw.ui->actuals[7]->isVisible() == false, qPrintable(QString::fromUtf8("incorrect state actuals 7")));
+    QVERIFY2(mw.standingsModel->rowCount() == 0, qPrintable(QString::fromUtf8("standings rows without players")));
 
     QVERIFY2(mw.ui->remainingGamesInRound->text().compare(QString::fromUtf8("Neue Runde")) == 0, qPrintable(QString::fromUtf8("incorrect remaining games in round")));
 
@@ -344,51 +228,51 @@ void FrontendTest::SetDataShallBeDisplayed()
     mw.UpdateDisplay();
 
     // Assert
-    QVERIFY2(mw.ui->names[0]->text().compare(QString::fromUtf8("A")) == 0, qPrintable(QString::fromUtf8("incorrect player name 0")));
-    QVERIFY2(mw.ui->names[1]->text().compare(QString::fromUtf8("B")) == 0, qPrintable(QString::fromUtf8("incorrect player name 1")));
-    QVERIFY2(mw.ui->names[2]->text().compare(QString::fromUtf8("C")) == 0, qPrintable(QString::fromUtf8("incorrect player name 2")));
-    QVERIFY2(mw.ui->names[3]->text().compare(QString::fromUtf8("D")) == 0, qPrintable(QString::fromUtf8("incorrect player name 3")));
-    QVERIFY2(mw.ui->names[4]->text().compare(QString::fromUtf8("E")) == 0, qPrintable(QString::fromUtf8("incorrect player name 4")));
-    QVERIFY2(mw.ui->names[5]->text().compare(QString::fromUtf8("F")) == 0, qPrintable(QString::fromUtf8("incorrect player name 5")));
-
-    QVERIFY2(mw.ui->names[0]->styleSheet().compare(ExpectedStandardNamesStyleSheet) == 0, qPrintable(QString::fromUtf8("incorrect dealer state name 0")));
-    QVERIFY2(mw.ui->names[1]->styleSheet().compare(ExpectedStandardNamesStyleSheet) == 0, qPrintable(QString::fromUtf8("incorrect dealer state name 1")));
-    QVERIFY2(mw.ui->names[2]->styleSheet().compare(ExpectedDealerNamesStyleSheet) == 0, qPrintable(QString::fromUtf8("incorrect dealer state name 2")));
-    QVERIFY2(mw.ui->names[3]->styleSheet().compare(ExpectedStandardNamesStyleSheet) == 0, qPrintable(QString::fromUtf8("incorrect dealer state name 3")));
-    QVERIFY2(mw.ui->names[4]->styleSheet().compare(ExpectedStandardNamesStyleSheet) == 0, qPrintable(QString::fromUtf8("incorrect dealer state name 4")));
-    QVERIFY2(mw.ui->names[5]->styleSheet().compare(ExpectedStandardNamesStyleSheet) == 0, qPrintable(QString::fromUtf8("incorrect dealer state name 5")));
-
-    QVERIFY2(mw.ui->actuals[0]->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 0")));
-    QVERIFY2(mw.ui->actuals[1]->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 1")));
-    QVERIFY2(mw.ui->actuals[2]->isEnabled() == false, qPrintable(QString::fromUtf8("incorrect state actuals 2")));
-    QVERIFY2(mw.ui->actuals[3]->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 3")));
-    QVERIFY2(mw.ui->actuals[4]->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 4")));
-    QVERIFY2(mw.ui->actuals[5]->isEnabled() == false, qPrintable(QString::fromUtf8("incorrect state actuals 5")));
+    QVERIFY2(StandingsText(mw, 0, StandingsTableModel::Name).compare(QString::fromUtf8("A")) == 0, qPrintable(QString::fromUtf8("incorrect player name 0")));
+    QVERIFY2(StandingsText(mw, 1, StandingsTableModel::Name).compare(QString::fromUtf8("B")) == 0, qPrintable(QString::fromUtf8("incorrect player name 1")));
+    QVERIFY2(StandingsText(mw, 2, StandingsTableModel::Name).compare(QString::fromUtf8("C")) == 0, qPrintable(QString::fromUtf8("incorrect player name 2")));
+    QVERIFY2(StandingsText(mw, 3, StandingsTableModel::Name).compare(QString::fromUtf8("D")) == 0, qPrintable(QString::fromUtf8("incorrect player name 3")));
+    QVERIFY2(StandingsText(mw, 4, StandingsTableModel::Name).compare(QString::fromUtf8("E")) == 0, qPrintable(QString::fromUtf8("incorrect player name 4")));
+    QVERIFY2(StandingsText(mw, 5, StandingsTableModel::Name).compare(QString::fromUtf8("F")) == 0, qPrintable(QString::fromUtf8("incorrect player name 5")));
+
+    QVERIFY2(!IsDealer(mw, 0), qPrintable(QString::fromUtf8("incorrect dealer state name 0")));
+    QVERIFY2(!IsDealer(mw, 1), qPrintable(QString::fromUtf8("incorrect dealer state name 1")));
+    QVERIFY2(IsDealer(mw, 2), qPrintable(QString::fromUtf8("incorrect dealer state name 2")));
+    QVERIFY2(!IsDealer(mw, 3), qPrintable(QString::fromUtf8("incorrect dealer state name 3")));
+    QVERIFY2(!IsDealer(mw, 4), qPrintable(QString::fromUtf8("incorrect dealer state name 4")));
+    QVERIFY2(!IsDealer(mw, 5), qPrintable(QString::fromUtf8("incorrect dealer state name 5")));
+
+    QVERIFY2(Input(mw, 0)->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 0")));
+    QVERIFY2(Input(mw, 1)->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 1")));
+    QVERIFY2(Input(mw, 2)->isEnabled() == false, qPrintable(QString::fromUtf8("incorrect state actuals 2")));
+    QVERIFY2(Input(mw, 3)->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 3")));
+    QVERIFY2(Input(mw, 4)->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 4")));
+    QVERIFY2(Input(mw, 5)->isEnabled() == false, qPrintable(QString::fromUtf8("incorrect state actuals 5")));
 
     QVERIFY2(mw.ui->remainingGamesInRound->text().compare(QString::fromUtf8("Neue Runde")) == 0, qPrintable(QString::fromUtf8("incorrect remaining games in round")));
 
-    QVERIFY2(mw.ui->scores[0]->text().compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect scores 0")));
-    QVERIFY2(mw.ui->scores[1]->text().compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect scores 1")));
-    QVERIFY2(mw.ui->scores[2]->text().compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect scores 2")));
-    QVERIFY2(mw.ui->scores[3]->text().compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect scores 3")));
-    QVERIFY2(mw.ui->scores[4]->text().compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect scores 4")));
-    QVERIFY2(mw.ui->scores[5]->text().compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect scores 5")));
+    QVERIFY2(StandingsText(mw, 0, StandingsTableModel::Score).compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect scores 0")));
+    QVERIFY2(StandingsText(mw, 1, StandingsTableModel::Score).compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect scores 1")));
+    QVERIFY2(StandingsText(mw, 2, StandingsTableModel::Score).compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect scores 2")));
+    QVERIFY2(StandingsText(mw, 3, StandingsTableModel::Score).compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect scores 3")));
+    QVERIFY2(StandingsText(mw, 4, StandingsTableModel::Score).compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect scores 4")));
+    QVERIFY2(StandingsText(mw, 5, StandingsTableModel::Score).compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect scores 5")));
 
-    QVERIFY2(mw.ui->actuals[0]->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 0 not empty")));
-    QVERIFY2(mw.ui->actuals[1]->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 1 not empty")));
-    QVERIFY2(mw.ui->actuals[2]->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 2 not empty")));
-    QVERIFY2(mw.ui->actuals[3]->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 3 not empty")));
-    QVERIFY2(mw.ui->actuals[4]->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 4 not empty")));
-    QVERIFY2(mw.ui->actuals[5]->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 5 not empty")));
+    QVERIFY2(Input(mw, 0)->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 0 not empty")));
+    QVERIFY2(Input(mw, 1)->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 1 not empty")));
+    QVERIFY2(Input(mw, 2)->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 2 not empty")));
+    QVERIFY2(Input(mw, 3)->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 3 not empty")));
+    QVERIFY2(Input(mw, 4)->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 4 not empty")));
+    QVERIFY2(Input(mw, 5)->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 5 not empty")));
 
     QVERIFY2(mw.ui->spinBox->value() == 0, qPrintable(QString::fromUtf8("events spinbox not set to zero")));
 
-    QVERIFY2(mw.ui->cashs[0]->text().compare(QString::fromUtf8("0,00")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 0")));
-    QVERIFY2(mw.ui->cashs[1]->text().compare(QString::fromUtf8("0,00")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 1")));
-    QVERIFY2(mw.ui->cashs[2]->text().compare(QString::fromUtf8("0,00")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 2")));
-    QVERIFY2(mw.ui->cashs[3]->text().compare(QString::fromUtf8("0,00")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 3")));
-    QVERIFY2(mw.ui->cashs[4]->text().compare(QString::fromUtf8("0,00")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 4")));
-    QVERIFY2(mw.ui->cashs[5]->text().compare(QString::fromUtf8("0,00")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 5")));
+    QVERIFY2(StandingsText(mw, 0, StandingsTableModel::Cash).compare(QString::fromUtf8("0,00")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 0")));
+    QVERIFY2(StandingsText(mw, 1, StandingsTableModel::Cash).compare(QString::fromUtf8("0,00")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 1")));
+    QVERIFY2(StandingsText(mw, 2, StandingsTableModel::Cash).compare(QString::fromUtf8("0,00")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 2")));
+    QVERIFY2(StandingsText(mw, 3, StandingsTableModel::Cash).compare(QString::fromUtf8("0,00")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 3")));
+    QVERIFY2(StandingsText(mw, 4, StandingsTableModel::Cash).compare(QString::fromUtf8("0,00")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 4")));
+    QVERIFY2(StandingsText(mw, 5, StandingsTableModel::Cash).compare(QString::fromUtf8("0,00")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 5")));
 
     QVERIFY2(mw.ui->totalCash->text().compare(QString::fromUtf8("0,00 (inkl. 0,00 pro Abwesender)")) == 0, qPrintable(QString::fromUtf8("incorrect totalCash")));
 
@@ -425,7 +309,7 @@ void FrontendTest::PlayerSelectionButtonShallTriggerDialogAndSetDataShallBeUsed(
 
     QVERIFY2(mw.playerSelection == nullptr, qPrintable(QString::fromUtf8("playerSelection still reachable")));
 
-    QVERIFY2(mw.ui->names[1]->text().compare(QString::fromUtf8("NewPlayer")) == 0, qPrintable(QString::fromUtf8("incorrect name")));
+    QVERIFY2(StandingsText(mw, 1, StandingsTableModel::Name).compare(QString::fromUtf8("NewPlayer")) == 0, qPrintable(QString::fromUtf8("incorrect name")));
 }
 
 void FrontendTest::OneCommittedGameShallBeDisplayed()
@@ -455,63 +339,63 @@ void FrontendTest::OneCommittedGameShallBeDisplayed()
     mw.UpdateDisplay();
 
     // Act
-    mw.ui->actuals[0]->setText(QString::fromUtf8("2"));
-    mw.ui->actuals[3]->setText(QString::fromUtf8("2"));
+    Input(mw, 0)->setText(QString::fromUtf8("2"));
+    Input(mw, 3)->setText(QString::fromUtf8("2"));
     QTest::mouseClick(mw.ui->commitButton, Qt::LeftButton);
 
     // Assert
-    QVERIFY2(mw.ui->names[0]->text().compare(QString::fromUtf8("A")) == 0, qPrintable(QString::fromUtf8("incorrect player name 0")));
-    QVERIFY2(mw.ui->names[1]->text().compare(QString::fromUtf8("B")) == 0, qPrintable(QString::fromUtf8("incorrect player name 1")));
-    QVERIFY2(mw.ui->names[2]->text().compare(QString::fromUtf8("C")) == 0, qPrintable(QString::fromUtf8("incorrect player name 2")));
-    QVERIFY2(mw.ui->names[3]->text().compare(QString::fromUtf8("D")) == 0, qPrintable(QString::fromUtf8("incorrect player name 3")));
-    QVERIFY2(mw.ui->names[4]->text().compare(QString::fromUtf8("E")) == 0, qPrintable(QString::fromUtf8("incorrect player name 4")));
-    QVERIFY2(mw.ui->names[5]->text().compare(QString::fromUtf8("F")) == 0, qPrintable(QString::fromUtf8("incorrect player name 5")));
-
-    QVERIFY2(mw.ui->names[0]->styleSheet().compare(ExpectedStandardNamesStyleSheet) == 0, qPrintable(QString::fromUtf8("incorrect dealer state name 0")));
-    QVERIFY2(mw.ui->names[1]->styleSheet().compare(ExpectedStandardNamesStyleSheet) == 0, qPrintable(QString::fromUtf8("incorrect dealer state name 1")));
-    QVERIFY2(mw.ui->names[2]->styleSheet().compare(ExpectedStandardNamesStyleSheet) == 0, qPrintable(QString::fromUtf8("incorrect dealer state name 2")));
-    QVERIFY2(mw.ui->names[3]->styleSheet().compare(ExpectedDealerNamesStyleSheet) == 0, qPrintable(QString::fromUtf8("incorrect dealer state name 3")));
-    QVERIFY2(mw.ui->names[4]->styleSheet().compare(ExpectedStandardNamesStyleSheet) == 0, qPrintable(QString::fromUtf8("incorrect dealer state name 4")));
-    QVERIFY2(mw.ui->names[5]->styleSheet().compare(ExpectedStandardNamesStyleSheet) == 0, qPrintable(QString::fromUtf8("incorrect dealer state name 5")));
-
-    QVERIFY2(mw.ui->actuals[0]->isEnabled() == false, qPrintable(QString::fromUtf8("incorrect state actuals 0")));
-    QVERIFY2(mw.ui->actuals[1]->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 1")));
-    QVERIFY2(mw.ui->actuals[2]->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 2")));
-    QVERIFY2(mw.ui->actuals[3]->isEnabled() == false, qPrintable(QString::fromUtf8("incorrect state actuals 3")));
-    QVERIFY2(mw.ui->actuals[4]->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 4")));
-    QVERIFY2(mw.ui->actuals[5]->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 5")));
+    QVERIFY2(StandingsText(mw, 0, StandingsTableModel::Name).compare(QString::fromUtf8("A")) == 0, qPrintable(QString::fromUtf8("incorrect player name 0")));
+    QVERIFY2(StandingsText(mw, 1, StandingsTableModel::Name).compare(QString::fromUtf8("B")) == 0, qPrintable(QString::fromUtf8("incorrect player name 1")));
+    QVERIFY2(StandingsText(mw, 2, StandingsTableModel::Name).compare(QString::fromUtf8("C")) == 0, qPrintable(QString::fromUtf8("incorrect player name 2")));
+    QVERIFY2(StandingsText(mw, 3, StandingsTableModel::Name).compare(QString::fromUtf8("D")) == 0, qPrintable(QString::fromUtf8("incorrect player name 3")));
+    QVERIFY2(StandingsText(mw, 4, StandingsTableModel::Name).compare(QString::fromUtf8("E")) == 0, qPrintable(QString::fromUtf8("incorrect player name 4")));
+    QVERIFY2(StandingsText(mw, 5, StandingsTableModel::Name).compare(QString::fromUtf8("F")) == 0, qPrintable(QString::fromUtf8("incorrect player name 5")));
+
+    QVERIFY2(!IsDealer(mw, 0), qPrintable(QString::fromUtf8("incorrect dealer state name 0")));
+    QVERIFY2(!IsDealer(mw, 1), qPrintable(QString::fromUtf8("incorrect dealer state name 1")));
+    QVERIFY2(!IsDealer(mw, 2), qPrintable(QString::fromUtf8("incorrect dealer state name 2")));
+    QVERIFY2(IsDealer(mw, 3), qPrintable(QString::fromUtf8("incorrect dealer state name 3")));
+    QVERIFY2(!IsDealer(mw, 4), qPrintable(QString::fromUtf8("incorrect dealer state name 4")));
+    QVERIFY2(!IsDealer(mw, 5), qPrintable(QString::fromUtf8("incorrect dealer state name 5")));
+
+    QVERIFY2(Input(mw, 0)->isEnabled() == false, qPrintable(QString::fromUtf8("incorrect state actuals 0")));
+    QVERIFY2(Input(mw, 1)->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 1")));
+    QVERIFY2(Input(mw, 2)->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 2")));
+    QVERIFY2(Input(mw, 3)->isEnabled() == false, qPrintable(QString::fromUtf8("incorrect state actuals 3")));
+    QVERIFY2(Input(mw, 4)->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 4")));
+    QVERIFY2(Input(mw, 5)->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 5")));
 
     QVERIFY2(mw.ui->remainingGamesInRound->text().compare(QString::fromUtf8("5 Spiele in Runde")) == 0, qPrintable(QString::fromUtf8("incorrect remaining games in round")));
 
-    QVERIFY2(mw.ui->scores[0]->text().compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("incorrect scores 0")));
-    QVERIFY2(mw.ui->scores[1]->text().compare(QString::fromUtf8("-2")) == 0, qPrintable(QString::fromUtf8("incorrect scores 1")));
-    QVERIFY2(mw.ui->scores[2]->text().compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect scores 2")));
-    QVERIFY2(mw.ui->scores[3]->text().compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("incorrect scores 3")));
-    QVERIFY2(mw.ui->scores[4]->text().compare(QString::fromUtf8("-2")) == 0, qPrintable(QString::fromUtf8("incorrect scores 4")));
-    QVERIFY2(mw.ui->scores[5]->text().compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect scores 5")));
-
-    QVERIFY2(mw.ui->lastGames[0]->text().compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("incorrect last games 0")));
-    QVERIFY2(mw.ui->lastGames[1]->text().compare(QString::fromUtf8("-2")) == 0, qPrintable(QString::fromUtf8("incorrect last games 1")));
-    QVERIFY2(mw.ui->lastGames[2]->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect last games 2")));
-    QVERIFY2(mw.ui->lastGames[3]->text().compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("incorrect last games 3")));
-    QVERIFY2(mw.ui->lastGames[4]->text().compare(QString::fromUtf8("-2")) == 0, qPrintable(QString::fromUtf8("incorrect last games 4")));
-    QVERIFY2(mw.ui->lastGames[5]->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect last games 5")));
-
-    QVERIFY2(mw.ui->actuals[0]->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 0 not empty")));
-    QVERIFY2(mw.ui->actuals[1]->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 1 not empty")));
-    QVERIFY2(mw.ui->actuals[2]->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 2 not empty")));
-    QVERIFY2(mw.ui->actuals[3]->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 3 not empty")));
-    QVERIFY2(mw.ui->actuals[4]->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 4 not empty")));
-    QVERIFY2(mw.ui->actuals[5]->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 5 not empty")));
+    QVERIFY2(StandingsText(mw, 0, StandingsTableModel::Score).compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("incorrect scores 0")));
+    QVERIFY2(StandingsText(mw, 1, StandingsTableModel::Score).compare(QString::fromUtf8("-2")) == 0, qPrintable(QString::fromUtf8("incorrect scores 1")));
+    QVERIFY2(StandingsText(mw, 2, StandingsTableModel::Score).compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect scores 2")));
+    QVERIFY2(StandingsText(mw, 3, StandingsTableModel::Score).compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("incorrect scores 3")));
+    QVERIFY2(StandingsText(mw, 4, StandingsTableModel::Score).compare(QString::fromUtf8("-2")) == 0, qPrintable(QString::fromUtf8("incorrect scores 4")));
+    QVERIFY2(StandingsText(mw, 5, StandingsTableModel::Score).compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect scores 5")));
+
+    QVERIFY2(StandingsText(mw, 0, StandingsTableModel::LastGame).compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("incorrect last games 0")));
+    QVERIFY2(StandingsText(mw, 1, StandingsTableModel::LastGame).compare(QString::fromUtf8("-2")) == 0, qPrintable(QString::fromUtf8("incorrect last games 1")));
+    QVERIFY2(StandingsText(mw, 2, StandingsTableModel::LastGame).compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect last games 2")));
+    QVERIFY2(StandingsText(mw, 3, StandingsTableModel::LastGame).compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("incorrect last games 3")));
+    QVERIFY2(StandingsText(mw, 4, StandingsTableModel::LastGame).compare(QString::fromUtf8("-2")) == 0, qPrintable(QString::fromUtf8("incorrect last games 4")));
+    QVERIFY2(StandingsText(mw, 5, StandingsTableModel::LastGame).compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect last games 5")));
+
+    QVERIFY2(Input(mw, 0)->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 0 not empty")));
+    QVERIFY2(Input(mw, 1)->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 1 not empty")));
+    QVERIFY2(Input(mw, 2)->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 2 not empty")));
+    QVERIFY2(Input(mw, 3)->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 3 not empty")));
+    QVERIFY2(Input(mw, 4)->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 4 not empty")));
+    QVERIFY2(Input(mw, 5)->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 5 not empty")));
 
     QVERIFY2(mw.ui->spinBox->value() == 0, qPrintable(QString::fromUtf8("events spinbox not set to zero")));
 
-    QVERIFY2(mw.ui->cashs[0]->text().compare(QString::fromUtf8("0,00")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 0")));
-    QVERIFY2(mw.ui->cashs[1]->text().compare(QString::fromUtf8("0,02")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 1")));
-    QVERIFY2(mw.ui->cashs[2]->text().compare(QString::fromUtf8("0,01")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 2")));
-    QVERIFY2(mw.ui->cashs[3]->text().compare(QString::fromUtf8("0,00")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 3")));
-    QVERIFY2(mw.ui->cashs[4]->text().compare(QString::fromUtf8("0,02")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 4")));
-    QVERIFY2(mw.ui->cashs[5]->text().compare(QString::fromUtf8("0,01")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 5")));
+    QVERIFY2(StandingsText(mw, 0, StandingsTableModel::Cash).compare(QString::fromUtf8("0,00")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 0")));
+    QVERIFY2(StandingsText(mw, 1, StandingsTableModel::Cash).compare(QString::fromUtf8("0,02")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 1")));
+    QVERIFY2(StandingsText(mw, 2, StandingsTableModel::Cash).compare(QString::fromUtf8("0,01")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 2")));
+    QVERIFY2(StandingsText(mw, 3, StandingsTableModel::Cash).compare(QString::fromUtf8("0,00")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 3")));
+    QVERIFY2(StandingsText(mw, 4, StandingsTableModel::Cash).compare(QString::fromUtf8("0,02")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 4")));
+    QVERIFY2(StandingsText(mw, 5, StandingsTableModel::Cash).compare(QString::fromUtf8("0,01")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 5")));
 
     QVERIFY2(mw.ui->totalCash->text().compare(QString::fromUtf8("0,08 (inkl. 0,01 pro Abwesender)")) == 0, qPrintable(QString::fromUtf8("incorrect totalCash")));
 
@@ -548,67 +432,67 @@ void FrontendTest::TwoCommittedGamesShallBeDisplayed()
     mw.UpdateDisplay();
 
     // Act
-    mw.ui->actuals[0]->setText(QString::fromUtf8("2"));
-    mw.ui->actuals[3]->setText(QString::fromUtf8("2"));
+    Input(mw, 0)->setText(QString::fromUtf8("2"));
+    Input(mw, 3)->setText(QString::fromUtf8("2"));
     QTest::mouseClick(mw.ui->commitButton, Qt::LeftButton);
 
-    mw.ui->actuals[2]->setText(QString::fromUtf8("-3"));
-    mw.ui->actuals[4]->setText(QString::fromUtf8("-3"));
+    Input(mw, 2)->setText(QString::fromUtf8("-3"));
+    Input(mw, 4)->setText(QString::fromUtf8("-3"));
     QTest::mouseClick(mw.ui->commitButton, Qt::LeftButton);
 
     // Assert
-    QVERIFY2(mw.ui->names[0]->text().compare(QString::fromUtf8("A")) == 0, qPrintable(QString::fromUtf8("incorrect player name 0")));
-    QVERIFY2(mw.ui->names[1]->text().compare(QString::fromUtf8("B")) == 0, qPrintable(QString::fromUtf8("incorrect player name 1")));
-    QVERIFY2(mw.ui->names[2]->text().compare(QString::fromUtf8("C")) == 0, qPrintable(QString::fromUtf8("incorrect player name 2")));
-    QVERIFY2(mw.ui->names[3]->text().compare(QString::fromUtf8("D")) == 0, qPrintable(QString::fromUtf8("incorrect player name 3")));
-    QVERIFY2(mw.ui->names[4]->text().compare(QString::fromUtf8("E")) == 0, qPrintable(QString::fromUtf8("incorrect player name 4")));
-    QVERIFY2(mw.ui->names[5]->text().compare(QString::fromUtf8("F")) == 0, qPrintable(QString::fromUtf8("incorrect player name 5")));
-
-    QVERIFY2(mw.ui->names[0]->styleSheet().compare(ExpectedStandardNamesStyleSheet) == 0, qPrintable(QString::fromUtf8("incorrect dealer state name 0")));
-    QVERIFY2(mw.ui->names[1]->styleSheet().compare(ExpectedStandardNamesStyleSheet) == 0, qPrintable(QString::fromUtf8("incorrect dealer state name 1")));
-    QVERIFY2(mw.ui->names[2]->styleSheet().compare(ExpectedStandardNamesStyleSheet) == 0, qPrintable(QString::fromUtf8("incorrect dealer state name 2")));
-    QVERIFY2(mw.ui->names[3]->styleSheet().compare(ExpectedStandardNamesStyleSheet) == 0, qPrintable(QString::fromUtf8("incorrect dealer state name 3")));
-    QVERIFY2(mw.ui->names[4]->styleSheet().compare(ExpectedDealerNamesStyleSheet) == 0, qPrintable(QString::fromUtf8("incorrect dealer state name 4")));
-    QVERIFY2(mw.ui->names[5]->styleSheet().compare(ExpectedStandardNamesStyleSheet) == 0, qPrintable(QString::fromUtf8("incorrect dealer state name 5")));
-
-    QVERIFY2(mw.ui->actuals[0]->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 0")));
-    QVERIFY2(mw.ui->actuals[1]->isEnabled() == false, qPrintable(QString::fromUtf8("incorrect state actuals 1")));
-    QVERIFY2(mw.ui->actuals[2]->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 2")));
-    QVERIFY2(mw.ui->actuals[3]->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 3")));
-    QVERIFY2(mw.ui->actuals[4]->isEnabled() == false, qPrintable(QString::fromUtf8("incorrect state actuals 4")));
-    QVERIFY2(mw.ui->actuals[5]->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 5")));
+    QVERIFY2(StandingsText(mw, 0, StandingsTableModel::Name).compare(QString::fromUtf8("A")) == 0, qPrintable(QString::fromUtf8("incorrect player name 0")));
+    QVERIFY2(StandingsText(mw, 1, StandingsTableModel::Name).compare(QString::fromUtf8("B")) == 0, qPrintable(QString::fromUtf8("incorrect player name 1")));
+    QVERIFY2(StandingsText(mw, 2, StandingsTableModel::Name).compare(QString::fromUtf8("C")) == 0, qPrintable(QString::fromUtf8("incorrect player name 2")));
+    QVERIFY2(StandingsText(mw, 3, StandingsTableModel::Name).compare(QString::fromUtf8("D")) == 0, qPrintable(QString::fromUtf8("incorrect player name 3")));
+    QVERIFY2(StandingsText(mw, 4, StandingsTableModel::Name).compare(QString::fromUtf8("E")) == 0, qPrintable(QString::fromUtf8("incorrect player name 4")));
+    QVERIFY2(StandingsText(mw, 5, StandingsTableModel::Name).compare(QString::fromUtf8("F")) == 0, qPrintable(QString::fromUtf8("incorrect player name 5")));
+
+    QVERIFY2(!IsDealer(mw, 0), qPrintable(QString::fromUtf8("incorrect dealer state name 0")));
+    QVERIFY2(!IsDealer(mw, 1), qPrintable(QString::fromUtf8("incorrect dealer state name 1")));
+    QVERIFY2(!IsDealer(mw, 2), qPrintable(QString::fromUtf8("incorrect dealer state name 2")));
+    QVERIFY2(!IsDealer(mw, 3), qPrintable(QString::fromUtf8("incorrect dealer state name 3")));
+    QVERIFY2(IsDealer(mw, 4), qPrintable(QString::fromUtf8("incorrect dealer state name 4")));
+    QVERIFY2(!IsDealer(mw, 5), qPrintable(QString::fromUtf8("incorrect dealer state name 5")));
+
+    QVERIFY2(Input(mw, 0)->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 0")));
+    QVERIFY2(Input(mw, 1)->isEnabled() == false, qPrintable(QString::fromUtf8("incorrect state actuals 1")));
+    QVERIFY2(Input(mw, 2)->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 2")));
+    QVERIFY2(Input(mw, 3)->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 3")));
+    QVERIFY2(Input(mw, 4)->isEnabled() == false, qPrintable(QString::fromUtf8("incorrect state actuals 4")));
+    QVERIFY2(Input(mw, 5)->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 5")));
 
     QVERIFY2(mw.ui->remainingGamesInRound->text().compare(QString::fromUtf8("4 Spiele in Runde")) == 0, qPrintable(QString::fromUtf8("incorrect remaining games in round")));
 
-    QVERIFY2(mw.ui->scores[0]->text().compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("incorrect scores 0")));
-    QVERIFY2(mw.ui->scores[1]->text().compare(QString::fromUtf8("1")) == 0, qPrintable(QString::fromUtf8("incorrect scores 1")));
-    QVERIFY2(mw.ui->scores[2]->text().compare(QString::fromUtf8("-3")) == 0, qPrintable(QString::fromUtf8("incorrect scores 2")));
-    QVERIFY2(mw.ui->scores[3]->text().compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("incorrect scores 3")));
-    QVERIFY2(mw.ui->scores[4]->text().compare(QString::fromUtf8("-5")) == 0, qPrintable(QString::fromUtf8("incorrect scores 4")));
-    QVERIFY2(mw.ui->scores[5]->text().compare(QString::fromUtf8("3")) == 0, qPrintable(QString::fromUtf8("incorrect scores 5")));
-
-    QVERIFY2(mw.ui->lastGames[0]->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect last games 0")));
-    QVERIFY2(mw.ui->lastGames[1]->text().compare(QString::fromUtf8("3")) == 0, qPrintable(QString::fromUtf8("incorrect last games 1")));
-    QVERIFY2(mw.ui->lastGames[2]->text().compare(QString::fromUtf8("-3")) == 0, qPrintable(QString::fromUtf8("incorrect last games 2")));
-    QVERIFY2(mw.ui->lastGames[3]->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect last games 3")));
-    QVERIFY2(mw.ui->lastGames[4]->text().compare(QString::fromUtf8("-3")) == 0, qPrintable(QString::fromUtf8("incorrect last games 4")));
-    QVERIFY2(mw.ui->lastGames[5]->text().compare(QString::fromUtf8("3")) == 0, qPrintable(QString::fromUtf8("incorrect last games 5")));
-
-    QVERIFY2(mw.ui->actuals[0]->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 0 not empty")));
-    QVERIFY2(mw.ui->actuals[1]->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 1 not empty")));
-    QVERIFY2(mw.ui->actuals[2]->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 2 not empty")));
-    QVERIFY2(mw.ui->actuals[3]->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 3 not empty")));
-    QVERIFY2(mw.ui->actuals[4]->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 4 not empty")));
-    QVERIFY2(mw.ui->actuals[5]->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 5 not empty")));
+    QVERIFY2(StandingsText(mw, 0, StandingsTableModel::Score).compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("incorrect scores 0")));
+    QVERIFY2(StandingsText(mw, 1, StandingsTableModel::Score).compare(QString::fromUtf8("1")) == 0, qPrintable(QString::fromUtf8("incorrect scores 1")));
+    QVERIFY2(StandingsText(mw, 2, StandingsTableModel::Score).compare(QString::fromUtf8("-3")) == 0, qPrintable(QString::fromUtf8("incorrect scores 2")));
+    QVERIFY2(StandingsText(mw, 3, StandingsTableModel::Score).compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("incorrect scores 3")));
+    QVERIFY2(StandingsText(mw, 4, StandingsTableModel::Score).compare(QString::fromUtf8("-5")) == 0, qPrintable(QString::fromUtf8("incorrect scores 4")));
+    QVERIFY2(StandingsText(mw, 5, StandingsTableModel::Score).compare(QString::fromUtf8("3")) == 0, qPrintable(QString::fromUtf8("incorrect scores 5")));
+
+    QVERIFY2(StandingsText(mw, 0, StandingsTableModel::LastGame).compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect last games 0")));
+    QVERIFY2(StandingsText(mw, 1, StandingsTableModel::LastGame).compare(QString::fromUtf8("3")) == 0, qPrintable(QString::fromUtf8("incorrect last games 1")));
+    QVERIFY2(StandingsText(mw, 2, StandingsTableModel::LastGame).compare(QString::fromUtf8("-3")) == 0, qPrintable(QString::fromUtf8("incorrect last games 2")));
+    QVERIFY2(StandingsText(mw, 3, StandingsTableModel::LastGame).compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect last games 3")));
+    QVERIFY2(StandingsText(mw, 4, StandingsTableModel::LastGame).compare(QString::fromUtf8("-3")) == 0, qPrintable(QString::fromUtf8("incorrect last games 4")));
+    QVERIFY2(StandingsText(mw, 5, StandingsTableModel::LastGame).compare(QString::fromUtf8("3")) == 0, qPrintable(QString::fromUtf8("incorrect last games 5")));
+
+    QVERIFY2(Input(mw, 0)->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 0 not empty")));
+    QVERIFY2(Input(mw, 1)->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 1 not empty")));
+    QVERIFY2(Input(mw, 2)->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 2 not empty")));
+    QVERIFY2(Input(mw, 3)->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 3 not empty")));
+    QVERIFY2(Input(mw, 4)->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 4 not empty")));
+    QVERIFY2(Input(mw, 5)->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 5 not empty")));
 
     QVERIFY2(mw.ui->spinBox->value() == 0, qPrintable(QString::fromUtf8("events spinbox not set to zero")));
 
-    QVERIFY2(mw.ui->cashs[0]->text().compare(QString::fromUtf8("0,00")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 0")));
-    QVERIFY2(mw.ui->cashs[1]->text().compare(QString::fromUtf8("0,01")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 1")));
-    QVERIFY2(mw.ui->cashs[2]->text().compare(QString::fromUtf8("0,03")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 2")));
-    QVERIFY2(mw.ui->cashs[3]->text().compare(QString::fromUtf8("0,00")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 3")));
-    QVERIFY2(mw.ui->cashs[4]->text().compare(QString::fromUtf8("0,04")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 4")));
-    QVERIFY2(mw.ui->cashs[5]->text().compare(QString::fromUtf8("0,00")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 5")));
+    QVERIFY2(StandingsText(mw, 0, StandingsTableModel::Cash).compare(QString::fromUtf8("0,00")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 0")));
+    QVERIFY2(StandingsText(mw, 1, StandingsTableModel::Cash).compare(QString::fromUtf8("0,01")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 1")));
+    QVERIFY2(StandingsText(mw, 2, StandingsTableModel::Cash).compare(QString::fromUtf8("0,03")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 2")));
+    QVERIFY2(StandingsText(mw, 3, StandingsTableModel::Cash).compare(QString::fromUtf8("0,00")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 3")));
+    QVERIFY2(StandingsText(mw, 4, StandingsTableModel::Cash).compare(QString::fromUtf8("0,04")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 4")));
+    QVERIFY2(StandingsText(mw, 5, StandingsTableModel::Cash).compare(QString::fromUtf8("0,00")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 5")));
 
     QVERIFY2(mw.ui->totalCash->text().compare(QString::fromUtf8("0,10 (inkl. 0,01 pro Abwesender)")) == 0, qPrintable(QString::fromUtf8("incorrect totalCash")));
 
@@ -648,67 +532,67 @@ void FrontendTest::TwoCommittedAndTwoPoppedGameShallBeDisplayed() //NOLINT(googl
     // Act, Assert
     bool isEnabled1 = mw.ui->resetButton->isEnabled();
 
-    mw.ui->actuals[0]->setText(QString::fromUtf8("2"));
-    mw.ui->actuals[3]->setText(QString::fromUtf8("2"));
+    Input(mw, 0)->setText(QString::fromUtf8("2"));
+    Input(mw, 3)->setText(QString::fromUtf8("2"));
     mw.ui->spinBox->setValue(1);
 
     QTest::mouseClick(mw.ui->commitButton, Qt::LeftButton);
 
     bool isEnabled2 = mw.ui->resetButton->isEnabled();
 
-    mw.ui->actuals[2]->setText(QString::fromUtf8("-3"));
-    mw.ui->actuals[4]->setText(QString::fromUtf8("-3"));
+    Input(mw, 2)->setText(QString::fromUtf8("-3"));
+    Input(mw, 4)->setText(QString::fromUtf8("-3"));
     mw.ui->spinBox->setValue(2);
 
     QTest::mouseClick(mw.ui->commitButton, Qt::LeftButton);
 
     bool isEnabled3 = mw.ui->resetButton->isEnabled();
 
-    QVERIFY2(mw.ui->names[0]->text().compare(QString::fromUtf8("A")) == 0, qPrintable(QString::fromUtf8("incorrect player name 0")));
-    QVERIFY2(mw.ui->names[1]->text().compare(QString::fromUtf8("B")) == 0, qPrintable(QString::fromUtf8("incorrect player name 1")));
-    QVERIFY2(mw.ui->names[2]->text().compare(QString::fromUtf8("C")) == 0, qPrintable(QString::fromUtf8("incorrect player name 2")));
-    QVERIFY2(mw.ui->names[3]->text().compare(QString::fromUtf8("D")) == 0, qPrintable(QString::fromUtf8("incorrect player name 3")));
-    QVERIFY2(mw.ui->names[4]->text().compare(QString::fromUtf8("E")) == 0, qPrintable(QString::fromUtf8("incorrect player name 4")));
-    QVERIFY2(mw.ui->names[5]->text().compare(QString::fromUtf8("F")) == 0, qPrintable(QString::fromUtf8("incorrect player name 5")));
+    QVERIFY2(StandingsText(mw, 0, StandingsTableModel::Name).compare(QString::fromUtf8("A")) == 0, qPrintable(QString::fromUtf8("incorrect player name 0")));
+    QVERIFY2(StandingsText(mw, 1, StandingsTableModel::Name).compare(QString::fromUtf8("B")) == 0, qPrintable(QString::fromUtf8("incorrect player name 1")));
+    QVERIFY2(StandingsText(mw, 2, StandingsTableModel::Name).compare(QString::fromUtf8("C")) == 0, qPrintable(QString::fromUtf8("incorrect player name 2")));
+    QVERIFY2(StandingsText(mw, 3, StandingsTableModel::Name).compare(QString::fromUtf8("D")) == 0, qPrintable(QString::fromUtf8("incorrect player name 3")));
+    QVERIFY2(StandingsText(mw, 4, StandingsTableModel::Name).compare(QString::fromUtf8("E")) == 0, qPrintable(QString::fromUtf8("incorrect player name 4")));
+    QVERIFY2(StandingsText(mw, 5, StandingsTableModel::Name).compare(QString::fromUtf8("F")) == 0, qPrintable(QString::fromUtf8("incorrect player name 5")));
 
-    QVERIFY2(mw.ui->actuals[0]->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 0")));
-    QVERIFY2(mw.ui->actuals[1]->isEnabled() == false, qPrintable(QString::fromUtf8("incorrect state actuals 1")));
-    QVERIFY2(mw.ui->actuals[2]->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 2")));
-    QVERIFY2(mw.ui->actuals[3]->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 3")));
-    QVERIFY2(mw.ui->actuals[4]->isEnabled() == false, qPrintable(QString::fromUtf8("incorrect state actuals 4")));
-    QVERIFY2(mw.ui->actuals[5]->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 5")));
+    QVERIFY2(Input(mw, 0)->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 0")));
+    QVERIFY2(Input(mw, 1)->isEnabled() == false, qPrintable(QString::fromUtf8("incorrect state actuals 1")));
+    QVERIFY2(Input(mw, 2)->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 2")));
+    QVERIFY2(Input(mw, 3)->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 3")));
+    QVERIFY2(Input(mw, 4)->isEnabled() == false, qPrintable(QString::fromUtf8("incorrect state actuals 4")));
+    QVERIFY2(Input(mw, 5)->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 5")));
 
     QVERIFY2(mw.ui->remainingGamesInRound->text().compare(QString::fromUtf8("4 Spiele in Runde")) == 0, qPrintable(QString::fromUtf8("incorrect remaining games in round")));
 
-    QVERIFY2(mw.ui->scores[0]->text().compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("incorrect scores 0")));
-    QVERIFY2(mw.ui->scores[1]->text().compare(QString::fromUtf8("4")) == 0, qPrintable(QString::fromUtf8("incorrect scores 1")));
-    QVERIFY2(mw.ui->scores[2]->text().compare(QString::fromUtf8("-6")) == 0, qPrintable(QString::fromUtf8("incorrect scores 2")));
-    QVERIFY2(mw.ui->scores[3]->text().compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("incorrect scores 3")));
-    QVERIFY2(mw.ui->scores[4]->text().compare(QString::fromUtf8("-8")) == 0, qPrintable(QString::fromUtf8("incorrect scores 4")));
-    QVERIFY2(mw.ui->scores[5]->text().compare(QString::fromUtf8("6")) == 0, qPrintable(QString::fromUtf8("incorrect scores 5")));
-
-    QVERIFY2(mw.ui->lastGames[0]->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect last games 0")));
-    QVERIFY2(mw.ui->lastGames[1]->text().compare(QString::fromUtf8("6")) == 0, qPrintable(QString::fromUtf8("incorrect last games 1")));
-    QVERIFY2(mw.ui->lastGames[2]->text().compare(QString::fromUtf8("-6")) == 0, qPrintable(QString::fromUtf8("incorrect last games 2")));
-    QVERIFY2(mw.ui->lastGames[3]->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect last games 3")));
-    QVERIFY2(mw.ui->lastGames[4]->text().compare(QString::fromUtf8("-6")) == 0, qPrintable(QString::fromUtf8("incorrect last games 4")));
-    QVERIFY2(mw.ui->lastGames[5]->text().compare(QString::fromUtf8("6")) == 0, qPrintable(QString::fromUtf8("incorrect last games 5")));
-
-    QVERIFY2(mw.ui->actuals[0]->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 0 not empty")));
-    QVERIFY2(mw.ui->actuals[1]->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 1 not empty")));
-    QVERIFY2(mw.ui->actuals[2]->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 2 not empty")));
-    QVERIFY2(mw.ui->actuals[3]->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 3 not empty")));
-    QVERIFY2(mw.ui->actuals[4]->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 4 not empty")));
-    QVERIFY2(mw.ui->actuals[5]->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 5 not empty")));
+    QVERIFY2(StandingsText(mw, 0, StandingsTableModel::Score).compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("incorrect scores 0")));
+    QVERIFY2(StandingsText(mw, 1, StandingsTableModel::Score).compare(QString::fromUtf8("4")) == 0, qPrintable(QString::fromUtf8("incorrect scores 1")));
+    QVERIFY2(StandingsText(mw, 2, StandingsTableModel::Score).compare(QString::fromUtf8("-6")) == 0, qPrintable(QString::fromUtf8("incorrect scores 2")));
+    QVERIFY2(StandingsText(mw, 3, StandingsTableModel::Score).compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("incorrect scores 3")));
+    QVERIFY2(StandingsText(mw, 4, StandingsTableModel::Score).compare(QString::fromUtf8("-8")) == 0, qPrintable(QString::fromUtf8("incorrect scores 4")));
+    QVERIFY2(StandingsText(mw, 5, StandingsTableModel::Score).compare(QString::fromUtf8("6")) == 0, qPrintable(QString::fromUtf8("incorrect scores 5")));
+
+    QVERIFY2(StandingsText(mw, 0, StandingsTableModel::LastGame).compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect last games 0")));
+    QVERIFY2(StandingsText(mw, 1, StandingsTableModel::LastGame).compare(QString::fromUtf8("6")) == 0, qPrintable(QString::fromUtf8("incorrect last games 1")));
+    QVERIFY2(StandingsText(mw, 2, StandingsTableModel::LastGame).compare(QString::fromUtf8("-6")) == 0, qPrintable(QString::fromUtf8("incorrect last games 2")));
+    QVERIFY2(StandingsText(mw, 3, StandingsTableModel::LastGame).compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect last games 3")));
+    QVERIFY2(StandingsText(mw, 4, StandingsTableModel::LastGame).compare(QString::fromUtf8("-6")) == 0, qPrintable(QString::fromUtf8("incorrect last games 4")));
+    QVERIFY2(StandingsText(mw, 5, StandingsTableModel::LastGame).compare(QString::fromUtf8("6")) == 0, qPrintable(QString::fromUtf8("incorrect last games 5")));
+
+    QVERIFY2(Input(mw, 0)->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 0 not empty")));
+    QVERIFY2(Input(mw, 1)->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 1 not empty")));
+    QVERIFY2(Input(mw, 2)->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 2 not empty")));
+    QVERIFY2(Input(mw, 3)->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 3 not empty")));
+    QVERIFY2(Input(mw, 4)->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 4 not empty")));
+    QVERIFY2(Input(mw, 5)->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 5 not empty")));
 
     QVERIFY2(mw.ui->spinBox->value() == 0, qPrintable(QString::fromUtf8("events spinbox not set to zero")));
 
-    QVERIFY2(mw.ui->cashs[0]->text().compare(QString::fromUtf8("0,02")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 0")));
-    QVERIFY2(mw.ui->cashs[1]->text().compare(QString::fromUtf8("0,01")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 1")));
-    QVERIFY2(mw.ui->cashs[2]->text().compare(QString::fromUtf8("0,06")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 2")));
-    QVERIFY2(mw.ui->cashs[3]->text().compare(QString::fromUtf8("0,02")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 3")));
-    QVERIFY2(mw.ui->cashs[4]->text().compare(QString::fromUtf8("0,07")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 4")));
-    QVERIFY2(mw.ui->cashs[5]->text().compare(QString::fromUtf8("0,00")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 5")));
+    QVERIFY2(StandingsText(mw, 0, StandingsTableModel::Cash).compare(QString::fromUtf8("0,02")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 0")));
+    QVERIFY2(StandingsText(mw, 1, StandingsTableModel::Cash).compare(QString::fromUtf8("0,01")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 1")));
+    QVERIFY2(StandingsText(mw, 2, StandingsTableModel::Cash).compare(QString::fromUtf8("0,06")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 2")));
+    QVERIFY2(StandingsText(mw, 3, StandingsTableModel::Cash).compare(QString::fromUtf8("0,02")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 3")));
+    QVERIFY2(StandingsText(mw, 4, StandingsTableModel::Cash).compare(QString::fromUtf8("0,07")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 4")));
+    QVERIFY2(StandingsText(mw, 5, StandingsTableModel::Cash).compare(QString::fromUtf8("0,00")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 5")));
 
     QVERIFY2(mw.ui->totalCash->text().compare(QString::fromUtf8("0,24 (inkl. 0,03 pro Abwesender)")) == 0, qPrintable(QString::fromUtf8("incorrect totalCash")));
 
@@ -724,51 +608,51 @@ void FrontendTest::TwoCommittedAndTwoPoppedGameShallBeDisplayed() //NOLINT(googl
     QTest::mouseClick(mw.ui->resetButton, Qt::LeftButton);
     bool isEnabled4 = mw.ui->resetButton->isEnabled();
 
-    QVERIFY2(mw.ui->names[0]->styleSheet().compare(ExpectedStandardNamesStyleSheet) == 0, qPrintable(QString::fromUtf8("incorrect dealer state name 0")));
-    QVERIFY2(mw.ui->names[1]->styleSheet().compare(ExpectedStandardNamesStyleSheet) == 0, qPrintable(QString::fromUtf8("incorrect dealer state name 1")));
-    QVERIFY2(mw.ui->names[2]->styleSheet().compare(ExpectedStandardNamesStyleSheet) == 0, qPrintable(QString::fromUtf8("incorrect dealer state name 2")));
-    QVERIFY2(mw.ui->names[3]->styleSheet().compare(ExpectedDealerNamesStyleSheet) == 0, qPrintable(QString::fromUtf8("incorrect dealer state name 3")));
-    QVERIFY2(mw.ui->names[4]->styleSheet().compare(ExpectedStandardNamesStyleSheet) == 0, qPrintable(QString::fromUtf8("incorrect dealer state name 4")));
-    QVERIFY2(mw.ui->names[5]->styleSheet().compare(ExpectedStandardNamesStyleSheet) == 0, qPrintable(QString::fromUtf8("incorrect dealer state name 5")));
+    QVERIFY2(!IsDealer(mw, 0), qPrintable(QString::fromUtf8("incorrect dealer state name 0")));
+    QVERIFY2(!IsDealer(mw, 1), qPrintable(QString::fromUtf8("incorrect dealer state name 1")));
+    QVERIFY2(!IsDealer(mw, 2), qPrintable(QString::fromUtf8("incorrect dealer state name 2")));
+    QVERIFY2(IsDealer(mw, 3), qPrintable(QString::fromUtf8("incorrect dealer state name 3")));
+    QVERIFY2(!IsDealer(mw, 4), qPrintable(QString::fromUtf8("incorrect dealer state name 4")));
+    QVERIFY2(!IsDealer(mw, 5), qPrintable(QString::fromUtf8("incorrect dealer state name 5")));
 
-    QVERIFY2(mw.ui->actuals[0]->isEnabled() == false, qPrintable(QString::fromUtf8("incorrect state actuals 0")));
-    QVERIFY2(mw.ui->actuals[1]->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 1")));
-    QVERIFY2(mw.ui->actuals[2]->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 2")));
-    QVERIFY2(mw.ui->actuals[3]->isEnabled() == false, qPrintable(QString::fromUtf8("incorrect state actuals 3")));
-    QVERIFY2(mw.ui->actuals[4]->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 4")));
-    QVERIFY2(mw.ui->actuals[5]->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 5")));
+    QVERIFY2(Input(mw, 0)->isEnabled() == false, qPrintable(QString::fromUtf8("incorrect state actuals 0")));
+    QVERIFY2(Input(mw, 1)->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 1")));
+    QVERIFY2(Input(mw, 2)->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 2")));
+    QVERIFY2(Input(mw, 3)->isEnabled() == false, qPrintable(QString::fromUtf8("incorrect state actuals 3")));
+    QVERIFY2(Input(mw, 4)->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 4")));
+    QVERIFY2(Input(mw, 5)->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 5")));
 
     QVERIFY2(mw.ui->remainingGamesInRound->text().compare(QString::fromUtf8("5 Spiele in Runde")) == 0, qPrintable(QString::fromUtf8("incorrect remaining games in round")));
 
-    QVERIFY2(mw.ui->scores[0]->text().compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("incorrect scores 0")));
-    QVERIFY2(mw.ui->scores[1]->text().compare(QString::fromUtf8("-2")) == 0, qPrintable(QString::fromUtf8("incorrect scores 1")));
-    QVERIFY2(mw.ui->scores[2]->text().compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect scores 2")));
-    QVERIFY2(mw.ui->scores[3]->text().compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("incorrect scores 3")));
-    QVERIFY2(mw.ui->scores[4]->text().compare(QString::fromUtf8("-2")) == 0, qPrintable(QString::fromUtf8("incorrect scores 4")));
-    QVERIFY2(mw.ui->scores[5]->text().compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect scores 5")));
-
-    QVERIFY2(mw.ui->lastGames[0]->text().compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("incorrect last games 0")));
-    QVERIFY2(mw.ui->lastGames[1]->text().compare(QString::fromUtf8("-2")) == 0, qPrintable(QString::fromUtf8("incorrect last games 1")));
-    QVERIFY2(mw.ui->lastGames[2]->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect last games 2")));
-    QVERIFY2(mw.ui->lastGames[3]->text().compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("incorrect last games 3")));
-    QVERIFY2(mw.ui->lastGames[4]->text().compare(QString::fromUtf8("-2")) == 0, qPrintable(QString::fromUtf8("incorrect last games 4")));
-    QVERIFY2(mw.ui->lastGames[5]->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect last games 5")));
-
-    QVERIFY2(mw.ui->actuals[0]->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 0 not empty")));
-    QVERIFY2(mw.ui->actuals[1]->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 1 not empty")));
-    QVERIFY2(mw.ui->actuals[4]->text().compare(QString::fromUtf8("-3")) == 0, qPrintable(QString::fromUtf8("actuals 2 wrong content")));
-    QVERIFY2(mw.ui->actuals[3]->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 3 not empty")));
-    QVERIFY2(mw.ui->actuals[4]->text().compare(QString::fromUtf8("-3")) == 0, qPrintable(QString::fromUtf8("actuals 4 wrong content")));
-    QVERIFY2(mw.ui->actuals[5]->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 5 not empty")));
+    QVERIFY2(StandingsText(mw, 0, StandingsTableModel::Score).compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("incorrect scores 0")));
+    QVERIFY2(StandingsText(mw, 1, StandingsTableModel::Score).compare(QString::fromUtf8("-2")) == 0, qPrintable(QString::fromUtf8("incorrect scores 1")));
+    QVERIFY2(StandingsText(mw, 2, StandingsTableModel::Score).compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect scores 2")));
+    QVERIFY2(StandingsText(mw, 3, StandingsTableModel::Score).compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("incorrect scores 3")));
+    QVERIFY2(StandingsText(mw, 4, StandingsTableModel::Score).compare(QString::fromUtf8("-2")) == 0, qPrintable(QString::fromUtf8("incorrect scores 4")));
+    QVERIFY2(StandingsText(mw, 5, StandingsTableModel::Score).compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect scores 5")));
+
+    QVERIFY2(StandingsText(mw, 0, StandingsTableModel::LastGame).compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("incorrect last games 0")));
+    QVERIFY2(StandingsText(mw, 1, StandingsTableModel::LastGame).compare(QString::fromUtf8("-2")) == 0, qPrintable(QString::fromUtf8("incorrect last games 1")));
+    QVERIFY2(StandingsText(mw, 2, StandingsTableModel::LastGame).compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect last games 2")));
+    QVERIFY2(StandingsText(mw, 3, StandingsTableModel::LastGame).compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("incorrect last games 3")));
+    QVERIFY2(StandingsText(mw, 4, StandingsTableModel::LastGame).compare(QString::fromUtf8("-2")) == 0, qPrintable(QString::fromUtf8("incorrect last games 4")));
+    QVERIFY2(StandingsText(mw, 5, StandingsTableModel::LastGame).compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect last games 5")));
+
+    QVERIFY2(Input(mw, 0)->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 0 not empty")));
+    QVERIFY2(Input(mw, 1)->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 1 not empty")));
+    QVERIFY2(Input(mw, 4)->text().compare(QString::fromUtf8("-3")) == 0, qPrintable(QString::fromUtf8("actuals 2 wrong content")));
+    QVERIFY2(Input(mw, 3)->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 3 not empty")));
+    QVERIFY2(Input(mw, 4)->text().compare(QString::fromUtf8("-3")) == 0, qPrintable(QString::fromUtf8("actuals 4 wrong content")));
+    QVERIFY2(Input(mw, 5)->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 5 not empty")));
 
     QVERIFY2(mw.ui->spinBox->value() == 2, qPrintable(QString::fromUtf8("events spinbox not set to correct value")));
 
-    QVERIFY2(mw.ui->cashs[0]->text().compare(QString::fromUtf8("0,00")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 0")));
-    QVERIFY2(mw.ui->cashs[1]->text().compare(QString::fromUtf8("0,02")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 1")));
-    QVERIFY2(mw.ui->cashs[2]->text().compare(QString::fromUtf8("0,01")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 2")));
-    QVERIFY2(mw.ui->cashs[3]->text().compare(QString::fromUtf8("0,00")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 3")));
-    QVERIFY2(mw.ui->cashs[4]->text().compare(QString::fromUtf8("0,02")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 4")));
-    QVERIFY2(mw.ui->cashs[5]->text().compare(QString::fromUtf8("0,01")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 5")));
+    QVERIFY2(StandingsText(mw, 0, StandingsTableModel::Cash).compare(QString::fromUtf8("0,00")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 0")));
+    QVERIFY2(StandingsText(mw, 1, StandingsTableModel::Cash).compare(QString::fromUtf8("0,02")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 1")));
+    QVERIFY2(StandingsText(mw, 2, StandingsTableModel::Cash).compare(QString::fromUtf8("0,01")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 2")));
+    QVERIFY2(StandingsText(mw, 3, StandingsTableModel::Cash).compare(QString::fromUtf8("0,00")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 3")));
+    QVERIFY2(StandingsText(mw, 4, StandingsTableModel::Cash).compare(QString::fromUtf8("0,02")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 4")));
+    QVERIFY2(StandingsText(mw, 5, StandingsTableModel::Cash).compare(QString::fromUtf8("0,01")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 5")));
 
     QVERIFY2(mw.ui->totalCash->text().compare(QString::fromUtf8("0,08 (inkl. 0,01 pro Abwesender)")) == 0, qPrintable(QString::fromUtf8("incorrect totalCash")));
 
@@ -782,51 +666,51 @@ void FrontendTest::TwoCommittedAndTwoPoppedGameShallBeDisplayed() //NOLINT(googl
     QTest::mouseClick(mw.ui->resetButton, Qt::LeftButton);
     bool isEnabled5 = mw.ui->resetButton->isEnabled();
 
-    QVERIFY2(mw.ui->names[0]->styleSheet().compare(ExpectedStandardNamesStyleSheet) == 0, qPrintable(QString::fromUtf8("incorrect dealer state name 0")));
-    QVERIFY2(mw.ui->names[1]->styleSheet().compare(ExpectedStandardNamesStyleSheet) == 0, qPrintable(QString::fromUtf8("incorrect dealer state name 1")));
-    QVERIFY2(mw.ui->names[2]->styleSheet().compare(ExpectedDealerNamesStyleSheet) == 0, qPrintable(QString::fromUtf8("incorrect dealer state name 2")));
-    QVERIFY2(mw.ui->names[3]->styleSheet().compare(ExpectedStandardNamesStyleSheet) == 0, qPrintable(QString::fromUtf8("incorrect dealer state name 3")));
-    QVERIFY2(mw.ui->names[4]->styleSheet().compare(ExpectedStandardNamesStyleSheet) == 0, qPrintable(QString::fromUtf8("incorrect dealer state name 4")));
-    QVERIFY2(mw.ui->names[5]->styleSheet().compare(ExpectedStandardNamesStyleSheet) == 0, qPrintable(QString::fromUtf8("incorrect dealer state name 5")));
+    QVERIFY2(!IsDealer(mw, 0), qPrintable(QString::fromUtf8("incorrect dealer state name 0")));
+    QVERIFY2(!IsDealer(mw, 1), qPrintable(QString::fromUtf8("incorrect dealer state name 1")));
+    QVERIFY2(IsDealer(mw, 2), qPrintable(QString::fromUtf8("incorrect dealer state name 2")));
+    QVERIFY2(!IsDealer(mw, 3), qPrintable(QString::fromUtf8("incorrect dealer state name 3")));
+    QVERIFY2(!IsDealer(mw, 4), qPrintable(QString::fromUtf8("incorrect dealer state name 4")));
+    QVERIFY2(!IsDealer(mw, 5), qPrintable(QString::fromUtf8("incorrect dealer state name 5")));
 
-    QVERIFY2(mw.ui->actuals[0]->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 0")));
-    QVERIFY2(mw.ui->actuals[1]->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 1")));
-    QVERIFY2(mw.ui->actuals[2]->isEnabled() == false, qPrintable(QString::fromUtf8("incorrect state actuals 2")));
-    QVERIFY2(mw.ui->actuals[3]->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 3")));
-    QVERIFY2(mw.ui->actuals[4]->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 4")));
-    QVERIFY2(mw.ui->actuals[5]->isEnabled() == false, qPrintable(QString::fromUtf8("incorrect state actuals 5")));
+    QVERIFY2(Input(mw, 0)->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 0")));
+    QVERIFY2(Input(mw, 1)->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 1")));
+    QVERIFY2(Input(mw, 2)->isEnabled() == false, qPrintable(QString::fromUtf8("incorrect state actuals 2")));
+    QVERIFY2(Input(mw, 3)->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 3")));
+    QVERIFY2(Input(mw, 4)->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 4")));
+    QVERIFY2(Input(mw, 5)->isEnabled() == false, qPrintable(QString::fromUtf8("incorrect state actuals 5")));
 
     QVERIFY2(mw.ui->remainingGamesInRound->text().compare(QString::fromUtf8("Neue Runde")) == 0, qPrintable(QString::fromUtf8("incorrect remaining games in round")));
 
-    QVERIFY2(mw.ui->scores[0]->text().compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect scores 0")));
-    QVERIFY2(mw.ui->scores[1]->text().compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect scores 1")));
-    QVERIFY2(mw.ui->scores[2]->text().compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect scores 2")));
-    QVERIFY2(mw.ui->scores[3]->text().compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect scores 3")));
-    QVERIFY2(mw.ui->scores[4]->text().compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect scores 4")));
-    QVERIFY2(mw.ui->scores[5]->text().compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect scores 5")));
-
-    QVERIFY2(mw.ui->lastGames[0]->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect last games 0")));
-    QVERIFY2(mw.ui->lastGames[1]->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect last games 1")));
-    QVERIFY2(mw.ui->lastGames[2]->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect last games 2")));
-    QVERIFY2(mw.ui->lastGames[3]->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect last games 3")));
-    QVERIFY2(mw.ui->lastGames[4]->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect last games 4")));
-    QVERIFY2(mw.ui->lastGames[5]->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect last games 5")));
-
-    QVERIFY2(mw.ui->actuals[0]->text().compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("actuals 0 wrong content")));
-    QVERIFY2(mw.ui->actuals[1]->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 1 not empty")));
-    QVERIFY2(mw.ui->actuals[2]->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 2 not empty")));
-    QVERIFY2(mw.ui->actuals[3]->text().compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("actuals 3 wrong content")));
-    QVERIFY2(mw.ui->actuals[4]->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 4 not empty")));
-    QVERIFY2(mw.ui->actuals[5]->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 5 not empty")));
+    QVERIFY2(StandingsText(mw, 0, StandingsTableModel::Score).compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect scores 0")));
+    QVERIFY2(StandingsText(mw, 1, StandingsTableModel::Score).compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect scores 1")));
+    QVERIFY2(StandingsText(mw, 2, StandingsTableModel::Score).compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect scores 2")));
+    QVERIFY2(StandingsText(mw, 3, StandingsTableModel::Score).compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect scores 3")));
+    QVERIFY2(StandingsText(mw, 4, StandingsTableModel::Score).compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect scores 4")));
+    QVERIFY2(StandingsText(mw, 5, StandingsTableModel::Score).compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect scores 5")));
+
+    QVERIFY2(StandingsText(mw, 0, StandingsTableModel::LastGame).compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect last games 0")));
+    QVERIFY2(StandingsText(mw, 1, StandingsTableModel::LastGame).compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect last games 1")));
+    QVERIFY2(StandingsText(mw, 2, StandingsTableModel::LastGame).compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect last games 2")));
+    QVERIFY2(StandingsText(mw, 3, StandingsTableModel::LastGame).compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect last games 3")));
+    QVERIFY2(StandingsText(mw, 4, StandingsTableModel::LastGame).compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect last games 4")));
+    QVERIFY2(StandingsText(mw, 5, StandingsTableModel::LastGame).compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect last games 5")));
+
+    QVERIFY2(Input(mw, 0)->text().compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("actuals 0 wrong content")));
+    QVERIFY2(Input(mw, 1)->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 1 not empty")));
+    QVERIFY2(Input(mw, 2)->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 2 not empty")));
+    QVERIFY2(Input(mw, 3)->text().compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("actuals 3 wrong content")));
+    QVERIFY2(Input(mw, 4)->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 4 not empty")));
+    QVERIFY2(Input(mw, 5)->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 5 not empty")));
 
     QVERIFY2(mw.ui->spinBox->value() == 1, qPrintable(QString::fromUtf8("events spinbox not set to correct value")));
 
-    QVERIFY2(mw.ui->cashs[0]->text().compare(QString::fromUtf8("0,00")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 0")));
-    QVERIFY2(mw.ui->cashs[1]->text().compare(QString::fromUtf8("0,00")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 1")));
-    QVERIFY2(mw.ui->cashs[2]->text().compare(QString::fromUtf8("0,00")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 2")));
-    QVERIFY2(mw.ui->cashs[3]->text().compare(QString::fromUtf8("0,00")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 3")));
-    QVERIFY2(mw.ui->cashs[4]->text().compare(QString::fromUtf8("0,00")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 4")));
-    QVERIFY2(mw.ui->cashs[5]->text().compare(QString::fromUtf8("0,00")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 5")));
+    QVERIFY2(StandingsText(mw, 0, StandingsTableModel::Cash).compare(QString::fromUtf8("0,00")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 0")));
+    QVERIFY2(StandingsText(mw, 1, StandingsTableModel::Cash).compare(QString::fromUtf8("0,00")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 1")));
+    QVERIFY2(StandingsText(mw, 2, StandingsTableModel::Cash).compare(QString::fromUtf8("0,00")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 2")));
+    QVERIFY2(StandingsText(mw, 3, StandingsTableModel::Cash).compare(QString::fromUtf8("0,00")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 3")));
+    QVERIFY2(StandingsText(mw, 4, StandingsTableModel::Cash).compare(QString::fromUtf8("0,00")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 4")));
+    QVERIFY2(StandingsText(mw, 5, StandingsTableModel::Cash).compare(QString::fromUtf8("0,00")) == 0, qPrintable(QString::fromUtf8("incorrect cashs 5")));
 
     QVERIFY2(mw.ui->totalCash->text().compare(QString::fromUtf8("0,00 (inkl. 0,00 pro Abwesender)")) == 0, qPrintable(QString::fromUtf8("incorrect totalCash")));
 
@@ -867,8 +751,8 @@ void FrontendTest::AllLevelsOfMultipliersShallCorrectlyBeDisplayed() const
     QVERIFY2(mw.ui->doubleMultiplier->text().compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("double multiplier label incorrect")));
     QVERIFY2(mw.ui->singleMultiplier->text().compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("single multiplier label incorrect")));
 
-    mw.ui->actuals[0]->setText(QString::fromUtf8("2"));
-    mw.ui->actuals[3]->setText(QString::fromUtf8("2"));
+    Input(mw, 0)->setText(QString::fromUtf8("2"));
+    Input(mw, 3)->setText(QString::fromUtf8("2"));
     mw.ui->spinBox->setValue(1);
 
     QTest::mouseClick(mw.ui->commitButton, Qt::LeftButton);
@@ -878,8 +762,8 @@ void FrontendTest::AllLevelsOfMultipliersShallCorrectlyBeDisplayed() const
     QVERIFY2(mw.ui->doubleMultiplier->text().compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("double multiplier label incorrect")));
     QVERIFY2(mw.ui->singleMultiplier->text().compare(QString::fromUtf8("5")) == 0, qPrintable(QString::fromUtf8("single multiplier label incorrect")));
 
-    mw.ui->actuals[2]->setText(QString::fromUtf8("-3"));
-    mw.ui->actuals[4]->setText(QString::fromUtf8("-3"));
+    Input(mw, 2)->setText(QString::fromUtf8("-3"));
+    Input(mw, 4)->setText(QString::fromUtf8("-3"));
     mw.ui->spinBox->setValue(1);
 
     QTest::mouseClick(mw.ui->commitButton, Qt::LeftButton);
@@ -889,8 +773,8 @@ void FrontendTest::AllLevelsOfMultipliersShallCorrectlyBeDisplayed() const
     QVERIFY2(mw.ui->doubleMultiplier->text().compare(QString::fromUtf8("4")) == 0, qPrintable(QString::fromUtf8("double multiplier label incorrect")));
     QVERIFY2(mw.ui->singleMultiplier->text().compare(QString::fromUtf8("1")) == 0, qPrintable(QString::fromUtf8("single multiplier label incorrect")));
 
-    mw.ui->actuals[2]->setText(QString::fromUtf8("-3"));
-    mw.ui->actuals[4]->setText(QString::fromUtf8("-3"));
+    Input(mw, 2)->setText(QString::fromUtf8("-3"));
+    Input(mw, 4)->setText(QString::fromUtf8("-3"));
     mw.ui->spinBox->setValue(1);
 
     QTest::mouseClick(mw.ui->commitButton, Qt::LeftButton);
@@ -924,99 +808,120 @@ void FrontendTest::StatisticsShallCorrectlyBeDisplayed() const
     mw.UpdateDisplay();
 
     // Act
-    mw.ui->actuals[1]->setText(QString::fromUtf8("-1"));
-    mw.ui->actuals[2]->setText(QString::fromUtf8("-1"));
-    mw.ui->actuals[3]->setText(QString::fromUtf8("1"));
-    mw.ui->actuals[4]->setText(QString::fromUtf8("1"));
+    Input(mw, 1)->setText(QString::fromUtf8("-1"));
+    Input(mw, 2)->setText(QString::fromUtf8("-1"));
+    Input(mw, 3)->setText(QString::fromUtf8("1"));
+    Input(mw, 4)->setText(QString::fromUtf8("1"));
     QTest::mouseClick(mw.ui->commitButton, Qt::LeftButton);
 
-    mw.ui->actuals[0]->setText(QString::fromUtf8("3"));
-    mw.ui->actuals[2]->setText(QString::fromUtf8("-1"));
-    mw.ui->actuals[3]->setText(QString::fromUtf8("-1"));
-    mw.ui->actuals[4]->setText(QString::fromUtf8("-1"));
+    Input(mw, 0)->setText(QString::fromUtf8("3"));
+    Input(mw, 2)->setText(QString::fromUtf8("-1"));
+    Input(mw, 3)->setText(QString::fromUtf8("-1"));
+    Input(mw, 4)->setText(QString::fromUtf8("-1"));
     mw.ui->spinBox->setValue(1);
     QTest::mouseClick(mw.ui->commitButton, Qt::LeftButton);
 
-    mw.ui->actuals[0]->setText(QString::fromUtf8("2"));
-    mw.ui->actuals[1]->setText(QString::fromUtf8("2"));
-    mw.ui->actuals[3]->setText(QString::fromUtf8("2"));
-    mw.ui->actuals[4]->setText(QString::fromUtf8("-6"));
+    Input(mw, 0)->setText(QString::fromUtf8("2"));
+    Input(mw, 1)->setText(QString::fromUtf8("2"));
+    Input(mw, 3)->setText(QString::fromUtf8("2"));
+    Input(mw, 4)->setText(QString::fromUtf8("-6"));
     QTest::mouseClick(mw.ui->commitButton, Qt::LeftButton);
 
-    mw.ui->actuals[0]->setText(QString::fromUtf8("3"));
-    mw.ui->actuals[1]->setText(QString::fromUtf8("-3"));
-    mw.ui->actuals[2]->setText(QString::fromUtf8("3"));
-    mw.ui->actuals[4]->setText(QString::fromUtf8("-3"));
+    Input(mw, 0)->setText(QString::fromUtf8("3"));
+    Input(mw, 1)->setText(QString::fromUtf8("-3"));
+    Input(mw, 2)->setText(QString::fromUtf8("3"));
+    Input(mw, 4)->setText(QString::fromUtf8("-3"));
     QTest::mouseClick(mw.ui->commitButton, Qt::LeftButton);
 
     // Assert
-    QVERIFY2(mw.ui->names[0]->text().compare(QString::fromUtf8("A")) == 0, qPrintable(QString::fromUtf8("incorrect player name 0")));
-    QVERIFY2(mw.ui->names[1]->text().compare(QString::fromUtf8("B")) == 0, qPrintable(QString::fromUtf8("incorrect player name 1")));
-    QVERIFY2(mw.ui->names[2]->text().compare(QString::fromUtf8("C")) == 0, qPrintable(QString::fromUtf8("incorrect player name 2")));
-    QVERIFY2(mw.ui->names[3]->text().compare(QString::fromUtf8("D")) == 0, qPrintable(QString::fromUtf8("incorrect player name 3")));
-    QVERIFY2(mw.ui->names[4]->text().compare(QString::fromUtf8("E")) == 0, qPrintable(QString::fromUtf8("incorrect player name 4")));
+    auto statistic = [&mw](int row, StatisticsTableModel::Column column){ return mw.statisticsModel->index(row, column).data().toString(); };
+
+    QVERIFY2(mw.statisticsModel->rowCount() == 5, qPrintable(QString::fromUtf8("incorrect number of statistics rows")));
+    QVERIFY2(statistic(0, StatisticsTableModel::Name).compare(QString::fromUtf8("A")) == 0, qPrintable(QString::fromUtf8("incorrect statistics name 0")));
+    QVERIFY2(statistic(4, StatisticsTableModel::Name).compare(QString::fromUtf8("E")) == 0, qPrintable(QString::fromUtf8("incorrect statistics name 4")));
+
+    QVERIFY2(StandingsText(mw, 0, StandingsTableModel::Name).compare(QString::fromUtf8("A")) == 0, qPrintable(QString::fromUtf8("incorrect player name 0")));
+    QVERIFY2(StandingsText(mw, 1, StandingsTableModel::Name).compare(QString::fromUtf8("B")) == 0, qPrintable(QString::fromUtf8("incorrect player name 1")));
+    QVERIFY2(StandingsText(mw, 2, StandingsTableModel::Name).compare(QString::fromUtf8("C")) == 0, qPrintable(QString::fromUtf8("incorrect player name 2")));
+    QVERIFY2(StandingsText(mw, 3, StandingsTableModel::Name).compare(QString::fromUtf8("D")) == 0, qPrintable(QString::fromUtf8("incorrect player name 3")));
+    QVERIFY2(StandingsText(mw, 4, StandingsTableModel::Name).compare(QString::fromUtf8("E")) == 0, qPrintable(QString::fromUtf8("incorrect player name 4")));
 
     QVERIFY2(mw.ui->remainingGamesInRound->text().compare(QString::fromUtf8("1 Spiel in Runde")) == 0, qPrintable(QString::fromUtf8("incorrect remaining games in round")));
 
-    QVERIFY2(mw.ui->scores[0]->text().compare(QString::fromUtf8("13")) == 0, qPrintable(QString::fromUtf8("incorrect score 0")));
-    QVERIFY2(mw.ui->scores[1]->text().compare(QString::fromUtf8("-3")) == 0, qPrintable(QString::fromUtf8("incorrect score 1")));
-    QVERIFY2(mw.ui->scores[2]->text().compare(QString::fromUtf8("4")) == 0, qPrintable(QString::fromUtf8("incorrect score 2")));
-    QVERIFY2(mw.ui->scores[3]->text().compare(QString::fromUtf8("4")) == 0, qPrintable(QString::fromUtf8("incorrect score 3")));
-    QVERIFY2(mw.ui->scores[4]->text().compare(QString::fromUtf8("-18")) == 0, qPrintable(QString::fromUtf8("incorrect score 4")));
-
-    QVERIFY2(mw.ui->numberWons[0]->text().compare(QString::fromUtf8("3")) == 0, qPrintable(QString::fromUtf8("incorrect number wons 0")));
-    QVERIFY2(mw.ui->numberWons[1]->text().compare(QString::fromUtf8("1")) == 0, qPrintable(QString::fromUtf8("incorrect number wons 1")));
-    QVERIFY2(mw.ui->numberWons[2]->text().compare(QString::fromUtf8("1")) == 0, qPrintable(QString::fromUtf8("incorrect number wons 2")));
-    QVERIFY2(mw.ui->numberWons[3]->text().compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("incorrect number wons 3")));
-    QVERIFY2(mw.ui->numberWons[4]->text().compare(QString::fromUtf8("1")) == 0, qPrintable(QString::fromUtf8("incorrect number wons 4")));
-
-    QVERIFY2(mw.ui->numberLosts[0]->text().compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect number losts 0")));
-    QVERIFY2(mw.ui->numberLosts[1]->text().compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("incorrect number losts 1")));
-    QVERIFY2(mw.ui->numberLosts[2]->text().compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("incorrect number losts 2")));
-    QVERIFY2(mw.ui->numberLosts[3]->text().compare(QString::fromUtf8("1")) == 0, qPrintable(QString::fromUtf8("incorrect number losts 3")));
-    QVERIFY2(mw.ui->numberLosts[4]->text().compare(QString::fromUtf8("3")) == 0, qPrintable(QString::fromUtf8("incorrect number losts 4")));
-
-    QVERIFY2(mw.ui->numberPlayeds[0]->text().compare(QString::fromUtf8("3")) == 0, qPrintable(QString::fromUtf8("incorrect number playeds 0")));
-    QVERIFY2(mw.ui->numberPlayeds[1]->text().compare(QString::fromUtf8("3")) == 0, qPrintable(QString::fromUtf8("incorrect number playeds 1")));
-    QVERIFY2(mw.ui->numberPlayeds[2]->text().compare(QString::fromUtf8("3")) == 0, qPrintable(QString::fromUtf8("incorrect number playeds 2")));
-    QVERIFY2(mw.ui->numberPlayeds[3]->text().compare(QString::fromUtf8("3")) == 0, qPrintable(QString::fromUtf8("incorrect number playeds 3")));
-    QVERIFY2(mw.ui->numberPlayeds[4]->text().compare(QString::fromUtf8("4")) == 0, qPrintable(QString::fromUtf8("incorrect number playeds 4")));
-
-    QVERIFY2(mw.ui->numberSoloWons[0]->text().compare(QString::fromUtf8("1")) == 0, qPrintable(QString::fromUtf8("incorrect number solo wons 0")));
-    QVERIFY2(mw.ui->numberSoloWons[1]->text().compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect number solo wons 1")));
-    QVERIFY2(mw.ui->numberSoloWons[2]->text().compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect number solo wons 2")));
-    QVERIFY2(mw.ui->numberSoloWons[3]->text().compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect number solo wons 3")));
-    QVERIFY2(mw.ui->numberSoloWons[4]->text().compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect number solo wons 4")));
-
-    QVERIFY2(mw.ui->numberSoloLosts[0]->text().compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect number solo losts 0")));
-    QVERIFY2(mw.ui->numberSoloLosts[1]->text().compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect number solo losts 1")));
-    QVERIFY2(mw.ui->numberSoloLosts[2]->text().compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect number solo losts 2")));
-    QVERIFY2(mw.ui->numberSoloLosts[3]->text().compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect number solo losts 3")));
-    QVERIFY2(mw.ui->numberSoloLosts[4]->text().compare(QString::fromUtf8("1")) == 0, qPrintable(QString::fromUtf8("incorrect number solo losts 4")));
-
-    QVERIFY2(mw.ui->pointsSolos[0]->text().compare(QString::fromUtf8("3")) == 0, qPrintable(QString::fromUtf8("incorrect points solos 0")));
-    QVERIFY2(mw.ui->pointsSolos[1]->text().compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect points solos 1")));
-    QVERIFY2(mw.ui->pointsSolos[2]->text().compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect points solos 2")));
-    QVERIFY2(mw.ui->pointsSolos[3]->text().compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect points solos 3")));
-    QVERIFY2(mw.ui->pointsSolos[4]->text().compare(QString::fromUtf8("-12")) == 0, qPrintable(QString::fromUtf8("incorrect points solos 4")));
-
-    QVERIFY2(mw.ui->maxSingleWins[0]->text().compare(QString::fromUtf8("6")) == 0, qPrintable(QString::fromUtf8("incorrect max single win 0")));
-    QVERIFY2(mw.ui->maxSingleWins[1]->text().compare(QString::fromUtf8("4")) == 0, qPrintable(QString::fromUtf8("incorrect max single win 1")));
-    QVERIFY2(mw.ui->maxSingleWins[2]->text().compare(QString::fromUtf8("6")) == 0, qPrintable(QString::fromUtf8("incorrect max single win 2")));
-    QVERIFY2(mw.ui->maxSingleWins[3]->text().compare(QString::fromUtf8("4")) == 0, qPrintable(QString::fromUtf8("incorrect max single win 3")));
-    QVERIFY2(mw.ui->maxSingleWins[4]->text().compare(QString::fromUtf8("1")) == 0, qPrintable(QString::fromUtf8("incorrect max single win 4")));
-
-    QVERIFY2(mw.ui->maxSingleLosss[0]->text().compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect max single loss 0")));
-    QVERIFY2(mw.ui->maxSingleLosss[1]->text().compare(QString::fromUtf8("-6")) == 0, qPrintable(QString::fromUtf8("incorrect max single loss 1")));
-    QVERIFY2(mw.ui->maxSingleLosss[2]->text().compare(QString::fromUtf8("-1")) == 0, qPrintable(QString::fromUtf8("incorrect max single loss 2")));
-    QVERIFY2(mw.ui->maxSingleLosss[3]->text().compare(QString::fromUtf8("-1")) == 0, qPrintable(QString::fromUtf8("incorrect max single loss 3")));
-    QVERIFY2(mw.ui->maxSingleLosss[4]->text().compare(QString::fromUtf8("-12")) == 0, qPrintable(QString::fromUtf8("incorrect max single loss 4")));
-
-    QVERIFY2(mw.ui->unmultipliedScores[0]->text().compare(QString::fromUtf8("8")) == 0, qPrintable(QString::fromUtf8("incorrect unmultiplied scores 0")));
-    QVERIFY2(mw.ui->unmultipliedScores[1]->text().compare(QString::fromUtf8("-2")) == 0, qPrintable(QString::fromUtf8("incorrect unmultiplied scores 1")));
-    QVERIFY2(mw.ui->unmultipliedScores[2]->text().compare(QString::fromUtf8("1")) == 0, qPrintable(QString::fromUtf8("incorrect unmultiplied scores 2")));
-    QVERIFY2(mw.ui->unmultipliedScores[3]->text().compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("incorrect unmultiplied scores 3")));
-    QVERIFY2(mw.ui->unmultipliedScores[4]->text().compare(QString::fromUtf8("-9")) == 0, qPrintable(QString::fromUtf8("incorrect unmultiplied scores 4")));
+    QVERIFY2(StandingsText(mw, 0, StandingsTableModel::Score).compare(QString::fromUtf8("13")) == 0, qPrintable(QString::fromUtf8("incorrect score 0")));
+    QVERIFY2(StandingsText(mw, 1, StandingsTableModel::Score).compare(QString::fromUtf8("-3")) == 0, qPrintable(QString::fromUtf8("incorrect score 1")));
+    QVERIFY2(StandingsText(mw, 2, StandingsTableModel::Score).compare(QString::fromUtf8("4")) == 0, qPrintable(QString::fromUtf8("incorrect score 2")));
+    QVERIFY2(StandingsText(mw, 3, StandingsTableModel::Score).compare(QString::fromUtf8("4")) == 0, qPrintable(QString::fromUtf8("incorrect score 3")));
+    QVERIFY2(StandingsText(mw, 4, StandingsTableModel::Score).compare(QString::fromUtf8("-18")) == 0, qPrintable(QString::fromUtf8("incorrect score 4")));
+
+    QVERIFY2(statistic(0, StatisticsTableModel::Won).compare(QString::fromUtf8("3")) == 0, qPrintable(QString::fromUtf8("incorrect number wons 0")));
+    QVERIFY2(statistic(1, StatisticsTableModel::Won).compare(QString::fromUtf8("1")) == 0, qPrintable(QString::fromUtf8("incorrect number wons 1")));
+    QVERIFY2(statistic(2, StatisticsTableModel::Won).compare(QString::fromUtf8("1")) == 0, qPrintable(QString::fromUtf8("incorrect number wons 2")));
+    QVERIFY2(statistic(3, StatisticsTableModel::Won).compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("incorrect number wons 3")));
+    QVERIFY2(statistic(4, StatisticsTableModel::Won).compare(QString::fromUtf8("1")) == 0, qPrintable(QString::fromUtf8("incorrect number wons 4")));
+
+    QVERIFY2(statistic(0, StatisticsTableModel::Lost).compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect number losts 0")));
+    QVERIFY2(statistic(1, StatisticsTableModel::Lost).compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("incorrect number losts 1")));
+    QVERIFY2(statistic(2, StatisticsTableModel::Lost).compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("incorrect number losts 2")));
+    QVERIFY2(statistic(3, StatisticsTableModel::Lost).compare(QString::fromUtf8("1")) == 0, qPrintable(QString::fromUtf8("incorrect number losts 3")));
+    QVERIFY2(statistic(4, StatisticsTableModel::Lost).compare(QString::fromUtf8("3")) == 0, qPrintable(QString::fromUtf8("incorrect number losts 4")));
+
+    QVERIFY2(statistic(0, StatisticsTableModel::Played).compare(QString::fromUtf8("3")) == 0, qPrintable(QString::fromUtf8("incorrect number playeds 0")));
+    QVERIFY2(statistic(1, StatisticsTableModel::Played).compare(QString::fromUtf8("3")) == 0, qPrintable(QString::fromUtf8("incorrect number playeds 1")));
+    QVERIFY2(statistic(2, StatisticsTableModel::Played).compare(QString::fromUtf8("3")) == 0, qPrintable(QString::fromUtf8("incorrect number playeds 2")));
+    QVERIFY2(statistic(3, StatisticsTableModel::Played).compare(QString::fromUtf8("3")) == 0, qPrintable(QString::fromUtf8("incorrect number playeds 3")));
+    QVERIFY2(statistic(4, StatisticsTableModel::Played).compare(QString::fromUtf8("4")) == 0, qPrintable(QString::fromUtf8("incorrect number playeds 4")));
+
+    QVERIFY2(statistic(0, StatisticsTableModel::SoloWon).compare(QString::fromUtf8("1")) == 0, qPrintable(QString::fromUtf8("incorrect number solo wons 0")));
+    QVERIFY2(statistic(1, StatisticsTableModel::SoloWon).compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect number solo wons 1")));
+    QVERIFY2(statistic(2, StatisticsTableModel::SoloWon).compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect number solo wons 2")));
+    QVERIFY2(statistic(3, StatisticsTableModel::SoloWon).compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect number solo wons 3")));
+    QVERIFY2(statistic(4, StatisticsTableModel::SoloWon).compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect number solo wons 4")));
+
+    QVERIFY2(statistic(0, StatisticsTableModel::SoloLost).compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect number solo losts 0")));
+    QVERIFY2(statistic(1, StatisticsTableModel::SoloLost).compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect number solo losts 1")));
+    QVERIFY2(statistic(2, StatisticsTableModel::SoloLost).compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect number solo losts 2")));
+    QVERIFY2(statistic(3, StatisticsTableModel::SoloLost).compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect number solo losts 3")));
+    QVERIFY2(statistic(4, StatisticsTableModel::SoloLost).compare(QString::fromUtf8("1")) == 0, qPrintable(QString::fromUtf8("incorrect number solo losts 4")));
+
+    QVERIFY2(statistic(0, StatisticsTableModel::SoloPoints).compare(QString::fromUtf8("3")) == 0, qPrintable(QString::fromUtf8("incorrect points solos 0")));
+    QVERIFY2(statistic(1, StatisticsTableModel::SoloPoints).compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect points solos 1")));
+    QVERIFY2(statistic(2, StatisticsTableModel::SoloPoints).compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect points solos 2")));
+    QVERIFY2(statistic(3, StatisticsTableModel::SoloPoints).compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect points solos 3")));
+    QVERIFY2(statistic(4, StatisticsTableModel::SoloPoints).compare(QString::fromUtf8("-12")) == 0, qPrintable(QString::fromUtf8("incorrect points solos 4")));
+
+    QVERIFY2(statistic(0, StatisticsTableModel::MaxSingleWin).compare(QString::fromUtf8("6")) == 0, qPrintable(QString::fromUtf8("incorrect max single win 0")));
+    QVERIFY2(statistic(1, StatisticsTableModel::MaxSingleWin).compare(QString::fromUtf8("4")) == 0, qPrintable(QString::fromUtf8("incorrect max single win 1")));
+    QVERIFY2(statistic(2, StatisticsTableModel::MaxSingleWin).compare(QString::fromUtf8("6")) == 0, qPrintable(QString::fromUtf8("incorrect max single win 2")));
+    QVERIFY2(statistic(3, StatisticsTableModel::MaxSingleWin).compare(QString::fromUtf8("4")) == 0, qPrintable(QString::fromUtf8("incorrect max single win 3")));
+    QVERIFY2(statistic(4, StatisticsTableModel::MaxSingleWin).compare(QString::fromUtf8("1")) == 0, qPrintable(QString::fromUtf8("incorrect max single win 4")));
+
+    QVERIFY2(statistic(0, StatisticsTableModel::MaxSingleLoss).compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect max single loss 0")));
+    QVERIFY2(statistic(1, StatisticsTableModel::MaxSingleLoss).compare(QString::fromUtf8("-6")) == 0, qPrintable(QString::fromUtf8("incorrect max single loss 1")));
+    QVERIFY2(statistic(2, StatisticsTableModel::MaxSingleLoss).compare(QString::fromUtf8("-1")) == 0, qPrintable(QString::fromUtf8("incorrect max single loss 2")));
+    QVERIFY2(statistic(3, StatisticsTableModel::MaxSingleLoss).compare(QString::fromUtf8("-1")) == 0, qPrintable(QString::fromUtf8("incorrect max single loss 3")));
+    QVERIFY2(statistic(4, StatisticsTableModel::MaxSingleLoss).compare(QString::fromUtf8("-12")) == 0, qPrintable(QString::fromUtf8("incorrect max single loss 4")));
+
+    QVERIFY2(statistic(0, StatisticsTableModel::UnmultipliedScore).compare(QString::fromUtf8("8")) == 0, qPrintable(QString::fromUtf8("incorrect unmultiplied scores 0")));
+    QVERIFY2(statistic(1, StatisticsTableModel::UnmultipliedScore).compare(QString::fromUtf8("-2")) == 0, qPrintable(QString::fromUtf8("incorrect unmultiplied scores 1")));
+    QVERIFY2(statistic(2, StatisticsTableModel::UnmultipliedScore).compare(QString::fromUtf8("1")) == 0, qPrintable(QString::fromUtf8("incorrect unmultiplied scores 2")));
+    QVERIFY2(statistic(3, StatisticsTableModel::UnmultipliedScore).compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("incorrect unmultiplied scores 3")));
+    QVERIFY2(statistic(4, StatisticsTableModel::UnmultipliedScore).compare(QString::fromUtf8("-9")) == 0, qPrintable(QString::fromUtf8("incorrect unmultiplied scores 4")));
+
+    // an update without changes signals no cell, and sorting is numerical
+    QSignalSpy dataChangedSpy(mw.statisticsModel, &QAbstractItemModel::dataChanged);
+    QSignalSpy modelResetSpy(mw.statisticsModel, &QAbstractItemModel::modelReset);
+    mw.UpdateDisplay();
+
+    QVERIFY2(dataChangedSpy.count() == 0, qPrintable(QString::fromUtf8("unchanged cells signalled")));
+    QVERIFY2(modelResetSpy.count() == 0, qPrintable(QString::fromUtf8("unchanged model reset")));
+
+    mw.ui->statisticsTable->sortByColumn(StatisticsTableModel::MaxSingleLoss, Qt::AscendingOrder);
+
+    auto sortedName = [&mw](int row){ return mw.statisticsProxyModel->index(row, StatisticsTableModel::Name).data().toString(); };
+    QVERIFY2(sortedName(0).compare(QString::fromUtf8("E")) == 0, qPrintable(QString::fromUtf8("incorrect sorting 0")));
+    QVERIFY2(sortedName(1).compare(QString::fromUtf8("B")) == 0, qPrintable(QString::fromUtf8("incorrect sorting 1")));
+    QVERIFY2(sortedName(4).compare(QString::fromUtf8("A")) == 0, qPrintable(QString::fromUtf8("incorrect sorting 4")));
 }
 
 void FrontendTest::ScoreHistoryPlotShallWorkCorrectly() const
@@ -1042,36 +947,111 @@ void FrontendTest::ScoreHistoryPlotShallWorkCorrectly() const
     mw.UpdateDisplay();
 
     // Act
-    mw.ui->actuals[1]->setText(QString::fromUtf8("-1"));
-    mw.ui->actuals[2]->setText(QString::fromUtf8("-1"));
-    mw.ui->actuals[3]->setText(QString::fromUtf8("1"));
-    mw.ui->actuals[4]->setText(QString::fromUtf8("1"));
+    Input(mw, 1)->setText(QString::fromUtf8("-1"));
+    Input(mw, 2)->setText(QString::fromUtf8("-1"));
+    Input(mw, 3)->setText(QString::fromUtf8("1"));
+    Input(mw, 4)->setText(QString::fromUtf8("1"));
     QTest::mouseClick(mw.ui->commitButton, Qt::LeftButton);
 
-    mw.ui->actuals[0]->setText(QString::fromUtf8("3"));
-    mw.ui->actuals[2]->setText(QString::fromUtf8("-1"));
-    mw.ui->actuals[3]->setText(QString::fromUtf8("-1"));
-    mw.ui->actuals[4]->setText(QString::fromUtf8("-1"));
+    Input(mw, 0)->setText(QString::fromUtf8("3"));
+    Input(mw, 2)->setText(QString::fromUtf8("-1"));
+    Input(mw, 3)->setText(QString::fromUtf8("-1"));
+    Input(mw, 4)->setText(QString::fromUtf8("-1"));
     mw.ui->spinBox->setValue(1);
     QTest::mouseClick(mw.ui->commitButton, Qt::LeftButton);
 
+    auto countVisibleGraphs = [&mw]()
+    {
+        int count = 0;
+        for(int i = 0; i < mw.ui->plotPlayerHistory->graphCount(); ++i)
+        {
+            count += mw.ui->plotPlayerHistory->graph(i)->visible() ? 1 : 0;
+        }
+        return count;
+    };
+
+    auto select = [&mw](int row, bool selected)
+    {
+        mw.historySelectionModel->setData(mw.historySelectionModel->index(row), static_cast<int>(selected ? Qt::Checked : Qt::Unchecked), Qt::CheckStateRole);
+    };
+
+    // Act, Assert
+    QVERIFY2(mw.historySelectionModel->rowCount() == 5, qPrintable(QString::fromUtf8("incorrect number of selectable players")));
+    QVERIFY2(mw.historySelectionModel->index(0).data(Qt::CheckStateRole).toInt() == Qt::Checked, qPrintable(QString::fromUtf8("player not selected initially")));
+    QVERIFY2(mw.ui->plotPlayerHistory->graphCount() == 5, qPrintable(QString::fromUtf8("graphs not created for the players only")));
+    QVERIFY2(countVisibleGraphs() == 5, qPrintable(QString::fromUtf8("incorrect graph count A")));
+
+    QCoreApplication::processEvents();
+    QSignalSpy replotSpy(mw.ui->plotPlayerHistory, &QCustomPlot::afterReplot);
+
+    select(2, false);
+
+    QVERIFY2(countVisibleGraphs() == 4, qPrintable(QString::fromUtf8("incorrect graph count B")));
+
+    select(2, true);
+    select(0, false);
+    select(1, false);
+
+    QVERIFY2(countVisibleGraphs() == 3, qPrintable(QString::fromUtf8("incorrect graph count C")));
+
+    select(0, true);
+    select(1, true);
+
+    QVERIFY2(countVisibleGraphs() == 5, qPrintable(QString::fromUtf8("incorrect graph count D")));
+
+    // the changes of the selection are coalesced into a single replot
+    QVERIFY2(replotSpy.count() == 0, qPrintable(QString::fromUtf8("replotted synchronously")));
+    QCoreApplication::processEvents();
+    QVERIFY2(replotSpy.count() == 1, qPrintable(QString::fromUtf8("incorrect number of replots")));
+
+    // the graphs persist and follow each deal by a single point
+    auto * firstGraph = mw.ui->plotPlayerHistory->graph(0);
+    QVERIFY2(firstGraph->data()->size() == 3, qPrintable(QString::fromUtf8("incorrect number of points A")));
+    QVERIFY2(firstGraph->data()->at(2)->value == mw.gameInfo.PlayerInfosView()[0].CurrentScore(), qPrintable(QString::fromUtf8("incorrect last point A")));
+
+    QTest::mouseClick(mw.ui->resetButton, Qt::LeftButton);
+
+    QVERIFY2(mw.ui->plotPlayerHistory->graph(0) == firstGraph, qPrintable(QString::fromUtf8("graph was recreated")));
+    QVERIFY2(firstGraph->data()->size() == 2, qPrintable(QString::fromUtf8("incorrect number of points B")));
+    QVERIFY2(countVisibleGraphs() == 5, qPrintable(QString::fromUtf8("incorrect graph count E")));
+}
+
+void FrontendTest::ScoreHistoryPlotShallShowWholeSessionDecimated() const
+{
+    // Arrange
+    const unsigned int numberOfDeals = 20000U;
+    MainWindow mw(this->DefaultPlayers, std::make_shared<MemoryRepository>(), false);
+
+    mw.gameInfo.SetPlayers({ "A", "B", "C", "D" }, "A", {});
+    for(unsigned int deal = 0; deal < numberOfDeals; ++deal)
+    {
+        mw.gameInfo.PushDeal({ std::make_pair(std::string(deal % 3 == 0 ? "A" : "B"), 1), std::make_pair(std::string("C"), 1) }, 0U);
+    }
+    mw.UpdateDisplay();
+
+    auto * plot = mw.ui->plotPlayerHistory;
+    auto maximumPoints = std::max(2 * plot->axisRect()->width(), 64);
+
     // Act, Assert
-    QVERIFY2(mw.ui->plotPlayerHistory->graphCount() == 5, qPrintable(QString::fromUtf8("incorrect graph count A")));
+    QVERIFY2(plot->xAxis->range().upper == numberOfDeals, qPrintable(QString::fromUtf8("does not follow the last deals")));
+    QVERIFY2(plot->graph(0)->data()->size() <= 53, qPrintable(QString::fromUtf8("more than the last deals handed to the plot")));
 
-    mw.ui->playerHistorySelectionCheckboxes[2]->setChecked(false);
+    mw.ui->wholeSessionButton->setChecked(true);
 
-    QVERIFY2(mw.ui->plotPlayerHistory->graphCount() == 4, qPrintable(QString::fromUtf8("incorrect graph count B")));
+    QVERIFY2(plot->xAxis->range().lower == 0.0, qPrintable(QString::fromUtf8("incorrect start of whole session")));
+    QVERIFY2(plot->xAxis->range().upper == numberOfDeals, qPrintable(QString::fromUtf8("incorrect end of whole session")));
+    QVERIFY2(plot->graph(0)->data()->size() <= maximumPoints, qPrintable(QString::fromUtf8("whole session not decimated")));
+    QVERIFY2(plot->graph(0)->data()->size() > 0, qPrintable(QString::fromUtf8("whole session empty")));
 
-    mw.ui->playerHistorySelectionCheckboxes[2]->setChecked(true);
-    mw.ui->playerHistorySelectionCheckboxes[0]->setChecked(false);
-    mw.ui->playerHistorySelectionCheckboxes[1]->setChecked(false);
+    // panning beyond the session is limited to it
+    plot->xAxis->setRange(numberOfDeals - 100.0, numberOfDeals + 100.0);
 
-    QVERIFY2(mw.ui->plotPlayerHistory->graphCount() == 3, qPrintable(QString::fromUtf8("incorrect graph count C")));
+    QVERIFY2(plot->xAxis->range().upper == numberOfDeals, qPrintable(QString::fromUtf8("panned beyond the session")));
+    QVERIFY2(plot->xAxis->range().size() == 200.0, qPrintable(QString::fromUtf8("zoom changed by panning")));
 
-    mw.ui->playerHistorySelectionCheckboxes[0]->setChecked(true);
-    mw.ui->playerHistorySelectionCheckboxes[1]->setChecked(true);
+    mw.ui->wholeSessionButton->setChecked(false);
 
-    QVERIFY2(mw.ui->plotPlayerHistory->graphCount() == 5, qPrintable(QString::fromUtf8("incorrect graph count D")));
+    QVERIFY2(plot->xAxis->range().lower == numberOfDeals - 50.0, qPrintable(QString::fromUtf8("does not follow the last deals again")));
 }
 
 void FrontendTest::AboutButtonShallTriggerDialogAndOKShallClose()
@@ -1131,17 +1111,17 @@ void FrontendTest::MandatorySoloButtonShallBeEnabledAndTrigger() const
     QVERIFY2(mw.ui->currentGameMultiplier->text().compare(QString::fromUtf8("Kein Bock")) == 0, qPrintable(QString::fromUtf8("incorrect multiplier label at beginning")));
     QVERIFY2(mw.ui->mandatorySoloButton->isEnabled() == false, qPrintable(QString::fromUtf8("wrong enabled state at beginning")));
 
-    mw.ui->actuals[0]->setText(QString::fromUtf8("-1"));
-    mw.ui->actuals[1]->setText(QString::fromUtf8("-1"));
-    mw.ui->actuals[2]->setText(QString::fromUtf8("1"));
-    mw.ui->actuals[3]->setText(QString::fromUtf8("1"));
+    Input(mw, 0)->setText(QString::fromUtf8("-1"));
+    Input(mw, 1)->setText(QString::fromUtf8("-1"));
+    Input(mw, 2)->setText(QString::fromUtf8("1"));
+    Input(mw, 3)->setText(QString::fromUtf8("1"));
     mw.ui->spinBox->setValue(1);
     QTest::mouseClick(mw.ui->commitButton, Qt::LeftButton);
 
-    mw.ui->actuals[0]->setText(QString::fromUtf8("-1"));
-    mw.ui->actuals[1]->setText(QString::fromUtf8("-1"));
-    mw.ui->actuals[2]->setText(QString::fromUtf8("1"));
-    mw.ui->actuals[3]->setText(QString::fromUtf8("1"));
+    Input(mw, 0)->setText(QString::fromUtf8("-1"));
+    Input(mw, 1)->setText(QString::fromUtf8("-1"));
+    Input(mw, 2)->setText(QString::fromUtf8("1"));
+    Input(mw, 3)->setText(QString::fromUtf8("1"));
     QTest::mouseClick(mw.ui->commitButton, Qt::LeftButton);
 
     QVERIFY2(mw.ui->currentGameMultiplier->text().compare(QString::fromUtf8("Einfachbock")) == 0, qPrintable(QString::fromUtf8("incorrect multiplier label after first game")));
@@ -1152,16 +1132,16 @@ void FrontendTest::MandatorySoloButtonShallBeEnabledAndTrigger() const
     QVERIFY2(mw.ui->currentGameMultiplier->text().compare(QString::fromUtf8("Pflichtsolorunde")) == 0, qPrintable(QString::fromUtf8("incorrect multiplier label after trigger")));
     QVERIFY2(mw.ui->mandatorySoloButton->isEnabled() == false, qPrintable(QString::fromUtf8("wrong enabled state after trigger")));
 
-    mw.ui->actuals[0]->setText(QString::fromUtf8("1"));
-    mw.ui->actuals[1]->setText(QString::fromUtf8("1"));
-    mw.ui->actuals[2]->setText(QString::fromUtf8("-3"));
-    mw.ui->actuals[3]->setText(QString::fromUtf8("1"));
+    Input(mw, 0)->setText(QString::fromUtf8("1"));
+    Input(mw, 1)->setText(QString::fromUtf8("1"));
+    Input(mw, 2)->setText(QString::fromUtf8("-3"));
+    Input(mw, 3)->setText(QString::fromUtf8("1"));
     QTest::mouseClick(mw.ui->commitButton, Qt::LeftButton);
 
-    QVERIFY2(mw.ui->scores[0]->text().compare(QString::fromUtf8("-2")) == 0, qPrintable(QString::fromUtf8("incorrect score 0")));
-    QVERIFY2(mw.ui->scores[1]->text().compare(QString::fromUtf8("-2")) == 0, qPrintable(QString::fromUtf8("incorrect score 1")));
-    QVERIFY2(mw.ui->scores[2]->text().compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect score 2")));
-    QVERIFY2(mw.ui->scores[3]->text().compare(QString::fromUtf8("4")) == 0, qPrintable(QString::fromUtf8("incorrect score 3")));
+    QVERIFY2(StandingsText(mw, 0, StandingsTableModel::Score).compare(QString::fromUtf8("-2")) == 0, qPrintable(QString::fromUtf8("incorrect score 0")));
+    QVERIFY2(StandingsText(mw, 1, StandingsTableModel::Score).compare(QString::fromUtf8("-2")) == 0, qPrintable(QString::fromUtf8("incorrect score 1")));
+    QVERIFY2(StandingsText(mw, 2, StandingsTableModel::Score).compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect score 2")));
+    QVERIFY2(StandingsText(mw, 3, StandingsTableModel::Score).compare(QString::fromUtf8("4")) == 0, qPrintable(QString::fromUtf8("incorrect score 3")));
 
     QTest::mouseClick(mw.ui->resetButton, Qt::LeftButton);
     QTest::mouseClick(mw.ui->resetButton, Qt::LeftButton);
@@ -1198,8 +1178,8 @@ void FrontendTest::EveryOptionOfResetButtonShallBeDisplayed()
     QVERIFY2(!mw.ui->resetButton->isEnabled(), qPrintable(QString::fromUtf8("incorrect reset button state: none")));
     QVERIFY2(mw.ui->resetButton->text().compare(QString::fromUtf8("Zurücksetzen")) == 0, qPrintable(QString::fromUtf8("incorrect reset button label: none")));
 
-    mw.ui->actuals[0]->setText(QString::fromUtf8("2"));
-    mw.ui->actuals[1]->setText(QString::fromUtf8("2"));
+    Input(mw, 0)->setText(QString::fromUtf8("2"));
+    Input(mw, 1)->setText(QString::fromUtf8("2"));
     QTest::mouseClick(mw.ui->commitButton, Qt::LeftButton);
 
     QVERIFY2(mw.ui->resetButton->isEnabled(), qPrintable(QString::fromUtf8("incorrect reset button state: deal")));
@@ -1222,7 +1202,7 @@ void FrontendTest::EveryOptionOfResetButtonShallBeDisplayed()
 
     QVERIFY2(mw.playerSelection == nullptr, qPrintable(QString::fromUtf8("playerSelection still reachable")));
 
-    QVERIFY2(mw.ui->names[1]->text().compare(QString::fromUtf8("NewPlayer")) == 0, qPrintable(QString::fromUtf8("incorrect name")));
+    QVERIFY2(StandingsText(mw, 1, StandingsTableModel::Name).compare(QString::fromUtf8("NewPlayer")) == 0, qPrintable(QString::fromUtf8("incorrect name")));
 
     QVERIFY2(mw.ui->resetButton->isEnabled(), qPrintable(QString::fromUtf8("incorrect reset button state: player choice")));
     QVERIFY2(mw.ui->resetButton->text().compare(QString::fromUtf8("Spielerwahl zurücksetzen")) == 0, qPrintable(QString::fromUtf8("incorrect reset button label: player choice")));
@@ -1338,25 +1318,25 @@ void FrontendTest::LoadGameShallWorkWithPresetValueAndDisplayGame()
     // Assert
     QVERIFY2(mw.presetFilename.isEmpty(), qPrintable(QString::fromUtf8("preset file name not cleared after logic has executed")));
 
-    QVERIFY2(mw.ui->names[0]->text().compare(QString::fromUtf8("A")) == 0, qPrintable(QString::fromUtf8("incorrect player name 0")));
-    QVERIFY2(mw.ui->names[1]->text().compare(QString::fromUtf8("B")) == 0, qPrintable(QString::fromUtf8("incorrect player name 1")));
-    QVERIFY2(mw.ui->names[2]->text().compare(QString::fromUtf8("C")) == 0, qPrintable(QString::fromUtf8("incorrect player name 2")));
-    QVERIFY2(mw.ui->names[3]->text().compare(QString::fromUtf8("D")) == 0, qPrintable(QString::fromUtf8("incorrect player name 3")));
+    QVERIFY2(StandingsText(mw, 0, StandingsTableModel::Name).compare(QString::fromUtf8("A")) == 0, qPrintable(QString::fromUtf8("incorrect player name 0")));
+    QVERIFY2(StandingsText(mw, 1, StandingsTableModel::Name).compare(QString::fromUtf8("B")) == 0, qPrintable(QString::fromUtf8("incorrect player name 1")));
+    QVERIFY2(StandingsText(mw, 2, StandingsTableModel::Name).compare(QString::fromUtf8("C")) == 0, qPrintable(QString::fromUtf8("incorrect player name 2")));
+    QVERIFY2(StandingsText(mw, 3, StandingsTableModel::Name).compare(QString::fromUtf8("D")) == 0, qPrintable(QString::fromUtf8("incorrect player name 3")));
 
-    QVERIFY2(mw.ui->names[0]->styleSheet().compare(ExpectedStandardNamesStyleSheet) == 0, qPrintable(QString::fromUtf8("incorrect dealer state name 0")));
-    QVERIFY2(mw.ui->names[1]->styleSheet().compare(ExpectedStandardNamesStyleSheet) == 0, qPrintable(QString::fromUtf8("incorrect dealer state name 1")));
-    QVERIFY2(mw.ui->names[2]->styleSheet().compare(ExpectedStandardNamesStyleSheet) == 0, qPrintable(QString::fromUtf8("incorrect dealer state name 2")));
-    QVERIFY2(mw.ui->names[3]->styleSheet().compare(ExpectedDealerNamesStyleSheet) == 0, qPrintable(QString::fromUtf8("incorrect dealer state name 4")));
+    QVERIFY2(!IsDealer(mw, 0), qPrintable(QString::fromUtf8("incorrect dealer state name 0")));
+    QVERIFY2(!IsDealer(mw, 1), qPrintable(QString::fromUtf8("incorrect dealer state name 1")));
+    QVERIFY2(!IsDealer(mw, 2), qPrintable(QString::fromUtf8("incorrect dealer state name 2")));
+    QVERIFY2(IsDealer(mw, 3), qPrintable(QString::fromUtf8("incorrect dealer state name 4")));
 
-    QVERIFY2(mw.ui->actuals[0]->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 0")));
-    QVERIFY2(mw.ui->actuals[1]->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 1")));
-    QVERIFY2(mw.ui->actuals[2]->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 2")));
-    QVERIFY2(mw.ui->actuals[3]->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 3")));
+    QVERIFY2(Input(mw, 0)->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 0")));
+    QVERIFY2(Input(mw, 1)->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 1")));
+    QVERIFY2(Input(mw, 2)->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 2")));
+    QVERIFY2(Input(mw, 3)->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 3")));
 
-    QVERIFY2(mw.ui->scores[0]->text().compare(QString::fromUtf8("-9")) == 0, qPrintable(QString::fromUtf8("incorrect scores 0")));
-    QVERIFY2(mw.ui->scores[1]->text().compare(QString::fromUtf8("-21")) == 0, qPrintable(QString::fromUtf8("incorrect scores 1")));
-    QVERIFY2(mw.ui->scores[2]->text().compare(QString::fromUtf8("21")) == 0, qPrintable(QString::fromUtf8("incorrect scores 2")));
-    QVERIFY2(mw.ui->scores[3]->text().compare(QString::fromUtf8("9")) == 0, qPrintable(QString::fromUtf8("incorrect scores 3")));
+    QVERIFY2(StandingsText(mw, 0, StandingsTableModel::Score).compare(QString::fromUtf8("-9")) == 0, qPrintable(QString::fromUtf8("incorrect scores 0")));
+    QVERIFY2(StandingsText(mw, 1, StandingsTableModel::Score).compare(QString::fromUtf8("-21")) == 0, qPrintable(QString::fromUtf8("incorrect scores 1")));
+    QVERIFY2(StandingsText(mw, 2, StandingsTableModel::Score).compare(QString::fromUtf8("21")) == 0, qPrintable(QString::fromUtf8("incorrect scores 2")));
+    QVERIFY2(StandingsText(mw, 3, StandingsTableModel::Score).compare(QString::fromUtf8("9")) == 0, qPrintable(QString::fromUtf8("incorrect scores 3")));
 
     QVERIFY2(mw.ui->currentGameMultiplier->text().compare(QString::fromUtf8("Dreifachbock")) == 0, qPrintable(QString::fromUtf8("current game multiplier label incorrect")));
     QVERIFY2(mw.ui->tripleMultiplier->text().compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("triple multiplier label incorrect")));
@@ -1390,81 +1370,81 @@ void FrontendTest::FocusOnActualShallTriggerAutofill() const
     QApplication::setActiveWindow(&mw);
 
     // Act 1
-    mw.ui->actuals[0]->setText(QString::fromUtf8("2"));
-    QTest::mouseClick(mw.ui->actuals[3], Qt::LeftButton);
+    Input(mw, 0)->setText(QString::fromUtf8("2"));
+    QTest::mouseClick(Input(mw, 3), Qt::LeftButton);
     QTest::qWait(this->ShortInterval);
 
     // Assert 1
-    QVERIFY2(mw.ui->actuals[0]->selectedText().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect selected text actuals 0")));
-    QVERIFY2(mw.ui->actuals[3]->selectedText().compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("incorrect selected text actuals 3")));
+    QVERIFY2(Input(mw, 0)->selectedText().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect selected text actuals 0")));
+    QVERIFY2(Input(mw, 3)->selectedText().compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("incorrect selected text actuals 3")));
 
-    QVERIFY2(mw.ui->actuals[0]->text().compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 0")));
-    QVERIFY2(mw.ui->actuals[1]->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 1")));
-    QVERIFY2(mw.ui->actuals[2]->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 2")));
-    QVERIFY2(mw.ui->actuals[3]->text().compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 3")));
-    QVERIFY2(mw.ui->actuals[4]->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 4")));
-    QVERIFY2(mw.ui->actuals[5]->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 5")));
+    QVERIFY2(Input(mw, 0)->text().compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 0")));
+    QVERIFY2(Input(mw, 1)->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 1")));
+    QVERIFY2(Input(mw, 2)->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 2")));
+    QVERIFY2(Input(mw, 3)->text().compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 3")));
+    QVERIFY2(Input(mw, 4)->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 4")));
+    QVERIFY2(Input(mw, 5)->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 5")));
 
     // Reset
     for(unsigned int i = 0; i < players.size(); ++i)
     {
-        mw.ui->actuals[i]->clear();
+        Input(mw, i)->clear();
     }
-    mw.ui->actuals[0]->setFocus();
+    Input(mw, 0)->setFocus();
 
     // Act 2
-    mw.ui->actuals[0]->setText(QString::fromUtf8("3"));
-    QTest::mouseClick(mw.ui->actuals[3], Qt::LeftButton);
-    QTest::mouseClick(mw.ui->actuals[4], Qt::LeftButton);
+    Input(mw, 0)->setText(QString::fromUtf8("3"));
+    QTest::mouseClick(Input(mw, 3), Qt::LeftButton);
+    QTest::mouseClick(Input(mw, 4), Qt::LeftButton);
 
     // Assert 2
-    QVERIFY2(mw.ui->actuals[0]->text().compare(QString::fromUtf8("3")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 0")));
-    QVERIFY2(mw.ui->actuals[1]->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 1")));
-    QVERIFY2(mw.ui->actuals[2]->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 2")));
-    QVERIFY2(mw.ui->actuals[3]->text().compare(QString::fromUtf8("3")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 3")));
-    QVERIFY2(mw.ui->actuals[4]->text().compare(QString::fromUtf8("3")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 4")));
-    QVERIFY2(mw.ui->actuals[5]->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 5")));
+    QVERIFY2(Input(mw, 0)->text().compare(QString::fromUtf8("3")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 0")));
+    QVERIFY2(Input(mw, 1)->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 1")));
+    QVERIFY2(Input(mw, 2)->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 2")));
+    QVERIFY2(Input(mw, 3)->text().compare(QString::fromUtf8("3")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 3")));
+    QVERIFY2(Input(mw, 4)->text().compare(QString::fromUtf8("3")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 4")));
+    QVERIFY2(Input(mw, 5)->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 5")));
 
     // Reset
     for(unsigned int i = 0; i < players.size(); ++i)
     {
-        mw.ui->actuals[i]->clear();
+        Input(mw, i)->clear();
     }
-    mw.ui->actuals[0]->setFocus();
+    Input(mw, 0)->setFocus();
 
     // Act 3
-    mw.ui->actuals[0]->setText(QString::fromUtf8("4"));
-    mw.ui->actuals[4]->setText(QString::fromUtf8("5"));
-    QTest::mouseClick(mw.ui->actuals[1], Qt::LeftButton);
+    Input(mw, 0)->setText(QString::fromUtf8("4"));
+    Input(mw, 4)->setText(QString::fromUtf8("5"));
+    QTest::mouseClick(Input(mw, 1), Qt::LeftButton);
 
     // Assert 3
-    QVERIFY2(mw.ui->actuals[0]->text().compare(QString::fromUtf8("4")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 0")));
-    QVERIFY2(mw.ui->actuals[1]->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 1")));
-    QVERIFY2(mw.ui->actuals[2]->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 2")));
-    QVERIFY2(mw.ui->actuals[3]->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 3")));
-    QVERIFY2(mw.ui->actuals[4]->text().compare(QString::fromUtf8("5")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 4")));
-    QVERIFY2(mw.ui->actuals[5]->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 5")));
+    QVERIFY2(Input(mw, 0)->text().compare(QString::fromUtf8("4")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 0")));
+    QVERIFY2(Input(mw, 1)->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 1")));
+    QVERIFY2(Input(mw, 2)->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 2")));
+    QVERIFY2(Input(mw, 3)->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 3")));
+    QVERIFY2(Input(mw, 4)->text().compare(QString::fromUtf8("5")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 4")));
+    QVERIFY2(Input(mw, 5)->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 5")));
 
     // Reset
     for(unsigned int i = 0; i < players.size(); ++i)
     {
-        mw.ui->actuals[i]->clear();
+        Input(mw, i)->clear();
     }
-    mw.ui->actuals[0]->setFocus();
+    Input(mw, 0)->setFocus();
 
     // Act 4
-    mw.ui->actuals[0]->setText(QString::fromUtf8("6"));
+    Input(mw, 0)->setText(QString::fromUtf8("6"));
     QTest::keyClick(&mw, Qt::Key_Tab);
 
     // Assert 4
-    QVERIFY2(mw.ui->actuals[1]->hasFocus(), qPrintable(QString::fromUtf8("actuals 1 does not have focus")));
-
-    QVERIFY2(mw.ui->actuals[0]->text().compare(QString::fromUtf8("6")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 0")));
-    QVERIFY2(mw.ui->actuals[1]->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 1")));
-    QVERIFY2(mw.ui->actuals[2]->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 2")));
-    QVERIFY2(mw.ui->actuals[3]->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 3")));
-    QVERIFY2(mw.ui->actuals[4]->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 4")));
-    QVERIFY2(mw.ui->actuals[5]->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 5")));
+    QVERIFY2(Input(mw, 1)->hasFocus(), qPrintable(QString::fromUtf8("actuals 1 does not have focus")));
+
+    QVERIFY2(Input(mw, 0)->text().compare(QString::fromUtf8("6")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 0")));
+    QVERIFY2(Input(mw, 1)->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 1")));
+    QVERIFY2(Input(mw, 2)->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 2")));
+    QVERIFY2(Input(mw, 3)->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 3")));
+    QVERIFY2(Input(mw, 4)->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 4")));
+    QVERIFY2(Input(mw, 5)->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect text actuals 5")));
 }
 
 void FrontendTest::ReturnKeyShallCommitGame() const
@@ -1494,45 +1474,105 @@ void FrontendTest::ReturnKeyShallCommitGame() const
     mw.UpdateDisplay();
 
     // Act
-    mw.ui->actuals[0]->setText(QString::fromUtf8("2"));
-    mw.ui->actuals[3]->setText(QString::fromUtf8("2"));
-    QTest::keyClick(mw.ui->actuals[3], Qt::Key_Return);
+    Input(mw, 0)->setText(QString::fromUtf8("2"));
+    Input(mw, 3)->setText(QString::fromUtf8("2"));
+    QTest::keyClick(Input(mw, 3), Qt::Key_Return);
+
+    // Assert
+    QVERIFY2(StandingsText(mw, 0, StandingsTableModel::Name).compare(QString::fromUtf8("A")) == 0, qPrintable(QString::fromUtf8("incorrect player name 0")));
+    QVERIFY2(StandingsText(mw, 1, StandingsTableModel::Name).compare(QString::fromUtf8("B")) == 0, qPrintable(QString::fromUtf8("incorrect player name 1")));
+    QVERIFY2(StandingsText(mw, 2, StandingsTableModel::Name).compare(QString::fromUtf8("C")) == 0, qPrintable(QString::fromUtf8("incorrect player name 2")));
+    QVERIFY2(StandingsText(mw, 3, StandingsTableModel::Name).compare(QString::fromUtf8("D")) == 0, qPrintable(QString::fromUtf8("incorrect player name 3")));
+    QVERIFY2(StandingsText(mw, 4, StandingsTableModel::Name).compare(QString::fromUtf8("E")) == 0, qPrintable(QString::fromUtf8("incorrect player name 4")));
+    QVERIFY2(StandingsText(mw, 5, StandingsTableModel::Name).compare(QString::fromUtf8("F")) == 0, qPrintable(QString::fromUtf8("incorrect player name 5")));
+
+    QVERIFY2(Input(mw, 0)->isEnabled() == false, qPrintable(QString::fromUtf8("incorrect state actuals 0")));
+    QVERIFY2(Input(mw, 1)->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 1")));
+    QVERIFY2(Input(mw, 2)->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 2")));
+    QVERIFY2(Input(mw, 3)->isEnabled() == false, qPrintable(QString::fromUtf8("incorrect state actuals 3")));
+    QVERIFY2(Input(mw, 4)->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 4")));
+    QVERIFY2(Input(mw, 5)->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 5")));
+
+    QVERIFY2(StandingsText(mw, 0, StandingsTableModel::Score).compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("incorrect scores 0")));
+    QVERIFY2(StandingsText(mw, 1, StandingsTableModel::Score).compare(QString::fromUtf8("-2")) == 0, qPrintable(QString::fromUtf8("incorrect scores 1")));
+    QVERIFY2(StandingsText(mw, 2, StandingsTableModel::Score).compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect scores 2")));
+    QVERIFY2(StandingsText(mw, 3, StandingsTableModel::Score).compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("incorrect scores 3")));
+    QVERIFY2(StandingsText(mw, 4, StandingsTableModel::Score).compare(QString::fromUtf8("-2")) == 0, qPrintable(QString::fromUtf8("incorrect scores 4")));
+    QVERIFY2(StandingsText(mw, 5, StandingsTableModel::Score).compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect scores 5")));
+
+    QVERIFY2(StandingsText(mw, 0, StandingsTableModel::LastGame).compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("incorrect last games 0")));
+    QVERIFY2(StandingsText(mw, 1, StandingsTableModel::LastGame).compare(QString::fromUtf8("-2")) == 0, qPrintable(QString::fromUtf8("incorrect last games 1")));
+    QVERIFY2(StandingsText(mw, 2, StandingsTableModel::LastGame).compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect last games 2")));
+    QVERIFY2(StandingsText(mw, 3, StandingsTableModel::LastGame).compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("incorrect last games 3")));
+    QVERIFY2(StandingsText(mw, 4, StandingsTableModel::LastGame).compare(QString::fromUtf8("-2")) == 0, qPrintable(QString::fromUtf8("incorrect last games 4")));
+    QVERIFY2(StandingsText(mw, 5, StandingsTableModel::LastGame).compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect last games 5")));
+
+    QVERIFY2(Input(mw, 0)->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 0 not empty")));
+    QVERIFY2(Input(mw, 1)->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 1 not empty")));
+    QVERIFY2(Input(mw, 2)->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 2 not empty")));
+    QVERIFY2(Input(mw, 3)->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 3 not empty")));
+    QVERIFY2(Input(mw, 4)->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 4 not empty")));
+    QVERIFY2(Input(mw, 5)->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 5 not empty")));
+}
+
+void FrontendTest::CommittingDealsInLongSessionShallBeBenchmarked() const
+{
+    // Arrange
+    const unsigned int numberOfDeals = 2000U;
+    MainWindow mw(this->DefaultPlayers, std::make_shared<MemoryRepository>(), false);
+
+    mw.gameInfo.SetPlayers({ "A", "B", "C", "D", "E", "F" }, "C", { 3 });
+    for(unsigned int deal = 0; deal < numberOfDeals; ++deal)
+    {
+        std::vector<std::pair<std::string, int>> changes;
+        for(const auto & playerInfo : mw.gameInfo.PlayerInfosView())
+        {
+            if(playerInfo.IsPlaying() && changes.size() < 2)
+            {
+                changes.emplace_back(playerInfo.Name(), static_cast<int>(deal % 5U) + 1);
+            }
+        }
+
+        mw.gameInfo.PushDeal(changes, 0U);
+    }
+    mw.UpdateDisplay();
+    QCoreApplication::processEvents();
+
+    auto enterWinners = [&mw]()
+    {
+        unsigned int entered = 0;
+        for(unsigned int index = 0; index < mw.gameInfo.PlayerInfosView().size() && entered < 2; ++index)
+        {
+            if(Input(mw, index)->isEnabled())
+            {
+                Input(mw, index)->setText(QString::fromUtf8("2"));
+                ++entered;
+            }
+        }
+    };
+
+    // Act
+    auto dealsBefore = mw.gameInfo.DealsRecorded();
+
+    // a commit is measured including the queued replot of the history
+    QBENCHMARK
+    {
+        enterWinners();
+        QTest::mouseClick(mw.ui->commitButton, Qt::LeftButton);
+        QCoreApplication::processEvents();
+    }
 
     // Assert
-    QVERIFY2(mw.ui->names[0]->text().compare(QString::fromUtf8("A")) == 0, qPrintable(QString::fromUtf8("incorrect player name 0")));
-    QVERIFY2(mw.ui->names[1]->text().compare(QString::fromUtf8("B")) == 0, qPrintable(QString::fromUtf8("incorrect player name 1")));
-    QVERIFY2(mw.ui->names[2]->text().compare(QString::fromUtf8("C")) == 0, qPrintable(QString::fromUtf8("incorrect player name 2")));
-    QVERIFY2(mw.ui->names[3]->text().compare(QString::fromUtf8("D")) == 0, qPrintable(QString::fromUtf8("incorrect player name 3")));
-    QVERIFY2(mw.ui->names[4]->text().compare(QString::fromUtf8("E")) == 0, qPrintable(QString::fromUtf8("incorrect player name 4")));
-    QVERIFY2(mw.ui->names[5]->text().compare(QString::fromUtf8("F")) == 0, qPrintable(QString::fromUtf8("incorrect player name 5")));
-
-    QVERIFY2(mw.ui->actuals[0]->isEnabled() == false, qPrintable(QString::fromUtf8("incorrect state actuals 0")));
-    QVERIFY2(mw.ui->actuals[1]->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 1")));
-    QVERIFY2(mw.ui->actuals[2]->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 2")));
-    QVERIFY2(mw.ui->actuals[3]->isEnabled() == false, qPrintable(QString::fromUtf8("incorrect state actuals 3")));
-    QVERIFY2(mw.ui->actuals[4]->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 4")));
-    QVERIFY2(mw.ui->actuals[5]->isEnabled() == true, qPrintable(QString::fromUtf8("incorrect state actuals 5")));
-
-    QVERIFY2(mw.ui->scores[0]->text().compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("incorrect scores 0")));
-    QVERIFY2(mw.ui->scores[1]->text().compare(QString::fromUtf8("-2")) == 0, qPrintable(QString::fromUtf8("incorrect scores 1")));
-    QVERIFY2(mw.ui->scores[2]->text().compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect scores 2")));
-    QVERIFY2(mw.ui->scores[3]->text().compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("incorrect scores 3")));
-    QVERIFY2(mw.ui->scores[4]->text().compare(QString::fromUtf8("-2")) == 0, qPrintable(QString::fromUtf8("incorrect scores 4")));
-    QVERIFY2(mw.ui->scores[5]->text().compare(QString::fromUtf8("0")) == 0, qPrintable(QString::fromUtf8("incorrect scores 5")));
-
-    QVERIFY2(mw.ui->lastGames[0]->text().compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("incorrect last games 0")));
-    QVERIFY2(mw.ui->lastGames[1]->text().compare(QString::fromUtf8("-2")) == 0, qPrintable(QString::fromUtf8("incorrect last games 1")));
-    QVERIFY2(mw.ui->lastGames[2]->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect last games 2")));
-    QVERIFY2(mw.ui->lastGames[3]->text().compare(QString::fromUtf8("2")) == 0, qPrintable(QString::fromUtf8("incorrect last games 3")));
-    QVERIFY2(mw.ui->lastGames[4]->text().compare(QString::fromUtf8("-2")) == 0, qPrintable(QString::fromUtf8("incorrect last games 4")));
-    QVERIFY2(mw.ui->lastGames[5]->text().compare(QString::fromUtf8("")) == 0, qPrintable(QString::fromUtf8("incorrect last games 5")));
-
-    QVERIFY2(mw.ui->actuals[0]->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 0 not empty")));
-    QVERIFY2(mw.ui->actuals[1]->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 1 not empty")));
-    QVERIFY2(mw.ui->actuals[2]->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 2 not empty")));
-    QVERIFY2(mw.ui->actuals[3]->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 3 not empty")));
-    QVERIFY2(mw.ui->actuals[4]->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 4 not empty")));
-    QVERIFY2(mw.ui->actuals[5]->text().isEmpty(), qPrintable(QString::fromUtf8("actuals 5 not empty")));
+    QVERIFY2(mw.gameInfo.DealsRecorded() > dealsBefore, qPrintable(QString::fromUtf8("no deal committed")));
+
+    auto playerInfos = mw.gameInfo.PlayerInfosView();
+    auto dealer = mw.gameInfo.Dealer();
+    for(unsigned int index = 0; index < playerInfos.size(); ++index)
+    {
+        QVERIFY2(IsDealer(mw, index) == (&playerInfos[index] == dealer.get()), qPrintable(QString::fromUtf8("incorrect dealer styling %1").arg(index)));
+        QVERIFY2(StandingsText(mw, index, StandingsTableModel::Score).compare(QString().setNum(playerInfos[index].CurrentScore())) == 0, qPrintable(QString::fromUtf8("incorrect score %1").arg(index)));
+        QVERIFY2(Input(mw, index)->isEnabled() == playerInfos[index].IsPlaying(), qPrintable(QString::fromUtf8("incorrect state actuals %1").arg(index)));
+    }
 }
 
 #endif // _USE_LONG_TEST
@@ -23,7 +23,11 @@
 int main(int argc, char *argv[])
 {
     QApplication a(argc, argv);
+#ifdef MY_MAX_PLAYERS
+    const unsigned int maxPlayers = MY_MAX_PLAYERS;
+#else
     const unsigned int maxPlayers = 8U;
+#endif
     MainWindow w(maxPlayers);
     w.show();
     return QApplication::exec();
@@ -23,7 +23,7 @@
 MemoryRepository::MemoryRepository()
 = default;
 
-void MemoryRepository::Save(const std::vector<std::shared_ptr<Backend::Entry>> & entries, const std::u8string & identifier)
+void MemoryRepository::Save(const std::vector<Backend::Entry> & entries, const std::u8string & identifier)
 {
     std::stringstream ss;
     deserializer.Serialize(entries, ss);
@@ -34,7 +34,7 @@ void MemoryRepository::Save(const std::vector<std::shared_ptr<Backend::Entry>> &
     storage[identifier] = content;
 }
 
-std::vector<std::shared_ptr<Backend::Entry>> MemoryRepository::Load(const std::u8string & identifier)
+std::vector<Backend::Entry> MemoryRepository::Load(const std::u8string & identifier)
 {
     std::string content;
     bool found = TryGetByIdentifier(identifier, content);
@@ -43,12 +43,12 @@ public:
     /*!
      * \reimp
      */
-    void Save(const std::vector<std::shared_ptr<Backend::Entry>> & entries, const std::u8string & identifier) override;
+    void Save(const std::vector<Backend::Entry> & entries, const std::u8string & identifier) override;
 
     /*!
      * \reimp
      */
-    std::vector<std::shared_ptr<Backend::Entry>> Load(const std::u8string & identifier) override;
+    std::vector<Backend::Entry> Load(const std::u8string & identifier) override;
 
     /*!
      * \brief Attempts to get the string stored under the identifier.